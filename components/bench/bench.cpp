@@ -0,0 +1,56 @@
+/* Self */
+#include <bench.hpp>
+
+/* C++ Standard Library */
+#include <cinttypes>
+#include <cstdio>
+
+/* ESP-IDF */
+#include <sdkconfig.h>
+#include <esp_heap_caps.h>
+#if CONFIG_IDF_TARGET_LINUX
+#include <chrono>
+#else
+#include <esp_cpu.h>
+#endif
+
+/* ^\__________________________________________ */
+/* Namespaces.                                  */
+using namespace bench;
+
+
+/* ^\__________________________________________ */
+/* #region Public methods.                      */
+
+std::uint32_t Runner::cycles() noexcept
+{
+#if CONFIG_IDF_TARGET_LINUX
+    auto const now = std::chrono::steady_clock::now().time_since_epoch();
+    return static_cast<std::uint32_t>( std::chrono::duration_cast<std::chrono::nanoseconds>( now ).count() );
+#else
+    return static_cast<std::uint32_t>( esp_cpu_get_cycle_count() );
+#endif
+}
+
+std::size_t Runner::freeHeap() noexcept
+{
+    return heap_caps_get_free_size( MALLOC_CAP_8BIT );
+}
+
+void Runner::header() noexcept
+{
+    // Note: Plain stdout instead of ESP_LOGx, so that lines carry no log prefix.
+    std::printf( "BENCH,name,iterations,min_cycles,mean_cycles,heap_bytes\n" );
+}
+
+void Runner::report( Result const &r ) noexcept
+{
+    std::printf( "BENCH,%.*s,%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRId32 "\n"
+               , static_cast<int>( r.name.size() ), r.name.data()
+               , r.iterations
+               , r.minCycles
+               , r.meanCycles
+               , r.heapBytes );
+}
+
+/* #endregion */// Public methods.
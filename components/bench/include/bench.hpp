@@ -0,0 +1,153 @@
+#pragma once
+
+/* C++ Standard Library */
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace bench
+{
+
+    /** @brief Measurements of one benchmark. */
+    struct Result
+    {
+        std::string_view name;      //!< Benchmark name, e.g. `value255.create.heap`.
+        std::uint32_t iterations;   //!< Number of measured operations.
+        std::uint32_t minCycles;    //!< Fastest operation in CPU cycles.
+        std::uint32_t meanCycles;   //!< Mean operation in CPU cycles.
+        std::int32_t heapBytes;     //!< Mean heap bytes held by the result of one operation.
+    };
+
+    /** @brief Cycle-accurate micro-benchmark runner. */
+    /**
+     * @details
+     * Runs an operation many times and records, per operation:
+     *
+     * - the CPU cycles spent in the operation itself,
+     *   read with `esp_cpu_get_cycle_count()`, and
+     * - the heap bytes held while its result is alive,
+     *   read with `heap_caps_get_free_size( MALLOC_CAP_8BIT )`.
+     *
+     * The heap is sampled outside the timed region, so it does not add to
+     * the cycle counts. Results are printed by `report()` as one CSV line
+     * each, prefixed with `BENCH,` so that they can be grepped out of a
+     * monitor log and compared across firmware builds:
+     *
+     * \code{.unparsed}
+     * BENCH,name,iterations,min_cycles,mean_cycles,heap_bytes
+     * BENCH,value255.create.inline,1000,112,118,0
+     * \endcode
+     *
+     * @par Example:
+     * \code{.cpp}
+     * bench::Runner::report( bench::Runner::run( "spec.isWithinRange.numeric", 1000U, [&]() noexcept
+     * {
+     *     return spec.isWithinRange( value );
+     * } ) );
+     * \endcode
+     *
+     * @note
+     * On the Linux target the counter is `std::chrono::steady_clock` in
+     * nanoseconds, so only the relative numbers are meaningful there.
+     *
+     * @note ja: CPUサイクルカウンタによるマイクロベンチマーク。
+     */
+    class Runner
+    {
+    public:
+        explicit Runner() noexcept = delete; //!< @brief Default constructor (deleted).
+
+    /* ^\__________________________________________ */
+    /* #region Static members, Inner types.         */
+
+    public:
+
+        /** @brief Default number of iterations per benchmark. */
+        static constexpr std::uint32_t DEFAULT_ITERATIONS = 1000U;
+
+        /** @brief Returns the current CPU cycle count. */
+        [[nodiscard]]
+        static std::uint32_t cycles() noexcept;
+
+        /** @brief Returns the free size of the default heap in bytes. */
+        [[nodiscard]]
+        static std::size_t freeHeap() noexcept;
+
+        /** @brief Prevents the compiler from discarding `v`. */
+        template <typename T>
+        static void keep( T const &v ) noexcept
+        {
+            asm volatile( "" : : "r"( &v ) : "memory" );
+        }
+
+        /** @brief Measures `op`. */
+        /**
+         * @details
+         * `op` is invoked `iterations` times without arguments. If it
+         * returns a value, the value is kept alive until the heap has been
+         * sampled, so allocating operations such as `create()` report the
+         * size of what they allocated.
+         *
+         * @param name       [in] Benchmark name; must outlive the result.
+         * @param iterations [in] Number of operations to measure.
+         * @param op         [in] The operation.
+         *
+         * @return The measurements.
+         */
+        template <typename Op>
+        [[nodiscard]]
+        static Result run( std::string_view name, std::uint32_t iterations, Op &&op ) noexcept
+        {
+            std::uint32_t min_cycles = UINT32_MAX;
+            std::uint64_t total_cycles = 0U;
+            std::int64_t total_heap = 0;
+
+            for ( std::uint32_t i = 0U; i < iterations; i++ )
+            {
+                std::size_t const heap_before = freeHeap();
+                std::uint32_t elapsed = 0U;
+                std::size_t heap_after = 0U;
+
+                if constexpr ( std::is_void_v<std::invoke_result_t<Op &>> )
+                {
+                    std::uint32_t const start = cycles();
+                    op();
+                    elapsed = cycles() - start;
+                    heap_after = freeHeap();
+                }
+                else
+                {
+                    std::uint32_t const start = cycles();
+                    auto const result = op();
+                    elapsed = cycles() - start;
+                    heap_after = freeHeap();
+                    keep( result );
+                } // Note: The result is released here, outside the measurement.
+
+                min_cycles = std::min( min_cycles, elapsed );
+                total_cycles += elapsed;
+                total_heap += static_cast<std::int64_t>( heap_before ) - static_cast<std::int64_t>( heap_after );
+            }
+
+            std::uint32_t const n = std::max( iterations, 1U );
+
+            return Result{ name
+                         , iterations
+                         , ( iterations > 0U ) ? min_cycles : 0U
+                         , static_cast<std::uint32_t>( total_cycles / n )
+                         , static_cast<std::int32_t>( total_heap / n ) };
+        }
+
+        /** @brief Prints the CSV header line. */
+        static void header() noexcept;
+
+        /** @brief Prints one result as a CSV line. */
+        static void report( Result const &r ) noexcept;
+
+    /* #endregion */// Static members, Inner types
+
+    }; // class Runner
+
+} // namespace bench
@@ -0,0 +1,133 @@
+#include <unity.h>
+#include <unity_test_runner.h>
+#include <bench.hpp>
+#include <property_index.hpp>
+#include <property_table.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+using namespace machine;
+using namespace machine::property;
+
+
+namespace
+{
+    using bench::Runner;
+
+    // Note: Same names in both layouts, so that two builds diff line by line;
+    //       see CONFIG_MACHINE_PROPERTY_TABLE_SOA.
+    constexpr std::size_t COUNT = 512U;
+    constexpr std::uint32_t SCAN_ITERATIONS = 100U;
+
+    std::optional<PropertyTable> createTable()
+    {
+        std::byte const init{0}, min{0}, max{100}, mask{0x3F};
+        PropertyTable::Builder builder;
+        builder.reserve(COUNT);
+
+        for (std::size_t i = 0; i < COUNT; i++)
+        {
+            auto spec = (i % 4U == 3U) ? Spec::create(Permission::Kind::ReadOnly, &init, 1, nullptr, 0, &mask, 1)
+                                       : Spec::create(Permission::Kind::ReadWrite, &init, 1, &min, 1, &max, 1);
+            if (!spec) { return std::nullopt; }
+
+            auto property = Property::create(static_cast<std::uint8_t>(i), std::move(*spec));
+            if (!property) { return std::nullopt; }
+
+            builder.add(Address(0, static_cast<std::uint8_t>(i / 256U), 1, 0, static_cast<std::uint8_t>(i)), std::move(*property));
+        }
+        return builder.build();
+    }
+}
+
+TEST_CASE("PropertyTable scans and range checks", "[bench]")
+{
+    auto table = createTable();
+    TEST_ASSERT_TRUE(table.has_value());
+
+    Runner::header();
+    Runner::report(Runner::run("table.scan.codes", SCAN_ITERATIONS, [&]() noexcept
+    {
+        std::uint32_t sum = 0U;
+        for (std::size_t i = 0; i < table->size(); i++) { sum += table->codeAt(i); }
+        return sum;
+    }));
+    Runner::report(Runner::run("table.scan.formats", SCAN_ITERATIONS, [&]() noexcept
+    {
+        std::uint32_t bitsets = 0U;
+        for (std::size_t i = 0; i < table->size(); i++) { bitsets += (table->formatAt(i) == Format::Kind::BitSet); }
+        return bitsets;
+    }));
+    Runner::report(Runner::run("table.scan.value_sizes", SCAN_ITERATIONS, [&]() noexcept
+    {
+        std::uint32_t total = 0U;
+        for (std::size_t i = 0; i < table->size(); i++) { total += table->at(i).value().size(); }
+        return total;
+    }));
+
+    std::byte const payload{42};
+    std::size_t next = 0;
+    Runner::report(Runner::run("table.isWithinRange", Runner::DEFAULT_ITERATIONS, [&]() noexcept
+    {
+        next = (next + 1U) % COUNT;
+        return table->isWithinRange(next, std::span(&payload, 1));
+    }));
+    Runner::report(Runner::run("table.at.spec.isWithinRange", Runner::DEFAULT_ITERATIONS, [&]() noexcept
+    {
+        next = (next + 1U) % COUNT;
+        return table->at(next).spec().isWithinRange(std::span(&payload, 1));
+    }));
+
+    std::uint8_t round = 0U;
+    Runner::report(Runner::run("table.set", Runner::DEFAULT_ITERATIONS, [&]() noexcept
+    {
+        next = (next + 1U) % COUNT;
+        std::byte const v{static_cast<std::uint8_t>(round++ % 64U)};
+        return table->set(next, &v, 1);
+    }));
+}
+
+TEST_CASE("PropertyIndex queries against a scan", "[bench]")
+{
+    auto table = createTable();
+    TEST_ASSERT_TRUE(table.has_value());
+    PropertyIndex const index(*table);
+
+    // Note: Read-only BitSets of the second unit, a quarter of its properties.
+    PropertyIndex::Filter const filter{.permissions = PropertyIndex::maskOf(Permission::Kind::ReadOnly),
+                                       .formats = PropertyIndex::maskOf(Format::Kind::BitSet),
+                                       .keys = Address(0, 1, 0, 0, 0).unitRange()};
+
+    Runner::header();
+    Runner::report(Runner::run("table.scan.query", SCAN_ITERATIONS, [&]() noexcept
+    {
+        std::uint32_t found = 0U;
+        for (std::size_t i = 0; i < table->size(); i++)
+        {
+            found += (table->addressAt(i).unitIndex() == 1U) && (table->permissionAt(i) == Permission::Kind::ReadOnly) &&
+                     (table->formatAt(i) == Format::Kind::BitSet);
+        }
+        return found;
+    }));
+    Runner::report(Runner::run("index.select", SCAN_ITERATIONS, [&]() noexcept
+    {
+        std::array<std::size_t, 32> out;
+        std::size_t from = 0U;
+        std::size_t n;
+        std::uint32_t found = 0U;
+        while ((n = index.select(filter, out, from)) > 0U)
+        {
+            found += static_cast<std::uint32_t>(n);
+            from = out[n - 1U] + 1U;
+        }
+        return found;
+    }));
+    Runner::report(Runner::run("index.count", SCAN_ITERATIONS, [&]() noexcept
+    {
+        return index.count(filter);
+    }));
+}
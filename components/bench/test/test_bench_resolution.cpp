@@ -0,0 +1,57 @@
+#include <unity.h>
+#include <unity_test_runner.h>
+#include <bench.hpp>
+#include <resolution.hpp>
+
+#include <array>
+#include <cstdint>
+
+using namespace machine::property;
+
+
+namespace
+{
+    using bench::Runner;
+    using Kind = Resolution::Kind;
+
+    /** @brief Defeats constant folding of the benchmarked arguments. */
+    Kind volatile kind_source = Kind::X0_5;
+    std::int32_t volatile raw_source = 51;
+}
+
+TEST_CASE("Resolution conversions", "[bench]")
+{
+    Kind const kind = kind_source;
+    std::int32_t const raw = raw_source;
+
+    Runner::header();
+    Runner::report(Runner::run("resolution.scaleFactorOf", Runner::DEFAULT_ITERATIONS, [&]() noexcept
+    {
+        return raw * Resolution::scaleFactorOf(kind);
+    }));
+    Runner::report(Runner::run("resolution.toScaled", Runner::DEFAULT_ITERATIONS, [&]() noexcept
+    {
+        return Resolution::toScaled(raw, kind);
+    }));
+    Runner::report(Runner::run("resolution.toMillis", Runner::DEFAULT_ITERATIONS, [&]() noexcept
+    {
+        return Resolution::toMillis(raw, kind);
+    }));
+    Runner::report(Runner::run("resolution.fromMillis", Runner::DEFAULT_ITERATIONS, [&]() noexcept
+    {
+        return Resolution::fromMillis(std::int64_t{ raw } * 500, kind);
+    }));
+
+    std::array<std::int32_t, 64U> values {};
+    std::array<std::int64_t, 64U> millis {};
+    values.fill(raw);
+
+    Runner::report(Runner::run("resolution.toMillis.batch64", Runner::DEFAULT_ITERATIONS, [&]() noexcept
+    {
+        return Resolution::toMillis(values, kind, millis);
+    }));
+    Runner::report(Runner::run("resolution.fromMillis.batch64", Runner::DEFAULT_ITERATIONS, [&]() noexcept
+    {
+        return Resolution::fromMillis(millis, kind, values);
+    }));
+}
@@ -0,0 +1,96 @@
+#include <unity.h>
+#include <unity_test_runner.h>
+#include <bench.hpp>
+#include <spec.hpp>
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+using namespace machine::property;
+
+
+namespace
+{
+    using bench::Runner;
+
+    constexpr std::byte INIT{ 0x21 };
+    constexpr std::byte MIN{ 0x0C };
+    constexpr std::byte MAX{ 0x46 };
+    constexpr std::string_view TEXT = "SN-0123456789";
+
+    std::optional<Spec> createNumeric()
+    {
+        return Spec::create(Permission::Kind::ReadWrite, Resolution::Kind::X0_5, &INIT, 1, &MIN, 1, &MAX, 1);
+    }
+
+    std::optional<Spec> createBitSet()
+    {
+        return Spec::create(Permission::Kind::ReadWrite, &INIT, 1, nullptr, 0, &MAX, 1);
+    }
+
+    std::optional<Spec> createBoolean()
+    {
+        return Spec::create(Permission::Kind::ReadWrite, &detail::BOOL_FALSE, detail::BOOL_SIZE,
+                            &detail::BOOL_FALSE, detail::BOOL_SIZE, &detail::BOOL_TRUE, detail::BOOL_SIZE);
+    }
+
+    std::optional<Spec> createString()
+    {
+        auto const init = std::as_bytes(std::span(TEXT));
+        return Spec::create(Permission::Kind::ReadWrite, init.data(), static_cast<std::uint8_t>(init.size()),
+                            nullptr, 0, nullptr, 0);
+    }
+}
+
+TEST_CASE("Spec create per format", "[bench]")
+{
+    Runner::header();
+    Runner::report(Runner::run("spec.create.numeric", Runner::DEFAULT_ITERATIONS, &createNumeric));
+    Runner::report(Runner::run("spec.create.bitset", Runner::DEFAULT_ITERATIONS, &createBitSet));
+    Runner::report(Runner::run("spec.create.boolean", Runner::DEFAULT_ITERATIONS, &createBoolean));
+    Runner::report(Runner::run("spec.create.string", Runner::DEFAULT_ITERATIONS, &createString));
+}
+
+TEST_CASE("Spec isWithinRange per format", "[bench]")
+{
+    auto const numeric = createNumeric();
+    auto const bitset = createBitSet();
+    auto const boolean = createBoolean();
+    auto const string = createString();
+    TEST_ASSERT_TRUE(numeric.has_value() && bitset.has_value() && boolean.has_value() && string.has_value());
+
+    Runner::header();
+    Runner::report(Runner::run("spec.isWithinRange.numeric", Runner::DEFAULT_ITERATIONS, [&]() noexcept
+    {
+        return numeric->isWithinRange(numeric->initVal());
+    }));
+    Runner::report(Runner::run("spec.isWithinRange.bitset", Runner::DEFAULT_ITERATIONS, [&]() noexcept
+    {
+        return bitset->isWithinRange(bitset->initVal());
+    }));
+    Runner::report(Runner::run("spec.isWithinRange.boolean", Runner::DEFAULT_ITERATIONS, [&]() noexcept
+    {
+        return boolean->isWithinRange(boolean->initVal());
+    }));
+    Runner::report(Runner::run("spec.isWithinRange.string", Runner::DEFAULT_ITERATIONS, [&]() noexcept
+    {
+        return string->isWithinRange(string->initVal());
+    }));
+    Runner::report(Runner::run("spec.isWithinRange.int32", Runner::DEFAULT_ITERATIONS, [&]() noexcept
+    {
+        return numeric->isWithinRange(std::int32_t{ 40 });
+    }));
+}
+
+TEST_CASE("Spec create and clone of shared values", "[bench]")
+{
+    auto const string = createString(); // Note: Holds the payload, so the runs below only share it.
+    TEST_ASSERT_TRUE(string.has_value());
+
+    Runner::header();
+    Runner::report(Runner::run("spec.create.string.shared", Runner::DEFAULT_ITERATIONS, &createString));
+    Runner::report(Runner::run("spec.clone.string", Runner::DEFAULT_ITERATIONS, [&]() noexcept {
+        return string->clone();
+    }));
+}
@@ -0,0 +1,116 @@
+#include <unity.h>
+#include <unity_test_runner.h>
+#include <bench.hpp>
+#include <value255.hpp>
+
+#include <array>
+#include <compare>
+#include <cstdint>
+
+using namespace value;
+
+
+namespace
+{
+    using bench::Runner;
+
+    /** @brief Same-sized payloads below and above the inline capacity. */
+    struct Payloads
+    {
+        std::array<std::byte, 16U> a;
+        std::array<std::byte, 16U> b;
+    };
+
+    Payloads makePayloads()
+    {
+        Payloads p {};
+        for (std::size_t i = 0; i < p.a.size(); i++)
+        {
+            p.a[i] = static_cast<std::byte>(i);
+            p.b[i] = static_cast<std::byte>(0xFF - i);
+        }
+        return p;
+    }
+
+    void benchValue255(char const *const (&names)[10], std::uint8_t size)
+    {
+        Payloads const p = makePayloads();
+        auto const x = Value255::create(p.a.data(), size);
+        auto const y = Value255::create(p.a.data(), size);
+        TEST_ASSERT_TRUE(x.has_value() && y.has_value());
+
+        Runner::report(Runner::run(names[0], Runner::DEFAULT_ITERATIONS, [&]() noexcept
+        {
+            return Value255::create(p.a.data(), size);
+        }));
+
+        MutableValue255 m;
+        std::uint32_t flip = 0U;
+
+        Runner::report(Runner::run(names[1], Runner::DEFAULT_ITERATIONS, [&]() noexcept
+        {
+            return m.set(((flip++ & 1U) != 0U) ? p.a.data() : p.b.data(), size);
+        }));
+
+        Runner::report(Runner::run(names[2], Runner::DEFAULT_ITERATIONS, [&]() noexcept
+        {
+            return m.setEx(((flip++ & 1U) != 0U) ? p.a.data() : p.b.data(), size);
+        }));
+
+        Runner::report(Runner::run(names[3], Runner::DEFAULT_ITERATIONS, [&]() noexcept
+        {
+            return m.setEx(p.a.data(), size); // Note: Equal after the first call.
+        }));
+
+        Runner::report(Runner::run(names[4], Runner::DEFAULT_ITERATIONS, [&]() noexcept
+        {
+            return *x == *y;
+        }));
+
+        Runner::report(Runner::run(names[5], Runner::DEFAULT_ITERATIONS, [&]() noexcept
+        {
+            return (*x <=> *y) == std::strong_ordering::equal;
+        }));
+
+        Runner::report(Runner::run(names[6], Runner::DEFAULT_ITERATIONS, [&]() noexcept
+        {
+            return x->str();
+        }));
+
+        Runner::report(Runner::run(names[7], Runner::DEFAULT_ITERATIONS, [&]() noexcept
+        {
+            return x->bytes();
+        }));
+
+        Runner::report(Runner::run(names[8], Runner::DEFAULT_ITERATIONS, [&]() noexcept
+        {
+            return x->clone();
+        }));
+
+        Runner::report(Runner::run(names[9], Runner::DEFAULT_ITERATIONS, [&]() noexcept
+        {
+            Value255::View const view = x->view();
+            return view.size();
+        }));
+    }
+}
+
+TEST_CASE("Value255 inline payload (2 bytes)", "[bench]")
+{
+    Runner::header();
+    benchValue255({ "value255.create.inline", "value255.set.inline", "value255.setEx.inline"
+                  , "value255.setEx_nochange.inline", "value255.equal.inline", "value255.compare.inline"
+                  , "value255.str.inline", "value255.bytes.inline", "value255.clone.inline"
+                  , "value255.view.inline" }
+                  , 2U);
+}
+
+TEST_CASE("Value255 heap payload (16 bytes)", "[bench]")
+{
+    Runner::header();
+    benchValue255({ "value255.create.heap", "value255.set.heap", "value255.setEx.heap"
+                  , "value255.setEx_nochange.heap", "value255.equal.heap", "value255.compare.heap"
+                  , "value255.str.heap", "value255.bytes.heap", "value255.clone.heap"
+                  , "value255.view.heap" }
+                  , 16U);
+}
@@ -0,0 +1,183 @@
+/* Self */
+#include <change_ring.hpp>
+
+/* C++ Standard Library */
+#include <algorithm>
+#include <bit>
+
+/* ^\__________________________________________ */
+/* Namespaces.                                  */
+using namespace machine;
+
+
+/* ^\__________________________________________ */
+/* #region Constructors.                        */
+
+ChangeRing::ChangeRing( PropertyTable &table ) noexcept
+    : table_( table )
+    , tracked_( ( table.size() + WORD_BITS - 1U ) / WORD_BITS )
+    , missed_( ( table.size() + WORD_BITS - 1U ) / WORD_BITS )
+{
+    table_.onChange( &ChangeRing::onChange, this );
+}
+
+ChangeRing::~ChangeRing() noexcept
+{
+    table_.onChange( nullptr, nullptr );
+}
+
+/* #endregion */// Constructors.
+
+
+/* ^\__________________________________________ */
+/* #region Public methods.                      */
+
+void ChangeRing::track( std::size_t index, bool tracked ) noexcept
+{
+    Word const bit = Word{ 1U } << ( index % WORD_BITS );
+
+    if ( tracked )
+    {
+        tracked_[index / WORD_BITS].fetch_or( bit, std::memory_order_relaxed );
+    }
+    else
+    {
+        tracked_[index / WORD_BITS].fetch_and( ~bit, std::memory_order_relaxed );
+    }
+}
+
+void ChangeRing::trackAll() noexcept
+{
+    for ( std::size_t i = 0U; i < table_.size(); i += WORD_BITS )
+    {
+        std::size_t const n = std::min( WORD_BITS, table_.size() - i );
+        Word const bits = ( n == WORD_BITS ) ? ~Word{ 0U } : ( ( Word{ 1U } << n ) - 1U );
+
+        tracked_[i / WORD_BITS].fetch_or( bits, std::memory_order_relaxed );
+    }
+}
+
+void ChangeRing::setConsumer( TaskHandle_t task ) noexcept
+{
+    consumer_.store( task, std::memory_order_relaxed );
+}
+
+bool ChangeRing::push( std::size_t index ) noexcept
+{
+    if ( !isTracked( index ) ) { return false; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on untracked property!! ]
+
+    std::uint32_t const head = head_.load( std::memory_order_relaxed );
+
+    if ( head - tail_.load( std::memory_order_acquire ) == CAPACITY )
+    {
+        overflows_.fetch_add( 1U, std::memory_order_relaxed );
+        Word const bit = Word{ 1U } << ( index % WORD_BITS );
+        missed_[index / WORD_BITS].fetch_or( bit, std::memory_order_release );
+        return false;
+    }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on full ring!! ]
+
+    Event &event = events_[head & ( CAPACITY - 1U )];
+    event.key   = table_.addressAt( index ).key();
+    event.tick  = xTaskGetTickCount();
+    event.index = static_cast<std::uint32_t>( index );
+    {
+        property::Value const &value = table_.at( index ).value();
+        property::Value::View const view = value.view();
+        // [===> Follows: Locked]
+
+        std::size_t const n = std::min<std::size_t>( view.size(), PAYLOAD_SIZE );
+        std::copy_n( view.span().begin(), n, event.payload.begin() );
+        event.size = view.size();
+        event.complete = ( n == view.size() );
+    }
+    if ( !event.complete ) { truncated_.fetch_add( 1U, std::memory_order_relaxed ); }
+
+    // Note: seq_cst pairs with `pop()`, so the check below sees a consumer that drained the ring meanwhile.
+    head_.store( head + 1U, std::memory_order_seq_cst );
+    pushed_.fetch_add( 1U, std::memory_order_relaxed );
+
+    // Note: Wakes the consumer only if it had taken every earlier event, i.e. may be waiting.
+    TaskHandle_t const task = consumer_.load( std::memory_order_relaxed );
+    if ( ( task != nullptr ) && ( tail_.load( std::memory_order_seq_cst ) == head ) )
+    {
+        xTaskNotifyGive( task );
+    }
+
+    return true;
+}
+
+std::optional<ChangeRing::Event> ChangeRing::pop() noexcept
+{
+    std::uint32_t const tail = tail_.load( std::memory_order_relaxed );
+
+    if ( head_.load( std::memory_order_seq_cst ) == tail ) { return std::nullopt; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on empty ring!! ]
+
+    Event const event = events_[tail & ( CAPACITY - 1U )];
+    tail_.store( tail + 1U, std::memory_order_seq_cst );
+
+    return event;
+}
+
+std::size_t ChangeRing::takeMissed( std::span<std::size_t> out ) noexcept
+{
+    std::size_t count = 0U;
+
+    for ( std::size_t w = 0U; ( w < missed_.size() ) && ( count < out.size() ); w++ )
+    {
+        if ( missed_[w].load( std::memory_order_relaxed ) == 0U ) { continue; }
+        // [===> Follows: At least one bit is set]
+
+        Word bits = missed_[w].exchange( 0U, std::memory_order_acquire );
+
+        while ( ( bits != 0U ) && ( count < out.size() ) )
+        {
+            int const b = std::countr_zero( bits );
+            out[count++] = w * WORD_BITS + static_cast<std::size_t>( b );
+            bits &= bits - 1U; // Note: Clear the lowest set bit.
+        }
+
+        if ( bits != 0U )
+        {
+            missed_[w].fetch_or( bits, std::memory_order_relaxed ); // Note: Did not fit, keep them missed.
+        }
+    }
+
+    return count;
+}
+
+bool ChangeRing::isTracked( std::size_t index ) const noexcept
+{
+    Word const bit = Word{ 1U } << ( index % WORD_BITS );
+
+    return ( tracked_[index / WORD_BITS].load( std::memory_order_relaxed ) & bit ) != 0U;
+}
+
+std::size_t ChangeRing::size() const noexcept
+{
+    std::uint32_t const tail = tail_.load( std::memory_order_acquire ); // Note: Tail first, so it never passes head.
+
+    return head_.load( std::memory_order_acquire ) - tail;
+}
+
+ChangeRing::Stats ChangeRing::stats() const noexcept
+{
+    return Stats{ pushed_.load( std::memory_order_relaxed )
+                , overflows_.load( std::memory_order_relaxed )
+                , truncated_.load( std::memory_order_relaxed ) };
+}
+
+/* #endregion */// Public methods.
+
+
+/* ^\__________________________________________ */
+/* #region Private methods.                     */
+
+void ChangeRing::onChange( PropertyTable const & /* table */, std::size_t index, void *context ) noexcept
+{
+    static_cast<ChangeRing *>( context )->push( index );
+}
+
+/* #endregion */// Private methods.
@@ -0,0 +1,92 @@
+/* Self */
+#include <compact_property.hpp>
+
+/* C++ Standard Library */
+#include <format>
+#include <iterator>
+#include <utility>
+
+/* Custom Library */
+#include <property_format.hpp>
+
+/* ^\__________________________________________ */
+/* Namespaces.                                  */
+using namespace machine;
+using namespace machine::property;
+
+
+/* ^\__________________________________________ */
+/* #region Factory methods, Constructors.       */
+
+std::optional<CompactProperty> CompactProperty::create( std::uint8_t code
+                                                      , Spec const &spec ) noexcept
+{
+    auto value = spec.initVal().clone();
+
+    if ( !value.has_value() ) { return std::nullopt; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on allocation failure!! ]
+    // [===> Follows: Initial value copied]
+
+    return create( code, spec, std::move( value.value() ) );
+}
+
+std::optional<CompactProperty> CompactProperty::create( std::uint8_t code
+                                                      , Spec const &spec
+                                                      , Value &&value ) noexcept
+{
+    auto const handle = SpecPool::intern( spec );
+
+    if ( !handle.has_value() ) { return std::nullopt; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on full pool!! ]
+
+    return std::optional<CompactProperty>{
+        CompactProperty{ code, handle.value(), std::move( value ) }
+    };
+}
+
+CompactProperty::CompactProperty( std::uint8_t code
+                                , SpecPool::Handle spec
+                                , Value &&value ) noexcept
+    : code_( code )
+    , spec_( std::bit_cast<RawHandle>( spec ) )
+    , value_( std::move( value ) )
+{ /* Do nothing */ }
+
+CompactProperty::CompactProperty( CompactProperty &&other ) noexcept
+    : code_( other.code_ )
+    , spec_( std::exchange( other.spec_, std::bit_cast<RawHandle>( SpecPool::NONE ) ) )
+    , value_( std::move( other.value_ ) )
+{ /* Do nothing */ }
+
+CompactProperty::~CompactProperty() noexcept
+{
+    SpecPool::release( specHandle() );
+}
+
+/* #endregion */// Factory methods, Constructors.
+
+
+/* ^\__________________________________________ */
+/* #region Operators.                           */
+
+namespace machine
+{
+    std::ostream &operator<<( std::ostream &os, CompactProperty const &v ) noexcept
+    {
+        std::format_to( std::ostreambuf_iterator<char>( os ), "{}", v );
+        return os;
+    }
+}
+
+/* #endregion */// Operators.
+
+
+/* ^\__________________________________________ */
+/* #region Public methods.                      */
+
+std::string CompactProperty::str() const noexcept
+{
+    return std::format( "{}", *this );
+}
+
+/* #endregion */// Public methods.
@@ -0,0 +1,28 @@
+/* Self */
+#include <component.hpp>
+
+/* C++ Standard Library */
+#include <format>
+#include <iterator>
+
+/* Custom Library */
+#include <component_format.hpp>
+
+/* ^\__________________________________________ */
+/* Namespaces.                                  */
+using namespace machine;
+
+
+/* ^\__________________________________________ */
+/* #region Operators.                           */
+
+namespace machine
+{
+    std::ostream &operator<<( std::ostream &os, Component const &v ) noexcept
+    {
+        std::format_to( std::ostreambuf_iterator<char>( os ), "{}", v );
+        return os;
+    }
+}
+
+/* #endregion */// Operators.
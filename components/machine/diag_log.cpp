@@ -0,0 +1,376 @@
+/* Self */
+#include <diag_log.hpp>
+
+/* C++ Standard Library */
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <format>
+
+/* Custom Library */
+#include <property_format.hpp>
+#include <spec_format.hpp>
+#include <value255_format.hpp>
+
+/* ^\__________________________________________ */
+/* Namespaces.                                  */
+using namespace machine;
+using namespace machine::property;
+
+
+/* ^\__________________________________________ */
+/* #region Private types, functions.            */
+
+namespace
+{
+    /** @brief Set in the kind byte if a value was cut. */
+    constexpr std::uint8_t TRUNCATED_BIT = 0x80U;
+
+    /** @brief Reads the payload of a record, front to back. */
+    struct Reader
+    {
+        std::span<std::byte const> rest;
+
+        std::optional<std::byte> byte() noexcept
+        {
+            if ( rest.empty() ) { return std::nullopt; }
+
+            std::byte const b = rest[0];
+            rest = rest.subspan( 1U );
+            return b;
+        }
+
+        std::optional<std::span<std::byte const>> value() noexcept
+        {
+            auto const size = byte();
+            if ( !size || ( std::to_integer<std::size_t>( *size ) > rest.size() ) )
+            {
+                rest = {}; // Note: Every later item fails too.
+                return std::nullopt;
+            }
+            // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on short payload!! ]
+
+            auto const bytes = rest.first( std::to_integer<std::size_t>( *size ) );
+            rest = rest.subspan( bytes.size() );
+            return bytes;
+        }
+    };
+
+} // namespace
+
+/** @brief Fills one cell; cuts values that do not fit. */
+class DiagLog::Writer
+{
+public:
+
+    /**
+     * @param cell   [out] The reserved cell.
+     * @param values [in]  Number of values that follow, so their size bytes always fit.
+     */
+    Writer( Cell &cell, Kind kind, std::uint16_t tag, std::size_t values ) noexcept
+        : cell_( cell ), pending_( values )
+    {
+        cell_.bytes[0] = MAGIC;
+        cell_.bytes[1] = std::byte{ static_cast<std::uint8_t>( kind ) };
+        cell_.bytes[2] = std::byte{ static_cast<std::uint8_t>( tag ) };
+        cell_.bytes[3] = std::byte{ static_cast<std::uint8_t>( tag >> 8U ) };
+    }
+
+    void put( std::byte b ) noexcept { cell_.bytes[size_++] = b; }
+
+    void put( Value const &v ) noexcept
+    {
+        pending_--;
+
+        Value::View const view = v.view();
+        std::size_t const room = truncated_ ? 0U : RECORD_SIZE - size_ - 1U - pending_;
+        std::size_t const n = std::min<std::size_t>( view.size(), room );
+
+        if ( n < view.size() ) { truncated_ = true; }
+
+        cell_.bytes[size_++] = std::byte{ static_cast<std::uint8_t>( n ) };
+        std::memcpy( cell_.bytes.data() + size_, view.span().data(), n );
+        size_ += n;
+    }
+
+    void put( Spec const &spec ) noexcept
+    {
+        put( DiagLog::fragmentsOf( spec ) );
+        put( spec.initVal() );
+        put( spec.minVal() );
+        put( spec.maxVal() );
+    }
+
+    /** @brief Completes the header; returns `true` if a value was cut. */
+    bool finish() noexcept
+    {
+        if ( truncated_ ) { cell_.bytes[1] |= std::byte{ TRUNCATED_BIT }; }
+        cell_.bytes[4] = std::byte{ static_cast<std::uint8_t>( size_ - HEADER_SIZE ) };
+        cell_.size = static_cast<std::uint16_t>( size_ );
+
+        return truncated_;
+    }
+
+private:
+
+    Cell &cell_;
+    std::size_t size_ = HEADER_SIZE;
+    std::size_t pending_;
+    bool truncated_ = false;
+};
+
+/* #endregion */// Private types, functions.
+
+
+/* ^\__________________________________________ */
+/* #region Constructors.                        */
+
+DiagLog::DiagLog( Config const &config ) noexcept
+    : config_( config )
+{
+    for ( std::size_t i = 0U; i < CAPACITY; i++ )
+    {
+        cells_[i].sequence.store( static_cast<std::uint32_t>( i ), std::memory_order_relaxed );
+    }
+}
+
+DiagLog::~DiagLog() noexcept
+{
+    if ( task_ ) { vTaskDelete( task_ ); task_ = nullptr; }
+}
+
+/* #endregion */// Constructors
+
+
+/* ^\__________________________________________ */
+/* #region Public methods.                      */
+
+bool DiagLog::start() noexcept
+{
+    if ( !config_.sink ) { return false; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on missing sink!! ]
+
+    BaseType_t const core = ( CONFIG_MACHINE_DIAG_LOG_CORE < 0 ) ? tskNO_AFFINITY : CONFIG_MACHINE_DIAG_LOG_CORE;
+
+    return xTaskCreatePinnedToCore( &DiagLog::entry
+                                  , "diag_log"
+                                  , CONFIG_MACHINE_DIAG_LOG_STACK_SIZE
+                                  , this
+                                  , CONFIG_MACHINE_DIAG_LOG_PRIORITY
+                                  , &task_
+                                  , core ) == pdPASS;
+}
+
+bool DiagLog::log( std::uint16_t tag, Spec const &spec ) noexcept
+{
+    std::uint32_t position;
+    Cell *const cell = reserve( position );
+    if ( !cell ) { return false; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on full ring!! ]
+
+    Writer writer( *cell, Kind::Spec, tag, 3U );
+    writer.put( spec );
+    commit( *cell, position, writer.finish() );
+
+    return true;
+}
+
+bool DiagLog::log( std::uint16_t tag, Value const &value ) noexcept
+{
+    std::uint32_t position;
+    Cell *const cell = reserve( position );
+    if ( !cell ) { return false; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on full ring!! ]
+
+    Writer writer( *cell, Kind::Value, tag, 1U );
+    writer.put( value );
+    commit( *cell, position, writer.finish() );
+
+    return true;
+}
+
+bool DiagLog::log( std::uint16_t tag, Property const &property ) noexcept
+{
+    std::uint32_t position;
+    Cell *const cell = reserve( position );
+    if ( !cell ) { return false; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on full ring!! ]
+
+    Writer writer( *cell, Kind::Property, tag, 4U );
+    writer.put( std::byte{ property.code() } );
+    writer.put( property.spec() );
+    writer.put( property.value() );
+    commit( *cell, position, writer.finish() );
+
+    return true;
+}
+
+void DiagLog::drain() noexcept
+{
+    std::uint32_t position = tail_.load( std::memory_order_relaxed );
+
+    while ( true )
+    {
+        Cell &cell = cells_[position & ( CAPACITY - 1U )];
+
+        if ( cell.sequence.load( std::memory_order_acquire ) != position + 1U ) { break; }
+        // [===> Follows: Written; a cell still being written stops the drain, keeping the order]
+
+        config_.sink( std::span<std::byte const>( cell.bytes.data(), cell.size ), config_.context );
+
+        cell.sequence.store( position + static_cast<std::uint32_t>( CAPACITY ), std::memory_order_release );
+        position++;
+        tail_.store( position, std::memory_order_relaxed );
+    }
+}
+
+DiagLog::Stats DiagLog::stats() const noexcept
+{
+    return Stats{ logged_.load( std::memory_order_relaxed )
+                , dropped_.load( std::memory_order_relaxed )
+                , truncated_.load( std::memory_order_relaxed ) };
+}
+
+std::optional<DiagLog::Decoded> DiagLog::decode( std::span<std::byte const> record ) noexcept
+{
+    if ( ( record.size() < HEADER_SIZE ) || ( record[0] != MAGIC )
+      || ( HEADER_SIZE + std::to_integer<std::size_t>( record[4] ) != record.size() ) )
+    {
+        return std::nullopt;
+    }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on malformed header!! ]
+
+    std::uint8_t const kind = std::to_integer<std::uint8_t>( record[1] );
+    Decoded decoded{ static_cast<Kind>( kind & ~TRUNCATED_BIT )
+                   , static_cast<std::uint16_t>( std::to_integer<std::uint16_t>( record[2] )
+                                               | ( std::to_integer<std::uint16_t>( record[3] ) << 8U ) )
+                   , ( kind & TRUNCATED_BIT ) != 0U
+                   , {} };
+
+    Reader r{ record.subspan( HEADER_SIZE ) };
+
+    switch ( decoded.kind )
+    {
+
+    case Kind::Spec:
+    {
+        auto const frags = r.byte();
+        auto const init = r.value(), min = r.value(), max = r.value();
+        if ( !max ) { return std::nullopt; } // Note: Set only if every earlier item is.
+
+        decoded.text = specText( *frags, *init, *min, *max );
+        break;
+    }
+
+    case Kind::Value:
+    {
+        auto const value = r.value();
+        if ( !value ) { return std::nullopt; }
+
+        decoded.text = std::format( "{}", value::detail::HexBytes{ *value } );
+        break;
+    }
+
+    case Kind::Property:
+    {
+        auto const code = r.byte(), frags = r.byte();
+        auto const init = r.value(), min = r.value(), max = r.value(), value = r.value();
+        if ( !value ) { return std::nullopt; } // Note: Set only if every earlier item is.
+
+        decoded.text = std::format( machine::detail::PROPERTY_FORMAT
+                                  , std::to_integer<std::uint8_t>( *code )
+                                  , specText( *frags, *init, *min, *max )
+                                  , value::detail::HexBytes{ *value } );
+        break;
+    }
+
+    default:
+        return std::nullopt; // Note: Unknown kind.
+
+    } // switch ( decoded.kind )
+
+    if ( !r.rest.empty() ) { return std::nullopt; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on trailing bytes!! ]
+
+    return decoded;
+}
+
+/* #endregion */// Public methods.
+
+
+/* ^\__________________________________________ */
+/* #region Private methods.                     */
+
+void DiagLog::entry( void *context ) noexcept
+{
+    DiagLog &self = *static_cast<DiagLog *>( context );
+
+    while ( true )
+    {
+        ulTaskNotifyTake( pdTRUE, pdMS_TO_TICKS( CONFIG_MACHINE_DIAG_LOG_DRAIN_PERIOD_MS ) );
+        self.drain();
+    }
+}
+
+DiagLog::Cell *DiagLog::reserve( std::uint32_t &position ) noexcept
+{
+    position = head_.load( std::memory_order_relaxed );
+
+    while ( true )
+    {
+        Cell &cell = cells_[position & ( CAPACITY - 1U )];
+        auto const diff = static_cast<std::int32_t>( cell.sequence.load( std::memory_order_acquire ) - position );
+
+        if ( diff == 0 )
+        {
+            // Note: On failure `position` is reloaded, and the cell checked again.
+            if ( head_.compare_exchange_weak( position, position + 1U, std::memory_order_relaxed ) ) { return &cell; }
+        }
+        else if ( diff < 0 )
+        {
+            dropped_.fetch_add( 1U, std::memory_order_relaxed );
+            return nullptr; // Note: Not drained since one lap; the ring is full.
+        }
+        else
+        {
+            position = head_.load( std::memory_order_relaxed ); // Note: Taken by another task.
+        }
+    }
+}
+
+void DiagLog::commit( Cell &cell, std::uint32_t position, bool truncated ) noexcept
+{
+    cell.sequence.store( position + 1U, std::memory_order_release );
+
+    logged_.fetch_add( 1U, std::memory_order_relaxed );
+    if ( truncated ) { truncated_.fetch_add( 1U, std::memory_order_relaxed ); }
+
+    // Note: Wakes the drain task once per half ring instead of once per record.
+    if ( task_ && ( position + 1U - tail_.load( std::memory_order_relaxed ) == CAPACITY / 2U ) )
+    {
+        xTaskNotifyGive( task_ );
+    }
+}
+
+std::byte DiagLog::fragmentsOf( Spec const &spec ) noexcept
+{
+    return std::bit_cast<std::byte>( spec.frags_ );
+}
+
+std::string DiagLog::specText( std::byte fragments
+                             , std::span<std::byte const> init
+                             , std::span<std::byte const> min
+                             , std::span<std::byte const> max ) noexcept
+{
+    auto const f = std::bit_cast<Spec::Fragments>( fragments );
+
+    return std::format( property::detail::SPEC_FORMAT
+                      , Format::fromRaw( f.format )
+                      , Permission::fromRaw( f.permission )
+                      , Resolution::fromRaw( f.resolution )
+                      , value::detail::HexBytes{ init }
+                      , value::detail::HexBytes{ min }
+                      , value::detail::HexBytes{ max } );
+}
+
+/* #endregion */// Private methods.
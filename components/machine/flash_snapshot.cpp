@@ -0,0 +1,501 @@
+/* Self */
+#include <flash_snapshot.hpp>
+
+/* C++ Standard Library */
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <initializer_list>
+
+/* Custom Library */
+#include <hash_util.hpp>
+#include <spec.hpp>
+
+/* ESP-IDF */
+#include <esp_rom_crc.h>
+#include <freertos/task.h>
+
+/* ^\__________________________________________ */
+/* Namespaces.                                  */
+using namespace machine;
+using namespace machine::property;
+
+
+/* ^\__________________________________________ */
+/* #region Private types, functions.            */
+
+namespace
+{
+    /** @brief First word of every image: "PSNP". */
+    constexpr std::uint32_t MAGIC = 0x504E5350U;
+
+    /** @brief Set in the header flags if the index holds spec hashes. */
+    constexpr std::uint16_t SPECS_FLAG = 0x0001U;
+
+    /** @brief Bytes of the header covered by `Header::headerCrc`. */
+    constexpr std::size_t HEADER_CRC_SIZE = 32U;
+
+    /** @brief Hashes the items and value payloads of a spec. */
+    /**
+     * @details
+     * Unlike `Spec::hash()`, which covers `InternPool` handles, this stays
+     * the same across restarts.
+     */
+    std::uint32_t contentHashOf( Spec const &spec ) noexcept
+    {
+        std::array<std::uint32_t, 4U> const key {
+            ( static_cast<std::uint32_t>( spec.format() ) << 16U ) |
+            ( static_cast<std::uint32_t>( spec.permission() ) << 8U ) |
+              static_cast<std::uint32_t>( spec.resolution() ),
+            spec.initVal().hash(),
+            spec.minVal().hash(),
+            spec.maxVal().hash(),
+        };
+        return util::hashBytes( std::as_bytes( std::span( key ) ) );
+    }
+
+    std::uint32_t crcOf( std::uint32_t crc, std::span<std::byte const> bytes ) noexcept
+    {
+        return esp_rom_crc32_le( crc, reinterpret_cast<std::uint8_t const *>( bytes.data() )
+                               , static_cast<std::uint32_t>( bytes.size() ) );
+    }
+
+} // namespace
+
+/** @brief Buffers one region of a new image and writes it to flash. */
+class FlashSnapshot::Stream
+{
+public:
+
+    /**
+     * @param owner [in] The snapshot; erases the sectors before each write.
+     * @param at    [in] Partition offset of the region.
+     */
+    Stream( FlashSnapshot &owner, std::uint32_t at ) noexcept
+        : owner_( owner ), at_( at )
+    { /* Do nothing */ }
+
+    [[nodiscard]]
+    bool put( std::span<std::byte const> bytes ) noexcept
+    {
+        crc_ = crcOf( crc_, bytes );
+
+        while ( !bytes.empty() )
+        {
+            std::size_t const n = std::min( bytes.size(), buffer_.size() - used_ );
+            std::memcpy( buffer_.data() + used_, bytes.data(), n );
+            used_ += n;
+            bytes = bytes.subspan( n );
+
+            if ( ( used_ == buffer_.size() ) && !flush() ) { return false; }
+        }
+
+        return true;
+    }
+
+    [[nodiscard]]
+    bool put32( std::uint32_t word ) noexcept
+    {
+        std::array<std::byte, 4U> const bytes {
+            std::byte{ static_cast<std::uint8_t>( word ) },
+            std::byte{ static_cast<std::uint8_t>( word >> 8U ) },
+            std::byte{ static_cast<std::uint8_t>( word >> 16U ) },
+            std::byte{ static_cast<std::uint8_t>( word >> 24U ) },
+        };
+        return put( bytes );
+    }
+
+    [[nodiscard]]
+    bool flush() noexcept
+    {
+        if ( used_ == 0U ) { return true; }
+
+        if ( !owner_.prepare( at_ + static_cast<std::uint32_t>( used_ ) ) ) { return false; }
+        // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on no room!! ]
+
+        if ( esp_partition_write( owner_.partition_, at_, buffer_.data(), used_ ) != ESP_OK ) { return false; }
+        // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on flash error!! ]
+
+        at_ += static_cast<std::uint32_t>( used_ );
+        used_ = 0U;
+        return true;
+    }
+
+    /** @brief Returns the partition offset of the next byte put. */
+    [[nodiscard]]
+    std::uint32_t position() const noexcept { return at_ + static_cast<std::uint32_t>( used_ ); }
+
+    [[nodiscard]]
+    std::uint32_t crc() const noexcept { return crc_; }
+
+private:
+
+    FlashSnapshot &owner_;
+    std::uint32_t at_;
+    std::uint32_t crc_ = 0U;
+    std::size_t used_ = 0U;
+    std::array<std::byte, 64U> buffer_;
+};
+
+/* #endregion */// Private types, functions.
+
+
+/* ^\__________________________________________ */
+/* #region Constructors.                        */
+
+FlashSnapshot::FlashSnapshot( PropertyTable const &table, Config const &config ) noexcept
+    : table_( table )
+    , config_( config )
+    , stale_( ( table.size() + STALE_WORD_BITS - 1U ) / STALE_WORD_BITS )
+{ /* Do nothing */ }
+
+FlashSnapshot::~FlashSnapshot() noexcept
+{
+    if ( !map_.empty() ) { esp_partition_munmap( mapping_ ); }
+}
+
+/* #endregion */// Constructors
+
+
+/* ^\__________________________________________ */
+/* #region Public methods.                      */
+
+bool FlashSnapshot::open() noexcept
+{
+    partition_ = esp_partition_find_first( ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, config_.label );
+    if ( !partition_ ) { return false; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on missing partition!! ]
+
+    void const *ptr = nullptr;
+    if ( esp_partition_mmap( partition_, 0U, partition_->size, ESP_PARTITION_MMAP_DATA, &ptr, &mapping_ ) != ESP_OK )
+    {
+        return false;
+    }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on mapping failure!! ]
+    // [===> Follows: The whole partition is readable through `map_`]
+
+    map_ = std::span<std::byte const>( static_cast<std::byte const *>( ptr ), partition_->size );
+    lastSave_ = xTaskGetTickCount(); // Note: A boot loop must not write an image per boot.
+
+    // Note: Take the newest intact image; a newer one that is cut or corrupt is skipped.
+    std::uint32_t below = UINT32_MAX;
+
+    while ( true )
+    {
+        std::optional<std::uint32_t> best;
+        std::optional<Header> bestHeader;
+
+        for ( std::uint32_t offset = 0U; offset + HEADER_SIZE <= map_.size(); offset += partition_->erase_size )
+        {
+            auto const header = headerAt( offset );
+
+            if ( header && ( header->generation < below ) &&
+                 ( !bestHeader || ( header->generation > bestHeader->generation ) ) )
+            {
+                best = offset;
+                bestHeader = header;
+            }
+        }
+
+        if ( !best ) { return true; }
+        // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on no image!! ]
+
+        if ( isIntact( *best, *bestHeader ) )
+        {
+            image_.store( *best, std::memory_order_relaxed );
+            imageEnd_ = alignUp( *best + bestHeader->size );
+            generation_ = bestHeader->generation;
+            next_ = ( imageEnd_ < map_.size() ) ? imageEnd_ : 0U;
+            restored_ = true;
+            break;
+        }
+
+        below = bestHeader->generation;
+    }
+    // [===> Follows: An image is served]
+
+    std::uint32_t const image = image_.load( std::memory_order_relaxed );
+
+    for ( std::size_t i = 0U; i < table_.size(); i++ )
+    {
+        // Note: A value whose spec changed, e.g. by a firmware update, is not served.
+        if ( config_.withSpecs &&
+             ( wordAt( image + HEADER_SIZE + static_cast<std::uint32_t>( i ) * 8U + 4U ) != contentHashOf( table_.at( i ).spec() ) ) )
+        {
+            continue;
+        }
+
+        StaleWord const bit = StaleWord{ 1U } << ( i % STALE_WORD_BITS );
+        stale_[i / STALE_WORD_BITS].fetch_or( bit, std::memory_order_release );
+    }
+
+    return true;
+}
+
+std::optional<std::span<std::byte const>> FlashSnapshot::cached( std::size_t index ) const noexcept
+{
+    if ( !isStale( index ) ) { return std::nullopt; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on fresh value!! ]
+
+    return storedValue( image_.load( std::memory_order_acquire ), index );
+}
+
+void FlashSnapshot::refreshed( std::span<std::size_t const> changed ) noexcept
+{
+    for ( std::size_t index : changed )
+    {
+        StaleWord const bit = StaleWord{ 1U } << ( index % STALE_WORD_BITS );
+        stale_[index / STALE_WORD_BITS].fetch_and( ~bit, std::memory_order_relaxed );
+    }
+
+    if ( !changed.empty() )
+    {
+        pending_.fetch_add( static_cast<std::uint32_t>( changed.size() ), std::memory_order_release );
+    }
+}
+
+bool FlashSnapshot::save() noexcept
+{
+    if ( ( xTaskGetTickCount() - lastSave_ ) < config_.minInterval ) { return false; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on rate limit!! ]
+
+    return saveNow();
+}
+
+bool FlashSnapshot::saveNow() noexcept
+{
+    if ( map_.empty() || ( pending_.load( std::memory_order_relaxed ) == 0U ) ) { return false; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on nothing to save!! ]
+
+    // Note: Changes from now on are saved with the next image.
+    std::uint32_t const pending = pending_.exchange( 0U, std::memory_order_acquire );
+    lastSave_ = xTaskGetTickCount();
+
+    // Note: A failed attempt, e.g. by a flash error or by values that grew while
+    //       being written, is retried once, preferably in the other free region.
+    std::optional<std::uint32_t> at = placeFor( imageSize(), next_ );
+
+    if ( at && !write( *at ) )
+    {
+        std::uint32_t const failed = *at;
+        at = placeFor( imageSize(), ( failed < image_.load( std::memory_order_relaxed ) ) ? imageEnd_ : 0U );
+
+        if ( at && !write( *at ) ) { at.reset(); }
+    }
+
+    if ( !at )
+    {
+        pending_.fetch_add( pending, std::memory_order_relaxed );
+        return false;
+    }
+    // [===> Follows: The new image is served]
+
+    next_ = ( imageEnd_ < map_.size() ) ? imageEnd_ : 0U;
+    return true;
+}
+
+std::size_t FlashSnapshot::staleCount() const noexcept
+{
+    std::size_t count = 0U;
+
+    for ( std::atomic<StaleWord> const &word : stale_ )
+    {
+        count += static_cast<std::size_t>( std::popcount( word.load( std::memory_order_relaxed ) ) );
+    }
+
+    return count;
+}
+
+/* #endregion */// Public methods.
+
+
+/* ^\__________________________________________ */
+/* #region Private methods.                     */
+
+std::optional<FlashSnapshot::Header> FlashSnapshot::headerAt( std::uint32_t offset ) const noexcept
+{
+    Header header;
+    std::memcpy( &header, map_.data() + offset, HEADER_SIZE );
+
+    std::uint16_t const flags = config_.withSpecs ? SPECS_FLAG : 0U;
+    std::size_t const indexSize = table_.size() * ( config_.withSpecs ? 8U : 4U );
+
+    if ( ( header.magic != MAGIC ) || ( header.version != VERSION ) || ( header.flags != flags ) ) { return std::nullopt; }
+    if ( header.headerCrc != crcOf( 0U, map_.subspan( offset, HEADER_CRC_SIZE ) ) ) { return std::nullopt; }
+    // [===> Follows: A complete header]
+
+    if ( ( header.count != table_.size() ) || ( header.layout != layout() ) ) { return std::nullopt; }
+    if ( ( header.size < HEADER_SIZE + indexSize ) || ( header.size > map_.size() - offset ) ) { return std::nullopt; }
+    // [===> Follows: The image belongs to this table and lies within the partition]
+
+    return header;
+}
+
+bool FlashSnapshot::isIntact( std::uint32_t offset, Header const &header ) const noexcept
+{
+    std::size_t const indexSize = table_.size() * ( config_.withSpecs ? 8U : 4U );
+    auto const image = map_.subspan( offset, header.size );
+
+    return ( crcOf( 0U, image.subspan( HEADER_SIZE, indexSize ) ) == header.indexCrc ) &&
+           ( crcOf( 0U, image.subspan( HEADER_SIZE + indexSize ) ) == header.valuesCrc );
+}
+
+std::uint32_t FlashSnapshot::layout() const noexcept
+{
+    return util::hashBytes( std::as_bytes( table_.addresses() ) );
+}
+
+std::uint32_t FlashSnapshot::wordAt( std::uint32_t offset ) const noexcept
+{
+    std::uint32_t word = 0U;
+
+    for ( std::size_t i = 4U; i > 0U; i-- )
+    {
+        word = ( word << 8U ) | std::to_integer<std::uint32_t>( map_[offset + i - 1U] );
+    }
+
+    return word;
+}
+
+std::span<std::byte const> FlashSnapshot::storedValue( std::uint32_t image, std::size_t index ) const noexcept
+{
+    std::uint32_t const stride = config_.withSpecs ? 8U : 4U;
+    std::uint32_t const at = image + wordAt( image + HEADER_SIZE + static_cast<std::uint32_t>( index ) * stride );
+
+    return map_.subspan( at + 1U, std::to_integer<std::size_t>( map_[at] ) );
+}
+
+bool FlashSnapshot::isStale( std::size_t index ) const noexcept
+{
+    StaleWord const bit = StaleWord{ 1U } << ( index % STALE_WORD_BITS );
+
+    return ( stale_[index / STALE_WORD_BITS].load( std::memory_order_acquire ) & bit ) != 0U;
+}
+
+std::size_t FlashSnapshot::imageSize() const noexcept
+{
+    std::uint32_t const stride = config_.withSpecs ? 8U : 4U;
+    std::uint32_t const image = image_.load( std::memory_order_relaxed );
+    std::size_t size = HEADER_SIZE + table_.size() * stride;
+
+    for ( std::size_t i = 0U; i < table_.size(); i++ )
+    {
+        size += 1U + ( isStale( i ) ? storedValue( image, i ).size() : table_.at( i ).value().size() );
+    }
+
+    return size;
+}
+
+std::optional<std::uint32_t> FlashSnapshot::placeFor( std::size_t size, std::uint32_t preferred ) const noexcept
+{
+    // Note: The served image splits the partition into `[0, low)` and `[high, end)`.
+    bool const served = ( generation_ != 0U );
+    std::size_t const low = served ? image_.load( std::memory_order_relaxed ) : map_.size();
+    std::size_t const high = served ? imageEnd_ : map_.size();
+
+    auto const fits = [&]( std::size_t at ) noexcept
+    {
+        return ( ( at < low ) && ( at + size <= low ) ) ||
+               ( ( at >= high ) && ( at + size <= map_.size() ) );
+    };
+
+    for ( std::size_t const at : { std::size_t{ preferred }, std::size_t{ 0U }, high } )
+    {
+        if ( fits( at ) ) { return static_cast<std::uint32_t>( at ); }
+    }
+
+    return std::nullopt;
+}
+
+bool FlashSnapshot::write( std::uint32_t at ) noexcept
+{
+    std::uint32_t const stride = config_.withSpecs ? 8U : 4U;
+    std::uint32_t const image = image_.load( std::memory_order_relaxed );
+
+    erased_ = at;
+    Stream index( *this, at + HEADER_SIZE );
+    Stream values( *this, at + HEADER_SIZE + static_cast<std::uint32_t>( table_.size() ) * stride );
+    std::array<std::byte, 1U + UINT8_MAX> value;
+
+    for ( std::size_t i = 0U; i < table_.size(); i++ )
+    {
+        if ( !index.put32( values.position() - at ) ) { return false; }
+        if ( config_.withSpecs && !index.put32( contentHashOf( table_.at( i ).spec() ) ) ) { return false; }
+
+        // Note: Copy first; the value is not locked while the flash is written.
+        std::size_t size = 0U;
+        if ( isStale( i ) )
+        {
+            auto const stored = storedValue( image, i );
+            std::memcpy( value.data() + 1U, stored.data(), stored.size() );
+            size = stored.size();
+        }
+        else
+        {
+            size = table_.at( i ).value().copyTo( std::span( value ).subspan( 1U ) ).value_or( 0U );
+        }
+        value[0] = std::byte{ static_cast<std::uint8_t>( size ) };
+
+        if ( !values.put( std::span<std::byte const>( value.data(), 1U + size ) ) ) { return false; }
+    }
+
+    if ( !index.flush() || !values.flush() ) { return false; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on no room!! ]
+    // [===> Follows: Index and values are in flash]
+
+    Header header {
+        .magic      = MAGIC,
+        .version    = VERSION,
+        .flags      = static_cast<std::uint16_t>( config_.withSpecs ? SPECS_FLAG : 0U ),
+        .generation = generation_ + 1U,
+        .count      = static_cast<std::uint32_t>( table_.size() ),
+        .layout     = layout(),
+        .size       = values.position() - at,
+        .indexCrc   = index.crc(),
+        .valuesCrc  = values.crc(),
+        .headerCrc  = 0U,
+    };
+    header.headerCrc = crcOf( 0U, std::as_bytes( std::span( &header, 1U ) ).first( HEADER_CRC_SIZE ) );
+
+    // Note: The header commits the image, so it is written last.
+    if ( esp_partition_write( partition_, at, &header, HEADER_SIZE ) != ESP_OK ) { return false; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on flash error!! ]
+
+    image_.store( at, std::memory_order_release );
+    imageEnd_ = alignUp( at + header.size );
+    generation_ = header.generation;
+
+    return true;
+}
+
+bool FlashSnapshot::prepare( std::uint32_t end ) noexcept
+{
+    std::uint32_t const limit = alignUp( end );
+
+    if ( limit <= erased_ ) { return true; }
+    // [===> Follows: More sectors are needed]
+
+    if ( limit > map_.size() ) { return false; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on end of partition!! ]
+
+    bool const overlaps = ( generation_ != 0U ) &&
+                          ( erased_ < imageEnd_ ) && ( limit > image_.load( std::memory_order_relaxed ) );
+    if ( overlaps ) { return false; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on the served image!! ]
+
+    if ( esp_partition_erase_range( partition_, erased_, limit - erased_ ) != ESP_OK ) { return false; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on flash error!! ]
+
+    erased_ = limit;
+    return true;
+}
+
+std::uint32_t FlashSnapshot::alignUp( std::uint32_t offset ) const noexcept
+{
+    std::uint32_t const sector = partition_->erase_size;
+
+    return ( ( offset + sector - 1U ) / sector ) * sector;
+}
+
+/* #endregion */// Private methods.
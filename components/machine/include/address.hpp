@@ -0,0 +1,210 @@
+#pragma once
+
+/* C++ Standard Library */
+#include <compare>
+#include <cstdint>
+
+/* Custom Library */
+#include <component.hpp>
+#include <unit.hpp>
+
+namespace machine
+{
+
+    /** @brief Packed address of a property within a machine. */
+    /**
+     * @details
+     * Identifies a property by its position in the hierarchy:
+     *
+     * - Machine
+     *   - `Unit[]` (unique: kind, index)
+     *     - `Component[]` (unique: code, index)
+     *       - `Property[]`  (unique: code)
+     *
+     * The five 8-bit fields are packed into one integer key, most
+     * significant first:
+     *
+     * \code{.unparsed}
+     * bit 39    32 31    24 23    16 15     8 7      0
+     *     [ unit  ][ unit  ][ comp  ][ comp  ][ prop  ]
+     *     [ kind  ][ index ][ code  ][ index ][ code  ]
+     * \endcode
+     *
+     * Ordering by `key()` is therefore the lexicographic ordering of the
+     * hierarchy, and all properties of one unit or one component form a
+     * contiguous key range (see `unitRange()` / `componentRange()`), as do
+     * all units of one kind (`unitKindRange()`). The upper two and the
+     * middle two fields are the keys of `unit()` and of `component()`.
+     *
+     * @note ja: 階層内のプロパティ位置を1つの整数キーに詰めたアドレス。
+     */
+    class Address
+    {
+    /* ^\__________________________________________ */
+    /* #region Static members, Inner types.         */
+
+    public:
+
+        /** @brief Packed key type. */
+        using Key = std::uint64_t;
+
+        /** @brief Half-open key range `[first, last)`. */
+        struct Range
+        {
+            Key first; //!< First key of the range.
+            Key last;  //!< One past the last key of the range.
+        };
+
+    private:
+
+        static constexpr std::uint8_t UNIT_KIND_SHIFT  = 32U;
+        static constexpr std::uint8_t UNIT_INDEX_SHIFT = 24U;
+        static constexpr std::uint8_t COMP_CODE_SHIFT  = 16U;
+        static constexpr std::uint8_t COMP_INDEX_SHIFT = 8U;
+        static constexpr std::uint8_t PROP_CODE_SHIFT  = 0U;
+
+    /* #endregion */// Static members, Inner types
+
+    /* ^\__________________________________________ */
+    /* #region Constructors.                        */
+
+    public:
+
+        /** @brief Construct from the hierarchy fields. */
+        /**
+         * @param unit_kind  unit kind
+         * @param unit_index unit index
+         * @param comp_code  component code
+         * @param comp_index component index
+         * @param prop_code  property code
+         */
+        explicit constexpr Address( std::uint8_t unit_kind
+                                  , std::uint8_t unit_index
+                                  , std::uint8_t comp_code
+                                  , std::uint8_t comp_index
+                                  , std::uint8_t prop_code ) noexcept
+            : key_( ( static_cast<Key>( unit_kind )  << UNIT_KIND_SHIFT  )
+                  | ( static_cast<Key>( unit_index ) << UNIT_INDEX_SHIFT )
+                  | ( static_cast<Key>( comp_code )  << COMP_CODE_SHIFT  )
+                  | ( static_cast<Key>( comp_index ) << COMP_INDEX_SHIFT )
+                  | ( static_cast<Key>( prop_code )  << PROP_CODE_SHIFT  ) )
+        {}
+
+        /** @brief Construct from a unit, one of its components and a property code. */
+        /**
+         * @param unit      unit of the property
+         * @param component component of the property within `unit`
+         * @param prop_code property code
+         */
+        explicit constexpr Address( Unit unit, Component component, std::uint8_t prop_code ) noexcept
+            : key_( ( static_cast<Key>( unit.key() )      << UNIT_INDEX_SHIFT )
+                  | ( static_cast<Key>( component.key() ) << COMP_INDEX_SHIFT )
+                  | ( static_cast<Key>( prop_code )       << PROP_CODE_SHIFT  ) )
+        {}
+
+    /* #endregion */// Constructors
+
+    /* ^\__________________________________________ */
+    /* #region Operators.                           */
+
+    public:
+
+        constexpr bool operator==( Address const & ) const noexcept = default;  //!< Equality operator (default).
+        constexpr auto operator<=>( Address const & ) const noexcept = default; //!< Three-way comparison operator (default).
+
+    /* #endregion */// Operators
+
+    /* ^\__________________________________________ */
+    /* #region Instance members.                    */
+
+    public:
+
+        /* #region Getter methods */
+
+        [[nodiscard]]
+        constexpr Key key() const noexcept { return key_; }
+
+        [[nodiscard]]
+        constexpr std::uint8_t unitKind() const noexcept { return field( UNIT_KIND_SHIFT ); }
+
+        [[nodiscard]]
+        constexpr std::uint8_t unitIndex() const noexcept { return field( UNIT_INDEX_SHIFT ); }
+
+        [[nodiscard]]
+        constexpr std::uint8_t componentCode() const noexcept { return field( COMP_CODE_SHIFT ); }
+
+        [[nodiscard]]
+        constexpr std::uint8_t componentIndex() const noexcept { return field( COMP_INDEX_SHIFT ); }
+
+        [[nodiscard]]
+        constexpr std::uint8_t propertyCode() const noexcept { return field( PROP_CODE_SHIFT ); }
+
+        [[nodiscard]]
+        constexpr Unit unit() const noexcept { return Unit::fromKey( static_cast<Unit::Key>( key_ >> UNIT_INDEX_SHIFT ) ); }
+
+        [[nodiscard]]
+        constexpr Component component() const noexcept { return Component::fromKey( static_cast<Component::Key>( key_ >> COMP_INDEX_SHIFT ) ); }
+
+        /* #endregion */// Getter methods
+
+        /* #region Public methods */
+
+        /** @brief Returns the key range of all properties of all units of this kind. */
+        [[nodiscard]]
+        constexpr Range unitKindRange() const noexcept { return rangeAbove( UNIT_KIND_SHIFT ); }
+
+        /** @brief Returns the key range of all properties of this unit. */
+        [[nodiscard]]
+        constexpr Range unitRange() const noexcept { return rangeAbove( UNIT_INDEX_SHIFT ); }
+
+        /** @brief Returns the key range of all properties of this component. */
+        [[nodiscard]]
+        constexpr Range componentRange() const noexcept { return rangeAbove( COMP_INDEX_SHIFT ); }
+
+        /** @brief Returns the key range of all properties of `unit`. */
+        [[nodiscard]]
+        static constexpr Range rangeOf( Unit unit ) noexcept
+        {
+            return Address( unit, Component( 0U ), 0U ).unitRange();
+        }
+
+        /** @brief Returns the key range of all properties of `component` of `unit`. */
+        [[nodiscard]]
+        static constexpr Range rangeOf( Unit unit, Component component ) noexcept
+        {
+            return Address( unit, component, 0U ).componentRange();
+        }
+
+        /* #endregion */// Public methods
+
+    private:
+
+        /* #region Private methods */
+
+        constexpr std::uint8_t field( std::uint8_t shift ) const noexcept
+        {
+            return static_cast<std::uint8_t>( key_ >> shift );
+        }
+
+        /** @brief Keeps the fields from `shift` upwards and spans all lower ones. */
+        constexpr Range rangeAbove( std::uint8_t shift ) const noexcept
+        {
+            Key const low_mask = ( Key{ 1U } << shift ) - 1U;
+            Key const first = key_ & ~low_mask;
+
+            return Range{ first, first + low_mask + 1U };
+        }
+
+        /* #endregion */// Private methods
+
+        /* #region Member variables */
+
+        Key key_; //!< Packed fields, see the class description.
+
+        /* #endregion */// Member variables
+
+    /* #endregion */// Instance members
+
+    }; // class Address
+
+} // namespace machine
@@ -0,0 +1,256 @@
+#pragma once
+
+/* C++ Standard Library */
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+/* Custom Library */
+#include <address.hpp>
+#include <property_table.hpp>
+
+/* ESP-IDF */
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <sdkconfig.h>
+
+namespace machine
+{
+
+    /** @brief Lock-free single-producer/single-consumer ring of value changes. */
+    /**
+     * @details
+     * Attaches to the change hook of a `PropertyTable`: whenever `set()`
+     * changes a tracked property, a fixed-size `Event` with its address,
+     * tick, size and payload is appended. An exporter task then consumes
+     * the events in order, without polling the whole table:
+     *
+     * \code{.cpp}
+     * ChangeRing ring( table );
+     * ring.trackAll();
+     * ring.setConsumer( xTaskGetCurrentTaskHandle() );
+     *
+     * // exporter task
+     * ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+     * while ( auto const event = ring.pop() ) { send( *event ); }
+     *
+     * std::array<std::size_t, 16U> missed;
+     * std::size_t n;
+     * while ( ( n = ring.takeMissed( missed ) ) > 0U )
+     * {
+     *     for ( std::size_t i : std::span( missed ).first( n ) ) { send( table.addressAt( i ), table.at( i ) ); }
+     * }
+     * \endcode
+     *
+     * @par Ring:
+     * `CAPACITY` events; the producer only writes `head_` and the consumer
+     * only `tail_`, so a push and a pop are one acquire load and one
+     * release store each. Nothing is locked other than the changed value
+     * while it is copied, and nothing is allocated after construction.
+     *
+     * @par Overflow:
+     * When the ring is full the event is dropped, counted, and the
+     * property gets a bit in a missed bitmap. `takeMissed()` returns those
+     * properties so that the consumer resends their current value from
+     * the table. Because a resend carries the newest value, the consumer
+     * ends on the right value whichever of event or resend comes last.
+     *
+     * @par Payload:
+     * Values of up to `PAYLOAD_SIZE` bytes travel in the event. For longer
+     * ones `Event::complete` is `false` and the payload holds their head;
+     * read the rest from the table at `Event::index`.
+     *
+     * @attention
+     * - Single producer: while a ring is attached, only one task may call
+     *   `PropertyTable::set()`, e.g. the apply stage of a pipeline.
+     * - Single consumer: `pop()` and `takeMissed()` must be called by one
+     *   task.
+     * - The table must outlive the ring.
+     *
+     * @note ja: 値の変更イベントを順序通りに渡すロックフリーのSPSCリング。溢れた分はビットマップで再同期する。
+     */
+    class ChangeRing
+    {
+    /* ^\__________________________________________ */
+    /* #region Static members, Inner types.         */
+
+    public:
+
+        /** @brief Events the ring holds. */
+        static constexpr std::size_t CAPACITY = CONFIG_MACHINE_CHANGE_RING_CAPACITY;
+
+        /** @brief Payload bytes carried in an event. */
+        static constexpr std::size_t PAYLOAD_SIZE = CONFIG_MACHINE_CHANGE_RING_PAYLOAD_SIZE;
+
+        static_assert( ( CAPACITY & ( CAPACITY - 1U ) ) == 0U, "CAPACITY must be a power of two" );
+
+        /** @brief One change of a value. */
+        struct Event
+        {
+            Address::Key key;                             //!< `Address::key()` of the property.
+            TickType_t tick;                              //!< When the change was recorded.
+            std::uint32_t index;                          //!< Index of the property in the table.
+            std::uint8_t size;                            //!< Size of the new value.
+            bool complete;                                //!< `payload` holds the whole value.
+            std::array<std::byte, PAYLOAD_SIZE> payload;  //!< The value, or its head if not `complete`.
+
+            /** @brief Returns the bytes of the value carried in the event. */
+            [[nodiscard]]
+            std::span<std::byte const> bytes() const noexcept
+            {
+                return std::span<std::byte const>( payload ).first( complete ? size : PAYLOAD_SIZE );
+            }
+        };
+
+        /** @brief Counters. */
+        struct Stats
+        {
+            std::uint32_t pushed;     //!< Events written to the ring.
+            std::uint32_t overflows;  //!< Events lost to a full ring; their properties are missed.
+            std::uint32_t truncated;  //!< Events whose value did not fit `PAYLOAD_SIZE`.
+        };
+
+    private:
+
+        /** @brief Word type of the tracked and missed bitmaps. */
+        using Word = std::uint32_t;
+
+        static constexpr std::size_t WORD_BITS = 32U;
+
+    /* #endregion */// Static members, Inner types
+
+    /* ^\__________________________________________ */
+    /* #region Constructors.                        */
+
+    public:
+
+        /**
+         * @details
+         * Attaches to `table`, replacing any other change hook. No property
+         * is tracked yet.
+         *
+         * @param table [in] The table; must outlive the ring.
+         */
+        explicit ChangeRing( PropertyTable &table ) noexcept;
+
+        ~ChangeRing() noexcept;                              //!< Destructor (detaches from the table).
+        ChangeRing( ChangeRing const & ) noexcept = delete;  //!< Copy constructor (deleted).
+        ChangeRing( ChangeRing && ) noexcept = delete;       //!< Move constructor (deleted).
+
+    /* #endregion */// Constructors
+
+    /* ^\__________________________________________ */
+    /* #region Operators.                           */
+
+    public:
+
+        ChangeRing &operator=( ChangeRing const & ) noexcept = delete; //!< Copy operator (deleted).
+        ChangeRing &operator=( ChangeRing && ) noexcept = delete;      //!< Move operator (deleted).
+
+    /* #endregion */// Operators
+
+    /* ^\__________________________________________ */
+    /* #region Instance members.                    */
+
+    public:
+
+        /* #region Public methods */
+
+        /** @brief Tracks or stops tracking one property. */
+        /**
+         * @param index   [in] The index in the table, less than its size.
+         * @param tracked [in] `true` to record its changes.
+         */
+        void track( std::size_t index, bool tracked = true ) noexcept;
+
+        /** @brief Tracks every property of the table. */
+        void trackAll() noexcept;
+
+        /** @brief Sets the task notified when an event arrives in an empty ring. */
+        /**
+         * @param task [in] The consumer task; `nullptr` to not notify.
+         */
+        void setConsumer( TaskHandle_t task ) noexcept;
+
+        /** @brief Records a change of a property, as the table's hook does. */
+        /**
+         * @details
+         * Producer side. Untracked properties are ignored.
+         *
+         * @param index [in] The index in the table, less than its size.
+         *
+         * @return `true` if an event was written; `false` if the property is
+         *         untracked or the ring is full.
+         */
+        bool push( std::size_t index ) noexcept;
+
+        /** @brief Takes the oldest event. */
+        /**
+         * @details
+         * Consumer side.
+         *
+         * @return The event; `std::nullopt` if the ring is empty.
+         */
+        [[nodiscard]]
+        std::optional<Event> pop() noexcept;
+
+        /** @brief Pulls and clears the properties whose events were lost. */
+        /**
+         * @details
+         * Consumer side; same contract as `PropertyTable::takeDirty()`.
+         * Resend the current value of each from the table.
+         *
+         * @param out [out] The indices of missed properties, ascending.
+         *
+         * @return The number of indices written; 0 if nothing was missed.
+         */
+        [[nodiscard]]
+        std::size_t takeMissed( std::span<std::size_t> out ) noexcept;
+
+        /** @brief Returns `true` if the property is tracked. */
+        [[nodiscard]]
+        bool isTracked( std::size_t index ) const noexcept;
+
+        /** @brief Returns the number of events waiting. */
+        [[nodiscard]]
+        std::size_t size() const noexcept;
+
+        /** @brief Returns a copy of all counters. */
+        [[nodiscard]]
+        Stats stats() const noexcept;
+
+        /* #endregion */// Public methods
+
+    private:
+
+        /* #region Private methods */
+
+        static void onChange( PropertyTable const &table, std::size_t index, void *context ) noexcept;
+
+        /* #endregion */// Private methods
+
+        /* #region Member variables */
+
+        PropertyTable &table_;
+        std::array<Event, CAPACITY> events_ {};
+        std::atomic<std::uint32_t> head_ { 0U };     //!< Next position to write; written by the producer only.
+        std::atomic<std::uint32_t> tail_ { 0U };     //!< Next position to read; written by the consumer only.
+        std::atomic<TaskHandle_t> consumer_ { nullptr };
+        std::vector<std::atomic<Word>> tracked_;     //!< One bit per property whose changes are recorded.
+        std::vector<std::atomic<Word>> missed_;      //!< One bit per property with a lost event.
+
+        std::atomic<std::uint32_t> pushed_ { 0U };
+        std::atomic<std::uint32_t> overflows_ { 0U };
+        std::atomic<std::uint32_t> truncated_ { 0U };
+
+        /* #endregion */// Member variables
+
+    /* #endregion */// Instance members
+
+    }; // class ChangeRing
+
+} // namespace machine
@@ -0,0 +1,178 @@
+#pragma once
+
+/* C++ Standard Library */
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <ostream>
+#include <string>
+
+/* Custom Library */
+#include <spec.hpp>
+#include <spec_pool.hpp>
+
+namespace machine
+{
+
+    /** @brief A `Property` whose spec lives in `SpecPool`. */
+    /**
+     * @details
+     * Has the same accessors as `Property`, but stores a 2-byte
+     * `SpecPool::Handle` instead of the 15-byte `Spec`:
+     *
+     * | Type              | code | spec | value | Total    |
+     * | ----------------- | ---- | ---- | ----- | -------- |
+     * | `Property`        | 1    | 15   | 6     | 22 bytes |
+     * | `CompactProperty` | 1    | 2    | 6     |  9 bytes |
+     *
+     * Properties with the same spec share one pool entry, so a large
+     * table of them uses far less RAM, and more of it stays in cache.
+     * `spec()` costs one extra indirection into the pool.
+     *
+     * @note ja: `Spec`を`SpecPool`のハンドルで参照する省メモリ版`Property`。
+     */
+    class CompactProperty
+    {
+    /* ^\__________________________________________ */
+    /* #region Static members, Inner types.         */
+
+    public:
+
+        /* #region Factory methods */
+
+        /** @brief Create a CompactProperty whose value is a copy of the initial value. */
+        /**
+         * @param code property code
+         * @param spec property specification; registered in `SpecPool`
+         *
+         * @return CompactProperty instance if the spec could be registered and
+         *         the initial value copied; std::nullopt otherwise.
+         */
+        static std::optional<CompactProperty> create( std::uint8_t code
+                                                    , property::Spec const &spec ) noexcept;
+
+        /** @brief Create a CompactProperty with the given value. */
+        /**
+         * @param code  property code
+         * @param spec  property specification; registered in `SpecPool`
+         * @param value current property value
+         *
+         * @return CompactProperty instance if the spec could be registered;
+         *         std::nullopt otherwise.
+         */
+        static std::optional<CompactProperty> create( std::uint8_t code
+                                                    , property::Spec const &spec
+                                                    , property::Value &&value ) noexcept;
+
+        /* #endregion */// Factory methods
+
+    private:
+
+        /** @brief Raw `SpecPool::Handle`, stored byte-wise to keep 1-byte alignment. */
+        using RawHandle = std::array<std::byte, sizeof( property::SpecPool::Handle )>;
+
+    /* #endregion */// Static members, Inner types
+
+    /* ^\__________________________________________ */
+    /* #region Constructors.                        */
+
+    public:
+
+        ~CompactProperty() noexcept;                                   //!< Destructor (releases the spec).
+        CompactProperty( CompactProperty const & ) noexcept = delete;  //!< Copy constructor (deleted).
+        CompactProperty( CompactProperty &&other ) noexcept;           //!< Move constructor.
+
+    private:
+
+        explicit CompactProperty( std::uint8_t code
+                                , property::SpecPool::Handle spec
+                                , property::Value &&value ) noexcept;
+
+    /* #endregion */// Constructors
+
+    /* ^\__________________________________________ */
+    /* #region Operators.                           */
+
+    public:
+
+        CompactProperty &operator=( CompactProperty const & ) noexcept = delete;              //!< Copy operator (deleted).
+        CompactProperty &operator=( CompactProperty && ) noexcept = delete;                   //!< Move operator (deleted).
+        bool constexpr operator==( CompactProperty const & ) const noexcept = delete;         //!< Equality operator (deleted).
+        auto constexpr operator<=>( CompactProperty const & ) const noexcept = delete;        //!< Three-way comparison operator (deleted).
+
+    /* #endregion */// Operators
+
+    /* ^\__________________________________________ */
+    /* #region Instance members.                    */
+
+    public:
+
+        /* #region Public methods */
+
+        /** @brief Returns a string representation of the `CompactProperty`. */
+        /**
+         * @details
+         * Same as `Property::str()`.
+         */
+        [[nodiscard]]
+        std::string str() const noexcept;
+
+        /** @copydoc Property::setValue() */
+        [[nodiscard]]
+        value::SetResult setValue( std::byte const *data, std::uint8_t size ) noexcept
+        {
+            return value_.setEx( data, size );
+        }
+
+        /* #endregion */// Public methods
+
+        /* #region Getter methods */
+
+        [[nodiscard]]
+        std::uint8_t const &code() const noexcept { return code_; }
+
+        [[nodiscard]]
+        property::Spec const &spec() const noexcept
+        {
+            return property::SpecPool::specOf( specHandle() );
+        }
+
+        [[nodiscard]]
+        property::SpecPool::Handle specHandle() const noexcept
+        {
+            return std::bit_cast<property::SpecPool::Handle>( spec_ );
+        }
+
+        [[nodiscard]]
+        property::Value const &value() const noexcept { return value_; }
+
+        /* #endregion */// Getter methods
+
+    private:
+
+        /* #region : member variables */
+
+        std::uint8_t code_;             //  1 byte
+        RawHandle spec_;                //  2 bytes
+        property::MutableValue value_;  //  6 bytes
+        // ---------------------------------
+        //                  Total:  9 bytes
+
+        /* #endregion */
+
+    }; // class CompactProperty
+
+    /** @brief Stream output operator for `CompactProperty`. */
+    /**
+     * @see CompactProperty::str() for the format of the output.
+     */
+    std::ostream &operator<<( std::ostream &os, CompactProperty const &v ) noexcept;
+
+    /* ^\__________________________________________ */
+    /* Static assertions.                           */
+    static_assert(  sizeof(CompactProperty) == 9U, "Unexpected CompactProperty size");
+    static_assert( alignof(CompactProperty) == 1U, "Unexpected CompactProperty alignment");
+
+} // namespace machine
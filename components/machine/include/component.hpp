@@ -0,0 +1,148 @@
+#pragma once
+
+/* C++ Standard Library */
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+
+namespace machine
+{
+
+    /** @brief A component of a machine unit, identified by its code and index. */
+    /**
+     * @details
+     * A component is a part of a `Unit`, e.g. the CPU, memory or clock
+     * generator of a board unit. It is the middle level of the `Address`
+     * hierarchy:
+     *
+     * - Machine
+     *   - `Unit[]` (unique: kind, index)
+     *     - `Component[]` (unique: code, index)
+     *       - `Property[]`  (unique: code)
+     *
+     * Both fields are packed into one 16-bit `key()`, code first, as in
+     * `Address::key()`; comparisons and `std::hash<Component>` use the key.
+     *
+     * Index `PRIMARY_INDEX` is the primary component of a code; indices
+     * above are secondary components.
+     *
+     * @note ja: コードとインデックスで識別するユニット内のコンポーネント。16ビットの1つのキーに詰める。
+     */
+    class Component
+    {
+    /* ^\__________________________________________ */
+    /* #region Static members, Inner types.         */
+
+    public:
+
+        /** @brief Packed key type. */
+        using Key = std::uint16_t;
+
+        /** @brief Index of the primary component of a code. */
+        static constexpr std::uint8_t PRIMARY_INDEX = 0U;
+
+        /** @brief Returns the component of a packed `key`, see `key()`. */
+        [[nodiscard]]
+        static constexpr Component fromKey( Key key ) noexcept
+        {
+            return Component( static_cast<std::uint8_t>( key >> CODE_SHIFT ), static_cast<std::uint8_t>( key ) );
+        }
+
+    private:
+
+        static constexpr std::uint8_t CODE_SHIFT = 8U;
+
+    /* #endregion */// Static members, Inner types
+
+    /* ^\__________________________________________ */
+    /* #region Constructors.                        */
+
+    public:
+
+        /** @brief Construct with given code and index. */
+        /**
+         * @param code  component code
+         * @param index component index; `PRIMARY_INDEX` is the primary component
+         */
+        explicit constexpr Component( std::uint8_t code, std::uint8_t index = PRIMARY_INDEX ) noexcept
+            : key_( static_cast<Key>( ( static_cast<Key>( code ) << CODE_SHIFT ) | index ) )
+        {}
+
+    /* #endregion */// Constructors
+
+    /* ^\__________________________________________ */
+    /* #region Operators.                           */
+
+    public:
+
+        constexpr bool operator==( Component const & ) const noexcept = default;  //!< Equality operator (default).
+        constexpr auto operator<=>( Component const & ) const noexcept = default; //!< Three-way comparison operator (default).
+
+    /* #endregion */// Operators
+
+    /* ^\__________________________________________ */
+    /* #region Instance members.                    */
+
+    public:
+
+        /* #region Getter methods */
+
+        [[nodiscard]]
+        constexpr Key key() const noexcept { return key_; }
+
+        [[nodiscard]]
+        constexpr std::uint8_t code() const noexcept { return static_cast<std::uint8_t>( key_ >> CODE_SHIFT ); }
+
+        [[nodiscard]]
+        constexpr std::uint8_t index() const noexcept { return static_cast<std::uint8_t>( key_ ); }
+
+        /** @brief Returns `true` if this is the primary component of its code. */
+        [[nodiscard]]
+        constexpr bool isPrimary() const noexcept { return index() == PRIMARY_INDEX; }
+
+        /* #endregion */// Getter methods
+
+    private:
+
+        /* #region Member variables */
+
+        Key key_; //!< Code in the upper, index in the lower byte.
+
+        /* #endregion */// Member variables
+
+    /* #endregion */// Instance members
+
+    }; // class Component
+
+    static_assert( sizeof( Component ) == sizeof( Component::Key ), "Component must be as small as its key" );
+
+    /** @brief Stream output operator for `Component`. */
+    /**
+     * @see std::formatter<machine::Component> for formatting details.
+     *
+     * @param os [out] The output stream to write to.
+     * @param v  [in]  The `Component` value to output.
+     *
+     * @return Reference to the output stream after writing.
+     */
+    std::ostream &operator<<( std::ostream &os, Component const &v ) noexcept;
+
+} // namespace machine
+
+
+namespace std // Hash specialization
+{
+
+    /** @brief Hash specialization for `machine::Component`, over its `key()`. */
+    template <>
+    struct hash<machine::Component>
+    {
+        std::size_t operator()( machine::Component const &v ) const noexcept
+        {
+            return std::hash<machine::Component::Key> {}( v.key() );
+        }
+    };
+
+} // namespace std
@@ -0,0 +1,51 @@
+#pragma once
+
+/* Self */
+#include <component.hpp>
+
+/* C++ Standard Library */
+#include <format>
+
+namespace std // Formatter specialization
+{
+
+    /** @brief Formatter specialization for `machine::Component`. */
+    /**
+     * @details
+     * Formats a `machine::Component` instance. For example:
+     *
+     * `{ code: 0x01, index: 0 }`
+     */
+    template <>
+    struct formatter<machine::Component>
+    {
+        using Component = machine::Component;
+
+        /** @brief Parse format specifiers (none supported). */
+        /**
+         * @param ctx [in,out] The format parse context.
+         *
+         * @return Iterator pointing to the next character to be parsed
+         *         (no specifiers are consumed).
+         */
+        constexpr auto parse( std::format_parse_context &ctx ) const noexcept
+            -> const char *
+        {
+            return ctx.begin();
+        }
+
+        /** @brief Format `Component` value. */
+        /**
+         * @param v   [in]     The `Component` value to format.
+         * @param ctx [in,out] The format context.
+         *
+         * @return Iterator to the end of the formatted output.
+         */
+        template <typename FormatContext>
+        auto format( Component const &v, FormatContext &ctx ) const noexcept
+        {
+            return std::format_to( ctx.out(), "{{ code: 0x{:02X}, index: {} }}", v.code(), v.index() );
+        }
+    };
+
+} // namespace std
@@ -0,0 +1,279 @@
+#pragma once
+
+/* C++ Standard Library */
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+
+/* Custom Library */
+#include <property.hpp>
+#include <spec.hpp>
+#include <value.hpp>
+
+/* ESP-IDF */
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <sdkconfig.h>
+
+namespace machine
+{
+
+    /** @brief Deferred binary log of `Spec`, `Property` and `Value` diagnostics. */
+    /**
+     * @details
+     * Formatting `Spec::str()` on the device costs far more CPU time and
+     * console bandwidth than the few bytes it describes. `log()` instead
+     * copies the raw items into a fixed-size record of a lock-free ring,
+     * and a low-priority task passes the records to `Config::sink`, e.g.
+     * the console as hex. `decode()`, built on the host, turns a record
+     * back into exactly the text of `Spec::str()`, `Value255::str()` or
+     * the `Property` formatter:
+     *
+     * \code{.cpp}
+     * // device
+     * diagLog.log( TAG_ID, spec );
+     *
+     * // host
+     * auto const d = machine::DiagLog::decode( record );
+     * std::puts( d->text.c_str() );
+     * \endcode
+     *
+     * The text formatters stay available; use them where no decoder is at hand.
+     *
+     * @par Ring:
+     * `CAPACITY` cells of `RECORD_SIZE` bytes, each with a sequence number
+     * (bounded queue after D. Vyukov). Tasks reserve a cell with one
+     * compare-and-swap and publish it with one release store; no lock is
+     * taken other than those of the logged values, and nothing is allocated.
+     * When the ring is full, `log()` drops the record and returns `false`.
+     * The drain task wakes every `CONFIG_MACHINE_DIAG_LOG_DRAIN_PERIOD_MS`,
+     * or early when the ring is half full.
+     *
+     * @par Record:
+     * \code{.unparsed}
+     * size  field
+     * ----  -----------------------------------------------
+     *    1  magic: 0xDB
+     *    1  kind: 0x01 spec, 0x02 value, 0x03 property;
+     *         bit 7 set if a value did not fit the record
+     *    2  tag id, little endian
+     *    1  payload size n
+     *    n  payload
+     * \endcode
+     *
+     * Payloads, where `value` is its size (1 byte) then its bytes:
+     * - spec:     `Spec::Fragments` byte, initial, minimum and maximum `value`
+     * - value:    `value`
+     * - property: code, then the spec payload, then `value`
+     *
+     * A value that does not fit the record is cut, and every later value
+     * is empty.
+     *
+     * @attention
+     * `Spec::Fragments` is a bit-field, so the decoder must be built with
+     * the same compiler ABI as the firmware.
+     *
+     * @note ja: 文字列整形を後回しにするバイナリ診断ログ。ホスト側でテキストに復元する。
+     */
+    class DiagLog
+    {
+    /* ^\__________________________________________ */
+    /* #region Static members, Inner types.         */
+
+    public:
+
+        /** @brief Bytes per record, header included. */
+        static constexpr std::size_t RECORD_SIZE = CONFIG_MACHINE_DIAG_LOG_RECORD_SIZE;
+
+        /** @brief Records the ring holds. */
+        static constexpr std::size_t CAPACITY = CONFIG_MACHINE_DIAG_LOG_CAPACITY;
+
+        /** @brief Size of the record header. */
+        static constexpr std::size_t HEADER_SIZE = 5U;
+
+        /** @brief First byte of every record. */
+        static constexpr std::byte MAGIC { 0xDB };
+
+        static_assert( ( CAPACITY & ( CAPACITY - 1U ) ) == 0U, "CAPACITY must be a power of two" );
+        static_assert( RECORD_SIZE - HEADER_SIZE <= UINT8_MAX, "The payload size must fit 1 byte" );
+        static_assert( RECORD_SIZE >= HEADER_SIZE + 6U, "A property record needs its code, fragments and 4 sizes" );
+
+        /** @brief What a record describes. */
+        enum class Kind : std::uint8_t
+        {
+            Spec     = 0x01, //!< A `property::Spec`.
+            Value    = 0x02, //!< A `property::Value`.
+            Property = 0x03, //!< A `Property`.
+        };
+
+        /** @brief Receives each record, on the drain task. */
+        using Sink = void ( * )( std::span<std::byte const> record, void *context ) noexcept;
+
+        /** @brief Where the records go. */
+        struct Config
+        {
+            Sink sink;      //!< Called once per record.
+            void *context;  //!< Passed to `sink`.
+        };
+
+        /** @brief Counters, written by any task. */
+        struct Stats
+        {
+            std::uint32_t logged;     //!< Records written to the ring.
+            std::uint32_t dropped;    //!< Records lost to a full ring.
+            std::uint32_t truncated;  //!< Records with a value cut.
+        };
+
+        /** @brief A decoded record. */
+        struct Decoded
+        {
+            Kind kind;          //!< What the record describes.
+            std::uint16_t tag;  //!< Tag id passed to `log()`.
+            bool truncated;     //!< A value did not fit the record.
+            std::string text;   //!< Same text as the formatter of `kind`.
+        };
+
+    private:
+
+        /** @brief One record and its sequence number. */
+        struct Cell
+        {
+            std::atomic<std::uint32_t> sequence { 0U };  //!< `position` when free, `position + 1` when written.
+            std::uint16_t size = 0U;                     //!< Record bytes.
+            std::array<std::byte, RECORD_SIZE> bytes {};
+        };
+
+        class Writer;
+
+    /* #endregion */// Static members, Inner types
+
+    /* ^\__________________________________________ */
+    /* #region Constructors.                        */
+
+    public:
+
+        explicit DiagLog( Config const &config ) noexcept;
+        ~DiagLog() noexcept;                           //!< Destructor (stops the drain task).
+        DiagLog( DiagLog const & ) noexcept = delete;  //!< Copy constructor (deleted).
+        DiagLog( DiagLog && ) noexcept = delete;       //!< Move constructor (deleted).
+
+    /* #endregion */// Constructors
+
+    /* ^\__________________________________________ */
+    /* #region Operators.                           */
+
+    public:
+
+        DiagLog &operator=( DiagLog const & ) noexcept = delete; //!< Copy operator (deleted).
+        DiagLog &operator=( DiagLog && ) noexcept = delete;      //!< Move operator (deleted).
+
+    /* #endregion */// Operators
+
+    /* ^\__________________________________________ */
+    /* #region Instance members.                    */
+
+    public:
+
+        /* #region Public methods */
+
+        /** @brief Starts the drain task. */
+        /**
+         * @return `true` if the task was created; `false` otherwise.
+         */
+        [[nodiscard]]
+        bool start() noexcept;
+
+        /** @brief Logs a spec. */
+        /**
+         * @param tag  [in] Identifies the log site, e.g. per `ESP_LOG` tag.
+         * @param spec [in] The spec; its values are locked one at a time.
+         *
+         * @return `true` if the record was written; `false` if the ring is full.
+         */
+        bool log( std::uint16_t tag, property::Spec const &spec ) noexcept;
+
+        /** @brief Logs a value. */
+        /**
+         * @param tag   [in] Identifies the log site.
+         * @param value [in] The value; locked while it is copied.
+         *
+         * @return `true` if the record was written; `false` if the ring is full.
+         */
+        bool log( std::uint16_t tag, property::Value const &value ) noexcept;
+
+        /** @brief Logs a property with its spec and value. */
+        /**
+         * @param tag      [in] Identifies the log site.
+         * @param property [in] The property.
+         *
+         * @return `true` if the record was written; `false` if the ring is full.
+         */
+        bool log( std::uint16_t tag, Property const &property ) noexcept;
+
+        /** @brief Passes every written record to the sink, oldest first. */
+        /**
+         * @attention
+         * Called by the drain task; call it directly only if `start()` was not.
+         */
+        void drain() noexcept;
+
+        /** @brief Returns a copy of all counters. */
+        [[nodiscard]]
+        Stats stats() const noexcept;
+
+        /** @brief Rebuilds the text of a record. */
+        /**
+         * @param record [in] One record as passed to the sink.
+         *
+         * @return The decoded record; `std::nullopt` if it is malformed.
+         */
+        [[nodiscard]]
+        static std::optional<Decoded> decode( std::span<std::byte const> record ) noexcept;
+
+        /* #endregion */// Public methods
+
+    private:
+
+        /* #region Private methods */
+
+        static void entry( void *context ) noexcept;
+
+        [[nodiscard]]
+        Cell *reserve( std::uint32_t &position ) noexcept;
+
+        void commit( Cell &cell, std::uint32_t position, bool truncated ) noexcept;
+
+        [[nodiscard]]
+        static std::byte fragmentsOf( property::Spec const &spec ) noexcept;
+
+        [[nodiscard]]
+        static std::string specText( std::byte fragments
+                                   , std::span<std::byte const> init
+                                   , std::span<std::byte const> min
+                                   , std::span<std::byte const> max ) noexcept;
+
+        /* #endregion */// Private methods
+
+        /* #region Member variables */
+
+        Config config_;
+        std::array<Cell, CAPACITY> cells_;
+        std::atomic<std::uint32_t> head_ { 0U };  //!< Next position to reserve.
+        std::atomic<std::uint32_t> tail_ { 0U };  //!< Next position to drain; written by the drainer only.
+        TaskHandle_t task_ = nullptr;
+
+        std::atomic<std::uint32_t> logged_ { 0U };
+        std::atomic<std::uint32_t> dropped_ { 0U };
+        std::atomic<std::uint32_t> truncated_ { 0U };
+
+        /* #endregion */// Member variables
+
+    /* #endregion */// Instance members
+
+    }; // class DiagLog
+
+} // namespace machine
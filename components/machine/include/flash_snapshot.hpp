@@ -0,0 +1,306 @@
+#pragma once
+
+/* C++ Standard Library */
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+/* Custom Library */
+#include <property_table.hpp>
+
+/* ESP-IDF */
+#include <esp_partition.h>
+#include <freertos/FreeRTOS.h>
+
+namespace machine
+{
+
+    /** @brief Flash copy of all values of a `PropertyTable`, for a fast warm boot. */
+    /**
+     * @details
+     * After a reboot every property starts at its initial value until it is
+     * polled from the machine again, which takes long on large machines.
+     * `FlashSnapshot` writes the values to a data partition and, on the next
+     * boot, serves them straight from an `esp_partition_mmap()` view until a
+     * fresh value arrives:
+     *
+     * \code{.cpp}
+     * FlashSnapshot flash( table, FlashSnapshot::Config{ "propsnap", pdMS_TO_TICKS( 60000 ), true } );
+     * flash.open();
+     *
+     * // any reader
+     * auto const cached = flash.cached( i );
+     * send( table.addressAt( i ), cached ? *cached : table.at( i ).value().view().span() );
+     *
+     * // publish task, with the indices of changed properties
+     * flash.refreshed( changed );
+     * flash.save();
+     * \endcode
+     *
+     * @par Wear:
+     * `refreshed()` only counts the changes, and `save()` writes a new image
+     * at most once per `Config::minInterval`, and only if something changed
+     * since the last one. Images are appended one after another, each at a
+     * sector boundary, and the partition is reused from its start when the
+     * next image does not fit, so all sectors are erased equally often.
+     *
+     * @par Image:
+     * \code{.unparsed}
+     * offset  size  field
+     * ------  ----  -------------------------------------------------
+     *      0     4  magic: "PSNP"
+     *      4     2  version: 1
+     *      6     2  flags: bit 0 set if the index holds spec hashes
+     *      8     4  generation, increasing with every image
+     *     12     4  property count n
+     *     16     4  layout: `util::hashBytes()` of all addresses
+     *     20     4  image size, header included
+     *     24     4  CRC-32 of the index
+     *     28     4  CRC-32 of the values
+     *     32     4  CRC-32 of bytes 0 to 31
+     *     36  n *4  index: value offset from the image start;
+     *      or n *8    followed by a hash of the spec if flag bit 0 is set
+     *      …     …  values in index order, each its size (1 byte) then its bytes
+     * \endcode
+     *
+     * All fields are little endian. The header is written last, so an image
+     * cut by a reset is never taken. `open()` takes the image of the highest
+     * generation whose CRCs match; an image of another table layout is
+     * ignored, and with spec hashes also each value whose spec changed.
+     *
+     * @attention
+     * - The partition must hold at least two images; a new image never
+     *   overwrites the one that is served.
+     * - A span returned by `cached()` stays valid until the next `save()`.
+     *
+     * @note ja: プロパティ値をフラッシュに保存し、再起動後はmmap経由でそのまま返すスナップショット。
+     */
+    class FlashSnapshot
+    {
+    /* ^\__________________________________________ */
+    /* #region Static members, Inner types.         */
+
+    public:
+
+        /** @brief Image format version. */
+        static constexpr std::uint16_t VERSION = 1U;
+
+        /** @brief Size of the image header. */
+        static constexpr std::size_t HEADER_SIZE = 36U;
+
+        /** @brief Settings of a snapshot. */
+        struct Config
+        {
+            char const *label;        //!< Label of the data partition.
+            TickType_t minInterval;   //!< Least time between two images written by `save()`.
+            bool withSpecs;           //!< Store a hash of the spec per property, see the class description.
+        };
+
+    private:
+
+        /** @brief The fixed fields of an image. */
+        struct Header
+        {
+            std::uint32_t magic;
+            std::uint16_t version;
+            std::uint16_t flags;
+            std::uint32_t generation;
+            std::uint32_t count;
+            std::uint32_t layout;
+            std::uint32_t size;
+            std::uint32_t indexCrc;
+            std::uint32_t valuesCrc;
+            std::uint32_t headerCrc;
+        };
+
+        static_assert( sizeof( Header ) == HEADER_SIZE, "The header must not be padded" );
+
+        class Stream;
+
+        /** @brief Word type of the stale bitmap. */
+        using StaleWord = std::uint32_t;
+
+        static constexpr std::size_t STALE_WORD_BITS = 32U;
+
+    /* #endregion */// Static members, Inner types
+
+    /* ^\__________________________________________ */
+    /* #region Constructors.                        */
+
+    public:
+
+        /**
+         * @param table  [in] The table; must outlive the snapshot.
+         * @param config [in] Settings.
+         */
+        explicit FlashSnapshot( PropertyTable const &table, Config const &config ) noexcept;
+
+        ~FlashSnapshot() noexcept;                                //!< Destructor (unmaps the partition).
+        FlashSnapshot( FlashSnapshot const & ) noexcept = delete; //!< Copy constructor (deleted).
+        FlashSnapshot( FlashSnapshot && ) noexcept = delete;      //!< Move constructor (deleted).
+
+    /* #endregion */// Constructors
+
+    /* ^\__________________________________________ */
+    /* #region Operators.                           */
+
+    public:
+
+        FlashSnapshot &operator=( FlashSnapshot const & ) noexcept = delete; //!< Copy operator (deleted).
+        FlashSnapshot &operator=( FlashSnapshot && ) noexcept = delete;      //!< Move operator (deleted).
+
+    /* #endregion */// Operators
+
+    /* ^\__________________________________________ */
+    /* #region Instance members.                    */
+
+    public:
+
+        /* #region Public methods */
+
+        /** @brief Maps the partition and takes its newest image. */
+        /**
+         * @details
+         * Every property of the image becomes stale, i.e. served by `cached()`
+         * until `refreshed()`. Call once, before any other method.
+         *
+         * @return `true` if the partition was mapped, with or without an
+         *         image; `false` if there is no such partition.
+         */
+        [[nodiscard]]
+        bool open() noexcept;
+
+        /** @brief Returns the value of a property from flash, while no fresh value arrived. */
+        /**
+         * @details
+         * Lock-free and safe from any task.
+         *
+         * @param index [in] The index in the table, less than its size.
+         *
+         * @return The stored value; `std::nullopt` if the property was
+         *         refreshed since boot or is not in the image.
+         */
+        [[nodiscard]]
+        std::optional<std::span<std::byte const>> cached( std::size_t index ) const noexcept;
+
+        /** @brief Records fresh values; `cached()` no longer serves them. */
+        /**
+         * @param changed [in] Indices of the properties changed since the
+         *                     last call, e.g. from `PropertyTable::takeDirty()`.
+         */
+        void refreshed( std::span<std::size_t const> changed ) noexcept;
+
+        /** @brief Writes a new image if values changed and `Config::minInterval` passed. */
+        /**
+         * @details
+         * Must only be called by one task at a time. Stale properties are
+         * written with their stored value, the others with their current one.
+         * A failed write is retried once, sized anew, in a free region that
+         * does not overlap the served image; if that fails too, the changes
+         * stay pending for the next call.
+         *
+         * @return `true` if an image was written; `false` otherwise.
+         */
+        bool save() noexcept;
+
+        /** @brief Writes a new image if values changed, e.g. before a planned reset. */
+        /**
+         * @copydetails save()
+         */
+        bool saveNow() noexcept;
+
+        /** @brief Returns the number of properties still served from flash. */
+        [[nodiscard]]
+        std::size_t staleCount() const noexcept;
+
+        /* #endregion */// Public methods
+
+        /* #region Getter methods */
+
+        /** @brief Returns `true` if `open()` found an image. */
+        [[nodiscard]]
+        bool restored() const noexcept { return restored_; }
+
+        /** @brief Returns the generation of the current image; 0 if there is none. */
+        [[nodiscard]]
+        std::uint32_t generation() const noexcept { return generation_; }
+
+        /* #endregion */// Getter methods
+
+    private:
+
+        /* #region Private methods */
+
+        [[nodiscard]]
+        std::optional<Header> headerAt( std::uint32_t offset ) const noexcept;
+
+        [[nodiscard]]
+        bool isIntact( std::uint32_t offset, Header const &header ) const noexcept;
+
+        [[nodiscard]]
+        std::uint32_t layout() const noexcept;
+
+        [[nodiscard]]
+        std::uint32_t wordAt( std::uint32_t offset ) const noexcept;
+
+        [[nodiscard]]
+        std::span<std::byte const> storedValue( std::uint32_t image, std::size_t index ) const noexcept;
+
+        [[nodiscard]]
+        bool isStale( std::size_t index ) const noexcept;
+
+        /** @brief Returns the size of an image of the current values. */
+        [[nodiscard]]
+        std::size_t imageSize() const noexcept;
+
+        /** @brief Returns where an image of `size` bytes fits without touching the served one. */
+        /**
+         * @param size      [in] Image size in bytes.
+         * @param preferred [in] Tried first; then the start of the partition,
+         *                       then the end of the served image.
+         *
+         * @return The offset; `std::nullopt` if no free region is large enough.
+         */
+        [[nodiscard]]
+        std::optional<std::uint32_t> placeFor( std::size_t size, std::uint32_t preferred ) const noexcept;
+
+        [[nodiscard]]
+        bool write( std::uint32_t at ) noexcept;
+
+        [[nodiscard]]
+        bool prepare( std::uint32_t end ) noexcept;
+
+        [[nodiscard]]
+        std::uint32_t alignUp( std::uint32_t offset ) const noexcept;
+
+        /* #endregion */// Private methods
+
+        /* #region Member variables */
+
+        PropertyTable const &table_;
+        Config config_;
+        esp_partition_t const *partition_ = nullptr;
+        esp_partition_mmap_handle_t mapping_ {};
+        std::span<std::byte const> map_;                 //!< The whole partition; empty until `open()`.
+
+        std::atomic<std::uint32_t> image_ { 0U };        //!< Offset of the served image.
+        std::uint32_t imageEnd_ = 0U;                    //!< End of the served image, at a sector boundary.
+        std::uint32_t generation_ = 0U;                  //!< Generation of the served image.
+        bool restored_ = false;                          //!< `open()` found an image.
+
+        std::uint32_t next_ = 0U;                        //!< Where the next image goes.
+        std::uint32_t erased_ = 0U;                      //!< End of the sectors erased for the image being written.
+        TickType_t lastSave_ = 0U;                       //!< Tick of the last image, or of `open()`.
+        std::atomic<std::uint32_t> pending_ { 0U };      //!< Changes since the last image.
+        std::vector<std::atomic<StaleWord>> stale_;      //!< One bit per property served by `cached()`.
+
+        /* #endregion */// Member variables
+
+    /* #endregion */// Instance members
+
+    }; // class FlashSnapshot
+
+} // namespace machine
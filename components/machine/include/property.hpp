@@ -1,7 +1,9 @@
 #pragma once
 
 /* C++ Standard Library */
+#include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <ostream>
 #include <string>
 
@@ -10,8 +12,60 @@
 
 namespace machine
 {
+    class PropertyTable;
+
     class Property
     {
+    /* ^\__________________________________________ */
+    /* #region Static members, Inner types.         */
+
+    public:
+
+        /* #region Factory methods */
+
+        /** @brief Create a Property whose value is a copy of the initial value. */
+        /**
+         * @param code property code
+         * @param spec property specification
+         *
+         * @return Property instance if the initial value could be copied;
+         *         std::nullopt otherwise.
+         */
+        static std::optional<Property> create( std::uint8_t code
+                                             , property::Spec &&spec ) noexcept;
+
+        /** @brief Create a Property with the given value. */
+        /**
+         * @param code  property code
+         * @param spec  property specification
+         * @param value current property value
+         *
+         * @return Property instance; never std::nullopt.
+         */
+        static std::optional<Property> create( std::uint8_t code
+                                             , property::Spec &&spec
+                                             , property::Value &&value ) noexcept;
+
+        /* #endregion */// Factory methods
+
+    /* #endregion */// Static members, Inner types
+
+    /* ^\__________________________________________ */
+    /* #region Constructors.                        */
+
+    public:
+
+        ~Property() noexcept = default;                 //!< Destructor (default).
+        Property( Property const & ) noexcept = delete; //!< Copy constructor (deleted).
+        Property( Property && ) noexcept = default;     //!< Move constructor (default).
+
+    private:
+
+        explicit Property( std::uint8_t code
+                         , property::Spec &&spec
+                         , property::Value &&value ) noexcept;
+
+    /* #endregion */// Constructors
 
     /* ^\__________________________________________ */
     /* #region Operators.                           */
@@ -45,11 +99,33 @@ namespace machine
          *   maximum_value: [ 0x00 0x04 ] }, value: [ 0xE7 0x03 ] }
          * \endcode
          *
+         * @note This allocates the returned string. To format into a caller
+         *       buffer instead, use `util::formatTo()` with `property_format.hpp`.
+         *
          * @return String representation of the `Property`.
          */
         [[nodiscard]]
         std::string str() const noexcept;
 
+        /** @brief Replaces the current value. */
+        /**
+         * @details
+         * Thin wrapper of `MutableValue::setEx()`; the value is not checked
+         * against the `Spec`. Use `PropertyTable::set()` to also record the
+         * change.
+         *
+         * @param data [in] Pointer to the new raw data.
+         *                  A null pointer is only valid if size is 0.
+         * @param size [in] Size of the new data in bytes.
+         *
+         * @return `Success` if the value changed, `NoChange` if it was equal.
+         */
+        [[nodiscard]]
+        value::SetResult setValue( std::byte const *data, std::uint8_t size ) noexcept
+        {
+            return value_.setEx( data, size );
+        }
+
         /* #endregion */// Public methods
 
         /* #region Getter methods */
@@ -67,13 +143,15 @@ namespace machine
 
     private:
 
+        friend class PropertyTable; // Note: Takes the fields apart into columns, see `CONFIG_MACHINE_PROPERTY_TABLE_SOA`.
+
         /* #region : member variables */
 
-        std::uint8_t code_;     //  1 byte
-        property::Spec spec_;   // 19 bytes
-        property::Value value_; //  6 bytes
+        std::uint8_t code_;             //  1 byte
+        property::Spec spec_;           // 15 bytes
+        property::MutableValue value_;  //  6 bytes
         // ---------------------------------
-        //                  Total: 26 bytes
+        //                  Total: 22 bytes
 
         /* #endregion */
 
@@ -96,7 +174,7 @@ namespace machine
 
     /* ^\__________________________________________ */
     /* Static assertions.                           */
-    static_assert(  sizeof(Property) == 26U, "Unexpected Property size");
+    static_assert(  sizeof(Property) == 22U, "Unexpected Property size");
     static_assert( alignof(Property) == 1U,  "Unexpected Property alignment");
 
 } // namespace machine
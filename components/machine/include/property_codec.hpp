@@ -0,0 +1,246 @@
+#pragma once
+
+/* C++ Standard Library */
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+/* Custom Library */
+#include <property.hpp>
+#include <spec.hpp>
+
+namespace machine
+{
+
+    /** @brief Compact binary wire format of a `Property`. */
+    /**
+     * @details
+     * One frame carries the code, the `Spec` and the current value of a
+     * property. All fields are bytes, so the frame has no alignment or
+     * endianness requirements beyond those of the payloads themselves,
+     * which are little-endian as everywhere else.
+     *
+     * \code{.unparsed}
+     * offset  size  field
+     * ------  ----  -----------------------------------------------
+     *      0     1  property code
+     *      1     1  fragments: format (bit 1-0), permission (bit 3-2),
+     *                          resolution (bit 6-4), value present (bit 7)
+     *      2     1  initial value size
+     *      3     1  minimum value size (0 to 4)
+     *      4     1  maximum value size (0 to 4)
+     *      5     1  value size (0 without the value present bit)
+     *      6     n  initial, minimum, maximum and value payloads, in order
+     * \endcode
+     *
+     * The header alone determines the frame size, so a receiver knows how
+     * many bytes to wait for after six bytes.
+     *
+     * A spec-only frame clears the value present bit. The bit is set for
+     * every current value, an empty one included, so an empty `String`
+     * is not mistaken for a spec-only frame.
+     *
+     * Parsing never copies a payload: `Frame` holds spans into the buffer
+     * it was parsed from, e.g. a DMA or ring buffer, and can be checked
+     * with `Spec::isWithinRange( std::span<std::byte const> )` before
+     * anything is stored. `Decoder` adds resumption across partial frames.
+     *
+     * @note ja: `Property`をUART/SPIで送受信するためのバイナリ形式。
+     */
+    class PropertyCodec
+    {
+    public:
+        explicit PropertyCodec() noexcept = delete; //!< @brief Default constructor (deleted).
+
+    /* ^\__________________________________________ */
+    /* #region Static members, Inner types.         */
+
+    public:
+
+        /** @brief Size of the fixed frame header in bytes. */
+        static constexpr std::size_t HEADER_SIZE = 6U;
+
+        /** @brief Largest possible frame in bytes. */
+        static constexpr std::size_t MAX_FRAME_SIZE = HEADER_SIZE
+                                                    + UINT8_MAX
+                                                    + property::detail::MAX_NUMERIC_SIZE
+                                                    + property::detail::MAX_NUMERIC_SIZE
+                                                    + UINT8_MAX;
+
+        /** @brief A parsed frame, viewing the buffer it was parsed from. */
+        /**
+         * @attention
+         * The spans are only valid while the underlying buffer is.
+         */
+        struct Frame
+        {
+            std::uint8_t code;                     //!< Property code.
+            property::Format::Kind format;         //!< Value format.
+            property::Permission::Kind permission; //!< Value access permission.
+            property::Resolution::Kind resolution; //!< Value resolution.
+            std::span<std::byte const> initVal;    //!< Initial value payload.
+            std::span<std::byte const> minVal;     //!< Minimum value payload.
+            std::span<std::byte const> maxVal;     //!< Maximum value payload.
+            std::span<std::byte const> value;      //!< Current value payload; empty for a spec-only frame.
+            bool hasValue;                         //!< `false` for a spec-only frame, see `value`.
+
+            /** @brief Returns the size of the encoded frame. */
+            [[nodiscard]]
+            std::size_t size() const noexcept
+            {
+                return HEADER_SIZE + initVal.size() + minVal.size() + maxVal.size() + value.size();
+            }
+        };
+
+        /** @brief Resumable frame parser. */
+        /**
+         * @details
+         * Feed it whatever the transport delivered. A frame that lies
+         * entirely within one input is returned as a view into that input.
+         * Only a frame split across inputs is assembled in the decoder's own
+         * buffer of `MAX_FRAME_SIZE` bytes; no heap is used either way.
+         *
+         * @par Example:
+         * \code{.cpp}
+         * while ( !input.empty() )
+         * {
+         *     auto const r = decoder.feed( input );
+         *     input = input.subspan( r.consumed );
+         *
+         *     if ( r.status == PropertyCodec::Decoder::Status::Frame )
+         *     {
+         *         handle( r.frame );
+         *     }
+         * }
+         * \endcode
+         */
+        class Decoder
+        {
+        public:
+
+            /** @brief Outcome of `feed()`. */
+            enum class Status : std::uint8_t
+            {
+                NeedMore, //!< All input consumed; the frame is not complete yet.
+                Frame,    //!< `Result::frame` holds a complete frame.
+                Error,    //!< Malformed data was skipped, see `feed()`.
+            };
+
+            /** @brief Result of `feed()`. */
+            struct Result
+            {
+                Status status;         //!< Outcome.
+                std::size_t consumed;  //!< Bytes of the input used.
+                Frame frame;           //!< Valid if `status` is `Frame`.
+            };
+
+            /** @brief Consumes input until one frame is complete. */
+            /**
+             * @details
+             * On `Error`, the malformed data is dropped and the decoder
+             * starts over, so it resynchronizes on a corrupted stream:
+             *
+             * - A malformed header loses its first byte only; the rest of
+             *   the input is scanned again.
+             * - A frame whose format does not match its range is skipped
+             *   entirely if it was split, and by one byte otherwise.
+             *
+             * Keep feeding the remaining input as usual.
+             *
+             * @param input [in] Newly received bytes.
+             *
+             * @return The outcome. A returned `frame` views either `input`
+             *         or the decoder, and is valid until the next call.
+             */
+            [[nodiscard]]
+            Result feed( std::span<std::byte const> input ) noexcept;
+
+            /** @brief Discards a partially received frame. */
+            void reset() noexcept { pendingSize_ = 0U; }
+
+            /** @brief Returns the number of buffered bytes of a partial frame. */
+            [[nodiscard]]
+            std::size_t pending() const noexcept { return pendingSize_; }
+
+        private:
+
+            std::array<std::byte, MAX_FRAME_SIZE> pending_ {}; //!< Partial frame.
+            std::uint16_t pendingSize_ = 0U;                   //!< Bytes in `pending_`.
+        };
+
+        /* #region Public methods */
+
+        /** @brief Returns the encoded size of a property. */
+        [[nodiscard]]
+        static std::size_t sizeOf( Property const &property ) noexcept;
+
+        /** @brief Encodes a property into a caller-supplied buffer. */
+        /**
+         * @details
+         * Each value is locked once while it is copied.
+         *
+         * @param property [in]  The property to encode.
+         * @param out      [out] The buffer to write to.
+         *
+         * @return The number of bytes written; 0 if `out` is too small.
+         */
+        [[nodiscard]]
+        static std::size_t encode( Property const &property, std::span<std::byte> out ) noexcept;
+
+        /** @brief Encodes a spec-only frame into a caller-supplied buffer. */
+        /**
+         * @param code [in]  The property code.
+         * @param spec [in]  The spec to encode.
+         * @param out  [out] The buffer to write to.
+         *
+         * @return The number of bytes written; 0 if `out` is too small.
+         */
+        [[nodiscard]]
+        static std::size_t encode( std::uint8_t code
+                                 , property::Spec const &spec
+                                 , std::span<std::byte> out ) noexcept;
+
+        /** @brief Returns the frame size announced by a header. */
+        /**
+         * @param header [in] At least `HEADER_SIZE` bytes.
+         *
+         * @return The frame size; std::nullopt if the header is too short or malformed.
+         */
+        [[nodiscard]]
+        static std::optional<std::size_t> frameSizeOf( std::span<std::byte const> header ) noexcept;
+
+        /** @brief Parses one frame at the start of a buffer without copying. */
+        /**
+         * @details
+         * Besides the header checks, the format must match the one derived
+         * from the minimum and maximum values, as in `Spec::create()`.
+         *
+         * @param input [in] The buffer to parse.
+         *
+         * @return The frame viewing `input`; std::nullopt if `input` is
+         *         incomplete or malformed.
+         */
+        [[nodiscard]]
+        static std::optional<Frame> parse( std::span<std::byte const> input ) noexcept;
+
+        /** @brief Creates a `Spec` from a parsed frame. */
+        [[nodiscard]]
+        static std::optional<property::Spec> toSpec( Frame const &frame ) noexcept;
+
+        /** @brief Creates a `Property` from a parsed frame. */
+        /**
+         * @details
+         * A spec-only frame starts at the initial value.
+         */
+        [[nodiscard]]
+        static std::optional<Property> toProperty( Frame const &frame ) noexcept;
+
+        /* #endregion */// Public methods
+
+    /* #endregion */// Static members, Inner types
+
+    }; // class PropertyCodec
+
+} // namespace machine
@@ -0,0 +1,38 @@
+#pragma once
+
+/* Custom Library */
+#include <address.hpp>
+#include <static_spec.hpp>
+
+namespace machine
+{
+
+    /** @brief Compile-time descriptor of a property in a machine catalog. */
+    /**
+     * @details
+     * A literal type, so a whole catalog can be defined as a `constexpr`
+     * array that is placed in flash `.rodata`:
+     *
+     * \code{.cpp}
+     * using namespace machine::property;
+     *
+     * constexpr std::array CATALOG =
+     * {
+     *     machine::PropertyDescriptor{ machine::Address( 0, 0, 1, 0, 1 )
+     *         , StaticSpec::boolean( Permission::Kind::ReadWrite, false ) },
+     *     machine::PropertyDescriptor{ machine::Address( 0, 0, 1, 0, 2 )
+     *         , StaticSpec::string( Permission::Kind::ReadOnly, "v1.0.0" ) },
+     * };
+     * \endcode
+     *
+     * The property code is `address.propertyCode()`.
+     *
+     * @see PropertyTable::Builder::add( std::span<PropertyDescriptor const> )
+     */
+    struct PropertyDescriptor
+    {
+        Address address;            //!< Address of the property.
+        property::StaticSpec spec;  //!< Specification of the property.
+    };
+
+} // namespace machine
@@ -0,0 +1,131 @@
+#pragma once
+
+/* Self */
+#include <compact_property.hpp>
+#include <property.hpp>
+#include <property_ref.hpp>
+
+/* C++ Standard Library */
+#include <format>
+
+/* Custom Library */
+#include <spec_format.hpp>
+#include <value255_format.hpp>
+
+namespace machine::detail
+{
+
+    /** @brief Format string of a `Property`, shared with decoders of binary log records. */
+    /**
+     * @details
+     * Arguments: code, spec and value.
+     */
+    inline constexpr char PROPERTY_FORMAT[] = "{{ code: 0x{:02X}, spec: {}, value: {} }}";
+
+} // namespace machine::detail
+
+
+namespace std // Formatter specialization
+{
+
+    /** @brief Formatter specialization for `machine::Property`. */
+    /**
+     * @details
+     * Formats a `machine::Property` instance. For example:
+     *
+     * `{ code: 0xA5, spec: { format: numeric(0), ... }, value: [ 0xE7 0x03 ] }`
+     *
+     * Every field is written by its own formatter directly to the output
+     * iterator; no intermediate `std::string` is built.
+     *
+     * @see machine::Property::str() for the format of the output.
+     */
+    template <>
+    struct formatter<machine::Property>
+    {
+        using Property = machine::Property;
+
+        /** @brief Parse format specifiers (none supported). */
+        /**
+         * @param ctx [in,out] The format parse context.
+         *
+         * @return Iterator pointing to the next character to be parsed
+         *         (no specifiers are consumed).
+         */
+        constexpr auto parse( std::format_parse_context &ctx ) const noexcept
+            -> const char *
+        {
+            return ctx.begin();
+        }
+
+        /** @brief Format `Property` value. */
+        /**
+         * @param v   [in]     The `Property` value to format.
+         * @param ctx [in,out] The format context.
+         *
+         * @return Iterator to the end of the formatted output.
+         */
+        template <typename FormatContext>
+        auto format( Property const &v, FormatContext &ctx ) const noexcept
+        {
+            return std::format_to( ctx.out()
+                , machine::detail::PROPERTY_FORMAT
+                , v.code(), v.spec(), v.value() );
+        }
+    };
+
+    /** @brief Formatter specialization for `machine::CompactProperty`. */
+    /**
+     * @details
+     * Same output as `formatter<machine::Property>`.
+     */
+    template <>
+    struct formatter<machine::CompactProperty>
+    {
+        using CompactProperty = machine::CompactProperty;
+
+        /** @brief Parse format specifiers (none supported). */
+        constexpr auto parse( std::format_parse_context &ctx ) const noexcept
+            -> const char *
+        {
+            return ctx.begin();
+        }
+
+        /** @brief Format `CompactProperty` value. */
+        template <typename FormatContext>
+        auto format( CompactProperty const &v, FormatContext &ctx ) const noexcept
+        {
+            return std::format_to( ctx.out()
+                , machine::detail::PROPERTY_FORMAT
+                , v.code(), v.spec(), v.value() );
+        }
+    };
+
+    /** @brief Formatter specialization for `machine::PropertyRef`. */
+    /**
+     * @details
+     * Same output as `formatter<machine::Property>`.
+     */
+    template <>
+    struct formatter<machine::PropertyRef>
+    {
+        using PropertyRef = machine::PropertyRef;
+
+        /** @brief Parse format specifiers (none supported). */
+        constexpr auto parse( std::format_parse_context &ctx ) const noexcept
+            -> const char *
+        {
+            return ctx.begin();
+        }
+
+        /** @brief Format `PropertyRef` value. */
+        template <typename FormatContext>
+        auto format( PropertyRef const &v, FormatContext &ctx ) const noexcept
+        {
+            return std::format_to( ctx.out()
+                , machine::detail::PROPERTY_FORMAT
+                , v.code(), v.spec(), v.value() );
+        }
+    };
+
+} // namespace std
@@ -0,0 +1,207 @@
+#pragma once
+
+/* C++ Standard Library */
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/* Custom Library */
+#include <address.hpp>
+#include <format.hpp>
+#include <permission.hpp>
+#include <property_table.hpp>
+#include <resolution.hpp>
+
+namespace machine
+{
+
+    /** @brief Secondary indexes of a `PropertyTable` by permission, format and resolution. */
+    /**
+     * @details
+     * Answers questions such as "all readable Numeric properties of units
+     * of kind 3" without reading the spec of every property:
+     *
+     * \code{.cpp}
+     * PropertyIndex const index( table );
+     *
+     * PropertyIndex::Filter const filter{ .permissions = PropertyIndex::READABLE
+     *                                   , .formats     = PropertyIndex::maskOf( Format::Kind::Numeric )
+     *                                   , .keys        = Address( 3U, 0U, 0U, 0U, 0U ).unitKindRange() };
+     *
+     * std::array<std::size_t, 32U> found;
+     * std::size_t from = 0U;
+     * std::size_t n;
+     * while ( ( n = index.select( filter, found, from ) ) > 0U )
+     * {
+     *     for ( std::size_t i : std::span( found ).first( n ) ) { plan.poll( table.addressAt( i ) ); }
+     *     from = found[n - 1U] + 1U;
+     * }
+     * \endcode
+     *
+     * @par Bitmaps:
+     * One bitmap per kind, 16 in all: 4 permissions, 4 formats and 8
+     * resolutions, each with one bit per table index. A filter ORs the
+     * bitmaps of the kinds it accepts and ANDs the three results, 32
+     * properties per word; dimensions that accept every kind are skipped.
+     * Together they take 2 bytes per property.
+     *
+     * @par Key ranges:
+     * Unit kinds, units and components are contiguous ranges of table
+     * indices (see `Address`), so `Filter::keys` needs no bitmap: it only
+     * narrows the words visited. A query therefore costs one word per 32
+     * properties within `keys`, plus the properties it returns.
+     *
+     * Specs and addresses of a table do not change once it is built, so
+     * the index is built once and needs no locking.
+     *
+     * @attention
+     * The table must outlive the index.
+     *
+     * @note ja: パーミッション・フォーマット・分解能ごとのビットマップによるPropertyTableの二次索引。
+     */
+    class PropertyIndex
+    {
+    /* ^\__________________________________________ */
+    /* #region Static members, Inner types.         */
+
+    public:
+
+        /** @brief Set of kinds of one dimension; bit `k` accepts the kind of raw value `k`. */
+        using Mask = std::uint8_t;
+
+        static constexpr Mask ALL_PERMISSIONS = 0x0FU;  //!< Every `Permission::Kind`.
+        static constexpr Mask ALL_FORMATS = 0x0FU;      //!< Every `Format::Kind`.
+        static constexpr Mask ALL_RESOLUTIONS = 0xFFU;  //!< Every `Resolution::Kind`.
+
+        /** @brief Returns the mask of one kind. */
+        [[nodiscard]]
+        static constexpr Mask maskOf( property::Permission::Kind k ) noexcept { return bitOf( static_cast<std::uint8_t>( k ) ); }
+
+        /** @copydoc maskOf(property::Permission::Kind) */
+        [[nodiscard]]
+        static constexpr Mask maskOf( property::Format::Kind k ) noexcept { return bitOf( static_cast<std::uint8_t>( k ) ); }
+
+        /** @copydoc maskOf(property::Permission::Kind) */
+        [[nodiscard]]
+        static constexpr Mask maskOf( property::Resolution::Kind k ) noexcept { return bitOf( static_cast<std::uint8_t>( k ) ); }
+
+        /** @brief Permissions that allow reading: `ReadOnly` and `ReadWrite`. */
+        static constexpr Mask READABLE = ( 1U << static_cast<std::uint8_t>( property::Permission::Kind::ReadOnly ) )
+                                       | ( 1U << static_cast<std::uint8_t>( property::Permission::Kind::ReadWrite ) );
+
+        /** @brief Permissions that allow writing: `WriteOnly` and `ReadWrite`. */
+        static constexpr Mask WRITABLE = ( 1U << static_cast<std::uint8_t>( property::Permission::Kind::WriteOnly ) )
+                                       | ( 1U << static_cast<std::uint8_t>( property::Permission::Kind::ReadWrite ) );
+
+        /** @brief Properties to select; a property must match every field. */
+        struct Filter
+        {
+            Mask permissions = ALL_PERMISSIONS;         //!< Accepted permissions.
+            Mask formats = ALL_FORMATS;                 //!< Accepted formats.
+            Mask resolutions = ALL_RESOLUTIONS;         //!< Accepted resolutions.
+            Address::Range keys { 0U, ~Address::Key{ 0U } }; //!< Accepted addresses, e.g. `Address::unitKindRange()`.
+        };
+
+    private:
+
+        /** @brief Word type of the bitmaps. */
+        using Word = std::uint32_t;
+
+        static constexpr std::size_t WORD_BITS = 32U;
+
+        static constexpr std::size_t PERMISSION_PLANE = 0U;  //!< First bitmap of the permissions.
+        static constexpr std::size_t FORMAT_PLANE = 4U;      //!< First bitmap of the formats.
+        static constexpr std::size_t RESOLUTION_PLANE = 8U;  //!< First bitmap of the resolutions.
+        static constexpr std::size_t PLANES = 16U;
+
+        static constexpr Mask bitOf( std::uint8_t raw ) noexcept { return static_cast<Mask>( 1U << raw ); }
+
+    /* #endregion */// Static members, Inner types
+
+    /* ^\__________________________________________ */
+    /* #region Constructors.                        */
+
+    public:
+
+        /**
+         * @param table [in] The table; must outlive the index.
+         */
+        explicit PropertyIndex( PropertyTable const &table ) noexcept;
+
+        ~PropertyIndex() noexcept = default;                        //!< Destructor (default).
+        PropertyIndex( PropertyIndex const & ) noexcept = delete;   //!< Copy constructor (deleted).
+        PropertyIndex( PropertyIndex && ) noexcept = delete;        //!< Move constructor (deleted).
+
+    /* #endregion */// Constructors
+
+    /* ^\__________________________________________ */
+    /* #region Operators.                           */
+
+    public:
+
+        PropertyIndex &operator=( PropertyIndex const & ) noexcept = delete; //!< Copy operator (deleted).
+        PropertyIndex &operator=( PropertyIndex && ) noexcept = delete;      //!< Move operator (deleted).
+
+    /* #endregion */// Operators
+
+    /* ^\__________________________________________ */
+    /* #region Instance members.                    */
+
+    public:
+
+        /* #region Public methods */
+
+        /** @brief Writes the indices of matching properties. */
+        /**
+         * @details
+         * The indices are written in ascending order, which is address
+         * order. When `out` is full, call again with `from` one past the
+         * last index written.
+         *
+         * @param filter [in]  The properties to select.
+         * @param out    [out] The indices of matching properties.
+         * @param from   [in]  The first index to consider.
+         *
+         * @return The number of indices written; 0 if no more match.
+         */
+        [[nodiscard]]
+        std::size_t select( Filter const &filter, std::span<std::size_t> out, std::size_t from = 0U ) const noexcept;
+
+        /** @brief Returns the number of matching properties. */
+        [[nodiscard]]
+        std::size_t count( Filter const &filter ) const noexcept;
+
+        /* #endregion */// Public methods
+
+    private:
+
+        /* #region Private methods */
+
+        /** @brief Returns the matching bits of word `w`, before clipping to the key range. */
+        [[nodiscard]]
+        Word matchAt( Filter const &filter, std::size_t w ) const noexcept;
+
+        /** @brief ORs the bitmaps `first + k` of every bit `k` in `mask`. */
+        [[nodiscard]]
+        Word unionAt( std::size_t first, Mask mask, std::size_t w ) const noexcept;
+
+        /** @brief Calls `f( w, bits )` for every word with a match, in order, until it returns `false`. */
+        template <typename F>
+        void forEachWord( Filter const &filter, std::size_t from, F &&f ) const noexcept;
+
+        /* #endregion */// Private methods
+
+        /* #region Member variables */
+
+        PropertyTable const &table_;
+        std::size_t words_;                         //!< Words per bitmap.
+        std::vector<Word> bitmaps_;                 //!< `PLANES` bitmaps of `words_` words, one after another.
+
+        /* #endregion */// Member variables
+
+    /* #endregion */// Instance members
+
+    }; // class PropertyIndex
+
+} // namespace machine
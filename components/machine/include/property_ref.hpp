@@ -0,0 +1,104 @@
+#pragma once
+
+/* C++ Standard Library */
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+/* Custom Library */
+#include <property.hpp>
+#include <spec.hpp>
+
+namespace machine
+{
+
+    /** @brief Read-only view of one property of a column-wise `PropertyTable`. */
+    /**
+     * @details
+     * Has the same read accessors as `Property`, but refers to the code,
+     * the spec and the value where the table keeps them, in separate
+     * arrays (see `CONFIG_MACHINE_PROPERTY_TABLE_SOA`). It is returned by
+     * value and is as cheap to copy as a pointer pair; the references it
+     * returns stay valid for the lifetime of the table.
+     *
+     * A `Property` converts to a `PropertyRef`, so code that takes one
+     * works with either table layout.
+     *
+     * @note ja: カラム形式の`PropertyTable`の1プロパティを参照する読み取り専用ビュー。
+     */
+    class PropertyRef
+    {
+    /* ^\__________________________________________ */
+    /* #region Constructors.                        */
+
+    public:
+
+        /**
+         * @param code  [in] The property code.
+         * @param spec  [in] The spec; must outlive the view.
+         * @param value [in] The value; must outlive the view.
+         */
+        explicit PropertyRef( std::uint8_t code
+                            , property::Spec const &spec
+                            , property::Value const &value ) noexcept
+            : code_( code ), spec_( &spec ), value_( &value )
+        { /* Do nothing */ }
+
+        /** @brief Views a `Property`. */
+        PropertyRef( Property const &property ) noexcept
+            : PropertyRef( property.code(), property.spec(), property.value() )
+        { /* Do nothing */ }
+
+    /* #endregion */// Constructors
+
+    /* ^\__________________________________________ */
+    /* #region Instance members.                    */
+
+    public:
+
+        /* #region Public methods */
+
+        /** @brief Returns a string representation of the property. */
+        /**
+         * @details
+         * Same as `Property::str()`.
+         */
+        [[nodiscard]]
+        std::string str() const noexcept;
+
+        /* #endregion */// Public methods
+
+        /* #region Getter methods */
+
+        [[nodiscard]]
+        std::uint8_t code() const noexcept { return code_; }
+
+        [[nodiscard]]
+        property::Spec const &spec() const noexcept { return *spec_; }
+
+        [[nodiscard]]
+        property::Value const &value() const noexcept { return *value_; }
+
+        /* #endregion */// Getter methods
+
+    private:
+
+        /* #region : member variables */
+
+        std::uint8_t code_;
+        property::Spec const *spec_;
+        property::Value const *value_;
+
+        /* #endregion */
+
+    /* #endregion */// Instance members
+
+    }; // class PropertyRef
+
+    /** @brief Stream output operator for `PropertyRef`. */
+    /**
+     * @see PropertyRef::str() for the format of the output.
+     */
+    std::ostream &operator<<( std::ostream &os, PropertyRef const &v ) noexcept;
+
+} // namespace machine
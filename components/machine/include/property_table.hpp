@@ -0,0 +1,583 @@
+#pragma once
+
+/* C++ Standard Library */
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+
+/* Custom Library */
+#include <address.hpp>
+#include <property.hpp>
+#include <property_descriptor.hpp>
+#include <property_ref.hpp>
+#include <spec_pool.hpp>
+
+/* ESP-IDF */
+#include <sdkconfig.h>
+
+namespace machine
+{
+
+    /** @brief Flat table of all properties of a machine. */
+    /**
+     * @details
+     * Stores the properties of the whole hierarchy in one contiguous array,
+     * sorted by `Address::key()`. A parallel array holds the keys, so lookups
+     * binary-search 8-byte keys without touching the properties themselves.
+     *
+     * | Operation                         | Cost       |
+     * | --------------------------------- | ---------- |
+     * | `find()` / `indexOf()` by address | O(log n)   |
+     * | `at()` by index                   | O(1)       |
+     * | `unit()` / `component()`          | O(log n), returns a `std::span` |
+     * | iteration over `properties()`     | linear, no pointer chasing |
+     *
+     * Because the keys are ordered unit → component → property, all
+     * properties of one unit or one component are adjacent in memory.
+     *
+     * The table is built once with `Builder` and its shape does not change
+     * afterwards, so indices returned by `indexOf()` stay valid for its
+     * lifetime.
+     *
+     * @par Dirty tracking:
+     * A packed bitmap holds one dirty bit per property. `set()` raises the
+     * bit when the value actually changed (`SetResult::Success`), and
+     * `takeDirty()` pulls and clears the changed set in address order, so
+     * an uplink only ships the delta:
+     *
+     * \code{.cpp}
+     * std::array<std::size_t, 32U> changed;
+     * std::size_t n;
+     * while ( ( n = table.takeDirty( changed ) ) > 0U )
+     * {
+     *     for ( std::size_t i : std::span( changed ).first( n ) )
+     *     {
+     *         send( table.addressAt( i ), table.at( i ) );
+     *     }
+     * }
+     * \endcode
+     *
+     * The bits are updated with atomic operations on 32-bit words, so
+     * writers and the collecting task need no further locking. A value
+     * written while it is being collected is reported again next time;
+     * no change is lost.
+     *
+     * @par Layout:
+     * By default the properties are one array of packed 22-byte `Property`
+     * objects. With `CONFIG_MACHINE_PROPERTY_TABLE_SOA` the table keeps
+     * them column by column instead:
+     *
+     * | Column      | Element                          | Stride   |
+     * | ----------- | -------------------------------- | -------- |
+     * | codes       | property code                    | 1 byte   |
+     * | fragments   | format, permission, resolution   | 1 byte   |
+     * | bounds      | aligned `std::int32_t` lo and hi | 8 bytes  |
+     * | specs       | `SpecPool::Handle`, for `at()`   | 2 bytes  |
+     * | values      | `Value255`                       | 6 bytes  |
+     *
+     * A scan that reads only codes or formats then touches one byte per
+     * property, and `isWithinRange()` compares against aligned words
+     * instead of assembling the byte-wise bounds of `Spec`. The value of a
+     * property stays one `Value255`, whose lock guards its size and
+     * payload together. The `Spec` itself is registered in `SpecPool`,
+     * shared by every property with the same spec, and only resolved by
+     * `at()`; a property takes 18 bytes instead of 22, plus one pool entry
+     * per distinct spec.
+     *
+     * Both layouts have the same accessors, but `at()`, `find()` and the
+     * ranges return `Reference`, `Pointer` and `Range`: a `Property` in the
+     * packed layout and a `PropertyRef` view in the column layout. Code
+     * written with `auto`, or against `PropertyRef`, works with either.
+     *
+     * @note ja: マシン全体のプロパティを連続配列で保持するテーブル。
+     */
+    class PropertyTable
+    {
+    /* ^\__________________________________________ */
+    /* #region Static members, Inner types.         */
+
+    public:
+
+        /** @brief Collects properties and builds a `PropertyTable`. */
+        /**
+         * @details
+         * Properties may be added in any order; `build()` sorts them once.
+         */
+        class Builder
+        {
+        public:
+
+            /** @brief Reserves space for the given number of properties. */
+            void reserve( std::size_t count ) noexcept;
+
+            /** @brief Adds a property at the given address. */
+            /**
+             * @param address [in] The address of the property.
+             * @param property [in] The property to add.
+             */
+            void add( Address address, Property &&property ) noexcept;
+
+            /** @brief Adds a property for every descriptor of a catalog. */
+            /**
+             * @details
+             * Each property is created with `Spec::create( StaticSpec const & )`
+             * and starts at its initial value.
+             *
+             * @param catalog [in] The descriptors to add.
+             *
+             * @return `true` if all properties were added; `false` if a
+             *         property could not be created (out of memory).
+             */
+            [[nodiscard]]
+            bool add( std::span<PropertyDescriptor const> catalog ) noexcept;
+
+            /** @brief Builds the table, leaving this builder empty. */
+            /**
+             * @return `PropertyTable` if all addresses are unique and, in the
+             *         column layout, every spec fits in `SpecPool`;
+             *         std::nullopt otherwise.
+             */
+            [[nodiscard]]
+            std::optional<PropertyTable> build() noexcept;
+
+        private:
+
+            std::vector<Address> keys_;
+            std::vector<Property> properties_;
+        };
+
+#if CONFIG_MACHINE_PROPERTY_TABLE_SOA
+
+        /** @brief Adjacent properties of the column layout, see `unit()`. */
+        /**
+         * @details
+         * Offers the members of `std::span<Property const>` that callers use:
+         * `size()`, `empty()`, `operator[]` and range-based `for`. It is a
+         * `std::ranges::forward_range`, so `std::ranges` algorithms and
+         * `std::distance` accept it as well. Like the span, it only views
+         * the table, so its iterators outlive a temporary slice.
+         */
+        class Slice
+        {
+        public:
+
+            /** @brief Iterates the properties of a slice as `PropertyRef`. */
+            /**
+             * @details
+             * A `std::forward_iterator` whose reference is the `PropertyRef`
+             * value itself. As for other proxy iterators, the legacy category
+             * is therefore only input.
+             */
+            struct Iterator
+            {
+                using iterator_concept = std::forward_iterator_tag;
+                using iterator_category = std::input_iterator_tag;
+                using value_type = PropertyRef;
+                using difference_type = std::ptrdiff_t;
+                using reference = PropertyRef;
+                using pointer = void;
+
+                PropertyTable const *table = nullptr;
+                std::size_t index = 0U;
+
+                PropertyRef operator*() const noexcept { return table->at( index ); }
+                Iterator &operator++() noexcept { index++; return *this; }
+                Iterator operator++( int ) noexcept { Iterator const prev = *this; index++; return prev; }
+                bool operator==( Iterator const & ) const noexcept = default;
+            };
+
+            explicit Slice( PropertyTable const &table, std::size_t first, std::size_t count ) noexcept
+                : table_( &table ), first_( first ), count_( count )
+            { /* Do nothing */ }
+
+            [[nodiscard]]
+            std::size_t size() const noexcept { return count_; }
+
+            [[nodiscard]]
+            bool empty() const noexcept { return count_ == 0U; }
+
+            [[nodiscard]]
+            PropertyRef operator[]( std::size_t i ) const noexcept { return table_->at( first_ + i ); }
+
+            [[nodiscard]]
+            Iterator begin() const noexcept { return Iterator{ table_, first_ }; }
+
+            [[nodiscard]]
+            Iterator end() const noexcept { return Iterator{ table_, first_ + count_ }; }
+
+        private:
+
+            PropertyTable const *table_;
+            std::size_t first_;
+            std::size_t count_;
+        };
+
+    private:
+
+        /** @brief One reference to a `SpecPool` entry, released with the table. */
+        class SpecHandle
+        {
+        public:
+
+            explicit SpecHandle( property::SpecPool::Handle h ) noexcept : h_( h ) { /* Do nothing */ }
+            ~SpecHandle() noexcept { property::SpecPool::release( h_ ); }
+            SpecHandle( SpecHandle const & ) noexcept = delete;
+            SpecHandle( SpecHandle &&other ) noexcept : h_( std::exchange( other.h_, property::SpecPool::NONE ) ) { /* Do nothing */ }
+            SpecHandle &operator=( SpecHandle const & ) noexcept = delete;
+            SpecHandle &operator=( SpecHandle &&other ) noexcept { std::swap( h_, other.h_ ); return *this; }
+
+            [[nodiscard]]
+            property::SpecPool::Handle get() const noexcept { return h_; }
+
+        private:
+
+            property::SpecPool::Handle h_;
+        };
+
+        static_assert( sizeof( SpecHandle ) == sizeof( property::SpecPool::Handle ), "SpecHandle must be as small as its handle" );
+
+    public:
+
+        using Reference = PropertyRef;                  //!< What `at()` returns.
+        using Pointer = std::optional<PropertyRef>;     //!< What `find()` returns; empty if there is no such property.
+        using Range = Slice;                            //!< What `unit()`, `component()` and `properties()` return.
+
+#else
+
+        using Reference = Property const &;             //!< What `at()` returns.
+        using Pointer = Property const *;               //!< What `find()` returns; `nullptr` if there is no such property.
+        using Range = std::span<Property const>;        //!< What `unit()`, `component()` and `properties()` return.
+
+#endif
+
+        /** @brief Half-open index range `[first, last)`. */
+        struct Indices
+        {
+            std::size_t first; //!< First index of the range.
+            std::size_t last;  //!< One past the last index of the range.
+        };
+
+        /** @brief Called by `set()` after a value changed. */
+        /**
+         * @param table   [in] The table.
+         * @param index   [in] The index of the changed property.
+         * @param context [in] The pointer given to `onChange()`.
+         */
+        using ChangeHook = void (*)( PropertyTable const &table, std::size_t index, void *context ) noexcept;
+
+    /* #endregion */// Static members, Inner types
+
+    /* ^\__________________________________________ */
+    /* #region Constructors.                        */
+
+    public:
+
+        explicit PropertyTable() noexcept = default;                //!< Default constructor (empty table).
+        ~PropertyTable() noexcept = default;                        //!< Destructor (default).
+        PropertyTable( PropertyTable const & ) noexcept = delete;   //!< Copy constructor (deleted).
+        PropertyTable( PropertyTable && ) noexcept = default;       //!< Move constructor (default).
+
+    private:
+
+        explicit PropertyTable( std::vector<Address> &&keys
+                              , std::vector<Property> &&properties ) noexcept;
+
+        /** @brief Word type of the dirty bitmap. */
+        using DirtyWord = std::uint32_t;
+
+        static constexpr std::size_t DIRTY_WORD_BITS = 32U;
+
+    /* #endregion */// Constructors
+
+    /* ^\__________________________________________ */
+    /* #region Operators.                           */
+
+    public:
+
+        PropertyTable &operator=( PropertyTable const & ) noexcept = delete; //!< Copy operator (deleted).
+        PropertyTable &operator=( PropertyTable && ) noexcept = default;     //!< Move operator (default).
+
+    /* #endregion */// Operators
+
+    /* ^\__________________________________________ */
+    /* #region Instance members.                    */
+
+    public:
+
+        /* #region Public methods */
+
+        /** @brief Returns the index of the property at the given address. */
+        [[nodiscard]]
+        std::optional<std::size_t> indexOf( Address address ) const noexcept;
+
+        /** @brief Returns the property at the given address, if any. */
+        /**
+         * @return The property; `nullptr` (packed layout) or `std::nullopt`
+         *         (column layout) if there is none. Both test `false`.
+         */
+        [[nodiscard]]
+        Pointer find( Address address ) const noexcept;
+
+        /** @brief Returns all properties of the unit of the given address. */
+        /**
+         * @details
+         * Only the unit fields of `address` are used.
+         *
+         * @param address [in] Any address within the unit.
+         *
+         * @return Contiguous properties of the unit; empty if none.
+         */
+        [[nodiscard]]
+        Range unit( Address address ) const noexcept
+        {
+            return range( address.unitRange() );
+        }
+
+        /** @brief Returns all properties of the component of the given address. */
+        /**
+         * @details
+         * Only the unit and component fields of `address` are used.
+         *
+         * @param address [in] Any address within the component.
+         *
+         * @return Contiguous properties of the component; empty if none.
+         */
+        [[nodiscard]]
+        Range component( Address address ) const noexcept
+        {
+            return range( address.componentRange() );
+        }
+
+        /** @brief Returns the indices of the properties within a key range. */
+        /**
+         * @details
+         * E.g. `indicesOf( address.unitKindRange() )` for all units of a kind.
+         *
+         * @param keys [in] The key range.
+         *
+         * @return The contiguous indices; empty (`first == last`) if none.
+         */
+        [[nodiscard]]
+        Indices indicesOf( Address::Range keys ) const noexcept
+        {
+            return Indices{ lowerIndexOf( keys.first ), lowerIndexOf( keys.last ) };
+        }
+
+        /** @brief Checks a raw value against the spec of a property. */
+        /**
+         * @details
+         * Same as `at( index ).spec().isWithinRange( bytes )`; in the column
+         * layout only the fragment and bounds columns are read.
+         *
+         * @param index [in] The index of the property, less than `size()`.
+         * @param bytes [in] The raw value to check.
+         *
+         * @return `true` if the value is within range; `false` otherwise.
+         */
+        [[nodiscard]]
+        bool isWithinRange( std::size_t index, std::span<std::byte const> bytes ) const noexcept
+        {
+#if CONFIG_MACHINE_PROPERTY_TABLE_SOA
+            return property::detail::isWithinBounds( formatAt( index ), bounds_[index], bytes );
+#else
+            return properties_[index].spec().isWithinRange( bytes );
+#endif
+        }
+
+        /** @brief Replaces the value of a property and records the change. */
+        /**
+         * @details
+         * Calls `Property::setValue()` and, if it returned
+         * `SetResult::Success`, raises the dirty bit of the property and
+         * calls the change hook, see `onChange()`.
+         *
+         * @param index [in] The index of the property, less than `size()`.
+         * @param data  [in] Pointer to the new raw data.
+         *                   A null pointer is only valid if size is 0.
+         * @param size  [in] Size of the new data in bytes.
+         *
+         * @return The result of `Property::setValue()`.
+         */
+        [[nodiscard]]
+        value::SetResult set( std::size_t index, std::byte const *data, std::uint8_t size ) noexcept;
+
+        /** @brief Replaces the value of the property at an address and records the change. */
+        /**
+         * @return The result of `Property::setValue()`;
+         *         `SetResult::IllegalArgument` if there is no such property.
+         */
+        [[nodiscard]]
+        value::SetResult set( Address address, std::byte const *data, std::uint8_t size ) noexcept;
+
+        /** @brief Pulls and clears the indices of changed properties. */
+        /**
+         * @details
+         * Writes the indices of dirty properties to `out` in ascending
+         * order, which is address order, and clears their bits. Dirty
+         * properties that do not fit in `out` stay dirty, so calling again
+         * continues with them.
+         *
+         * @param out [out] The indices of changed properties.
+         *
+         * @return The number of indices written; 0 if nothing changed.
+         */
+        [[nodiscard]]
+        std::size_t takeDirty( std::span<std::size_t> out ) noexcept;
+
+        /** @brief Returns `true` if the property has changed since it was last taken. */
+        [[nodiscard]]
+        bool isDirty( std::size_t index ) const noexcept;
+
+        /** @brief Returns the number of changed properties. */
+        [[nodiscard]]
+        std::size_t dirtyCount() const noexcept;
+
+        /** @brief Marks every property as changed, e.g. to force a full upload. */
+        void markAllDirty() noexcept;
+
+        /** @brief Sets the function called by `set()` after each change. */
+        /**
+         * @details
+         * The hook runs in the task that called `set()`, after the value is
+         * visible and its dirty bit raised, and must not call `set()` itself.
+         * There is one hook per table; a new one replaces the old one.
+         *
+         * @param hook    [in] The function; `nullptr` to remove the hook.
+         * @param context [in] Passed to every call of `hook`.
+         */
+        void onChange( ChangeHook hook, void *context ) noexcept
+        {
+            hook_ = hook;
+            hookContext_ = context;
+        }
+
+        /* #endregion */// Public methods
+
+        /* #region Getter methods */
+
+        [[nodiscard]]
+        std::size_t size() const noexcept { return keys_.size(); }
+
+        [[nodiscard]]
+        bool empty() const noexcept { return keys_.empty(); }
+
+        [[nodiscard]]
+        Address addressAt( std::size_t index ) const noexcept { return keys_[index]; }
+
+        [[nodiscard]]
+        std::span<Address const> addresses() const noexcept { return keys_; }
+
+        [[nodiscard]]
+        Range properties() const noexcept { return range( 0U, size() ); }
+
+#if CONFIG_MACHINE_PROPERTY_TABLE_SOA
+
+        [[nodiscard]]
+        Reference at( std::size_t index ) const noexcept
+        {
+            return PropertyRef( codes_[index], property::SpecPool::specOf( specs_[index].get() ), values_[index] );
+        }
+
+        [[nodiscard]]
+        std::uint8_t codeAt( std::size_t index ) const noexcept { return codes_[index]; }
+
+        [[nodiscard]]
+        property::Format::Kind formatAt( std::size_t index ) const noexcept
+        {
+            return property::Format::fromRaw( std::bit_cast<property::Spec::Fragments>( frags_[index] ).format );
+        }
+
+        [[nodiscard]]
+        property::Permission::Kind permissionAt( std::size_t index ) const noexcept
+        {
+            return property::Permission::fromRaw( std::bit_cast<property::Spec::Fragments>( frags_[index] ).permission );
+        }
+
+        [[nodiscard]]
+        property::Resolution::Kind resolutionAt( std::size_t index ) const noexcept
+        {
+            return property::Resolution::fromRaw( std::bit_cast<property::Spec::Fragments>( frags_[index] ).resolution );
+        }
+
+#else
+
+        [[nodiscard]]
+        Reference at( std::size_t index ) const noexcept { return properties_[index]; }
+
+        [[nodiscard]]
+        std::uint8_t codeAt( std::size_t index ) const noexcept { return properties_[index].code(); }
+
+        [[nodiscard]]
+        property::Format::Kind formatAt( std::size_t index ) const noexcept { return properties_[index].spec().format(); }
+
+        [[nodiscard]]
+        property::Permission::Kind permissionAt( std::size_t index ) const noexcept { return properties_[index].spec().permission(); }
+
+        [[nodiscard]]
+        property::Resolution::Kind resolutionAt( std::size_t index ) const noexcept { return properties_[index].spec().resolution(); }
+
+#endif
+
+        /* #endregion */// Getter methods
+
+    private:
+
+        /* #region Private methods */
+
+        std::size_t lowerIndexOf( Address::Key key ) const noexcept;
+
+        Range range( Address::Range r ) const noexcept;
+
+        Range range( std::size_t first, std::size_t count ) const noexcept;
+
+        void markDirty( std::size_t index ) noexcept;
+
+        /* #endregion */// Private methods
+
+        /* #region Member variables */
+
+        std::vector<Address> keys_;                 //!< Sorted keys; every other array is parallel to it.
+#if CONFIG_MACHINE_PROPERTY_TABLE_SOA
+        std::vector<std::uint8_t> codes_;           //!< Property codes.
+        std::vector<std::uint8_t> frags_;           //!< Raw `Spec::Fragments` bytes.
+        std::vector<property::detail::RangeBounds> bounds_; //!< Decoded bounds, aligned.
+        std::vector<SpecHandle> specs_;             //!< Shared specs, only resolved by `at()`.
+        std::vector<property::MutableValue> values_; //!< Values.
+#else
+        std::vector<Property> properties_;          //!< Properties in key order.
+#endif
+        std::vector<std::atomic<DirtyWord>> dirty_; //!< One bit per property, see the class description.
+        ChangeHook hook_ = nullptr;                 //!< Called by `set()` after a change, see `onChange()`.
+        void *hookContext_ = nullptr;
+
+        /* #endregion */// Member variables
+
+    /* #endregion */// Instance members
+
+    }; // class PropertyTable
+
+} // namespace machine
+
+
+#if CONFIG_MACHINE_PROPERTY_TABLE_SOA
+
+namespace std::ranges // Borrowed range specialization
+{
+
+    /** @brief A `Slice` only views its table, as `std::span` views its elements. */
+    template <>
+    inline constexpr bool enable_borrowed_range<machine::PropertyTable::Slice> = true;
+
+} // namespace std::ranges
+
+static_assert( std::forward_iterator<machine::PropertyTable::Slice::Iterator>, "Slice::Iterator must be a forward iterator" );
+static_assert( std::ranges::borrowed_range<machine::PropertyTable::Slice>, "Slice must be a borrowed range like std::span" );
+
+#endif
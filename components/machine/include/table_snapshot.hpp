@@ -0,0 +1,222 @@
+#pragma once
+
+/* C++ Standard Library */
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/* Custom Library */
+#include <property_table.hpp>
+
+namespace machine
+{
+
+    /** @brief Consistent, lock-free read copies of all values of a `PropertyTable`. */
+    /**
+     * @details
+     * Reading a whole table property by property takes one lock per value
+     * and can mix values from before and after an update. A snapshot
+     * instead keeps `BUFFER_COUNT` flat copies of all values and publishes
+     * one of them at a time:
+     *
+     * - Readers `acquire()` the current copy with one atomic load plus a
+     *   reader count, and then read any number of values without locking.
+     *   All of them belong to the same publication.
+     * - The single writer updates a copy that no reader holds and makes it
+     *   current with one atomic store, after a batch of `PropertyTable::set()`.
+     *
+     * \code{.cpp}
+     * // writer, e.g. the publish stage of the pipeline
+     * snapshot.publish( table, changed );
+     *
+     * // any reader
+     * auto const view = snapshot.acquire();
+     * for ( std::size_t i = 0U; i < view.size(); i++ )
+     * {
+     *     send( table.addressAt( i ), view.value( i ) );
+     * }
+     * \endcode
+     *
+     * @par Layout:
+     * Each property has a fixed slot in every copy, as large as its format
+     * allows: `MAX_STRING_SIZE` bytes for a `String`, 4 bytes otherwise.
+     * A value that does not fit its slot is not valid for its spec and is
+     * published as empty.
+     *
+     * @par Cost of publishing:
+     * Each property remembers the publication in which it last changed, and
+     * each copy the publication it holds, so `publish()` only copies values
+     * that changed since the copy it reuses was written: one value lock per
+     * changed property, none for the others.
+     *
+     * With three copies the writer always finds a free copy while at most
+     * one reader holds an older one. If every other copy is held, `publish()`
+     * returns `false` and the changes are included in the next call; none is
+     * lost.
+     *
+     * @attention
+     * The shape of `table` must not change, i.e. index `i` must refer to the
+     * same property for the lifetime of the snapshot, which `PropertyTable`
+     * guarantees.
+     *
+     * @note ja: 全プロパティ値の一貫したコピーをロックなしで読むためのスナップショット。
+     */
+    class TableSnapshot
+    {
+    /* ^\__________________________________________ */
+    /* #region Static members, Inner types.         */
+
+    public:
+
+        /** @brief Number of value copies. */
+        static constexpr std::size_t BUFFER_COUNT = 3U;
+
+    private:
+
+        /** @brief One copy of all values. */
+        struct Buffer
+        {
+            std::vector<std::byte> bytes;          //!< Slots, see `TableSnapshot::offsets_`.
+            std::vector<std::uint8_t> sizes;       //!< Value size per property.
+            std::uint32_t generation = 0U;         //!< Publication held; 0 if never written.
+            std::atomic<std::uint32_t> readers {}; //!< Number of live `View`s.
+        };
+
+    public:
+
+        /** @brief A held copy; released on destruction. */
+        class View
+        {
+        public:
+
+            ~View() noexcept;                                 //!< Destructor (releases the copy).
+            View( View const & ) noexcept = delete;           //!< Copy constructor (deleted).
+            View( View &&other ) noexcept;                    //!< Move constructor.
+            View &operator=( View const & ) noexcept = delete; //!< Copy operator (deleted).
+            View &operator=( View && ) noexcept = delete;      //!< Move operator (deleted).
+
+            /** @brief Returns the number of properties. */
+            [[nodiscard]]
+            std::size_t size() const noexcept;
+
+            /** @brief Returns the published value of a property. */
+            /**
+             * @param index [in] The index in the table, less than `size()`.
+             */
+            [[nodiscard]]
+            std::span<std::byte const> value( std::size_t index ) const noexcept;
+
+            /** @brief Returns the publication number, increasing with every `publish()`. */
+            [[nodiscard]]
+            std::uint32_t generation() const noexcept;
+
+        private:
+
+            friend class TableSnapshot;
+
+            explicit View( TableSnapshot const *owner, std::uint8_t buffer ) noexcept
+                : owner_( owner ), buffer_( buffer )
+            { /* Do nothing */ }
+
+            TableSnapshot const *owner_;  //!< `nullptr` if moved from.
+            std::uint8_t buffer_;         //!< Index of the held copy.
+        };
+
+    /* #endregion */// Static members, Inner types
+
+    /* ^\__________________________________________ */
+    /* #region Constructors.                        */
+
+    public:
+
+        /** @brief Lays out the copies for `table` and publishes all of its values. */
+        explicit TableSnapshot( PropertyTable const &table ) noexcept;
+
+        ~TableSnapshot() noexcept = default;                      //!< Destructor (default).
+        TableSnapshot( TableSnapshot const & ) noexcept = delete; //!< Copy constructor (deleted).
+        TableSnapshot( TableSnapshot && ) noexcept = delete;      //!< Move constructor (deleted).
+
+    /* #endregion */// Constructors
+
+    /* ^\__________________________________________ */
+    /* #region Operators.                           */
+
+    public:
+
+        TableSnapshot &operator=( TableSnapshot const & ) noexcept = delete; //!< Copy operator (deleted).
+        TableSnapshot &operator=( TableSnapshot && ) noexcept = delete;      //!< Move operator (deleted).
+
+    /* #endregion */// Operators
+
+    /* ^\__________________________________________ */
+    /* #region Instance members.                    */
+
+    public:
+
+        /* #region Public methods */
+
+        /** @brief Holds the current copy. */
+        /**
+         * @details
+         * Lock-free and safe from any task. Release the view soon; a held
+         * copy cannot be reused by the writer.
+         */
+        [[nodiscard]]
+        View acquire() const noexcept;
+
+        /** @brief Publishes the current values of the changed properties. */
+        /**
+         * @details
+         * Must only be called by one task at a time.
+         *
+         * @param table   [in] The table the snapshot was created for.
+         * @param changed [in] Indices of the properties changed since the
+         *                     last call, e.g. from `PropertyTable::takeDirty()`.
+         *
+         * @return `true` if a new copy was published; `false` if all other
+         *         copies are held by readers, see the class description.
+         */
+        bool publish( PropertyTable const &table, std::span<std::size_t const> changed ) noexcept;
+
+        /** @brief Publishes the current values of all properties. */
+        /**
+         * @copydetails publish()
+         */
+        bool publishAll( PropertyTable const &table ) noexcept;
+
+        /* #endregion */// Public methods
+
+        /* #region Getter methods */
+
+        [[nodiscard]]
+        std::size_t size() const noexcept { return offsets_.size(); }
+
+        /* #endregion */// Getter methods
+
+    private:
+
+        /* #region Private methods */
+
+        bool publishPending( PropertyTable const &table ) noexcept;
+
+        /* #endregion */// Private methods
+
+        /* #region Member variables */
+
+        std::vector<std::uint32_t> offsets_;        //!< Slot offset per property, shared by all copies.
+        std::vector<std::uint8_t> capacities_;      //!< Slot size per property.
+        std::vector<std::uint32_t> lastChanged_;    //!< Publication in which each property last changed.
+        std::uint32_t generation_ = 0U;             //!< Last publication; written by the writer only.
+        mutable std::array<Buffer, BUFFER_COUNT> buffers_ {};
+        std::atomic<std::uint8_t> current_ { 0U };  //!< Index of the published copy.
+
+        /* #endregion */// Member variables
+
+    /* #endregion */// Instance members
+
+    }; // class TableSnapshot
+
+} // namespace machine
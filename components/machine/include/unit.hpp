@@ -0,0 +1,194 @@
+#pragma once
+
+/* C++ Standard Library */
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string_view>
+
+namespace machine
+{
+
+    /** @brief A unit of a machine, identified by its kind and index. */
+    /**
+     * @details
+     * A unit is a part of a machine, e.g. a board, a thermal or a power
+     * unit. It is the top level of the `Address` hierarchy:
+     *
+     * - Machine
+     *   - `Unit[]` (unique: kind, index)
+     *     - `Component[]` (unique: code, index)
+     *       - `Property[]`  (unique: code)
+     *
+     * Both fields are packed into one 16-bit `key()`, kind first, which
+     * is also the upper part of every `Address::key()` of the unit. The
+     * default comparisons therefore order units as their addresses, and
+     * `std::hash<Unit>` hashes the key only.
+     *
+     * Index `PRIMARY_INDEX` is the primary unit of a kind; indices above
+     * are secondary units.
+     *
+     * @note ja: 種別とインデックスで識別する機械のユニット。16ビットの1つのキーに詰める。
+     */
+    class Unit
+    {
+    /* ^\__________________________________________ */
+    /* #region Static members, Inner types.         */
+
+    public:
+
+        /** @brief Packed key type. */
+        using Key = std::uint16_t;
+
+        /** @brief Unit kind. */
+        enum class Kind : std::uint8_t
+        {
+            Board,          //!< Board unit.
+            ExpansionBoard, //!< Expansion board unit.
+            Thermal,        //!< Thermal unit.
+            Storage,        //!< Storage unit.
+            Power,          //!< Power unit.
+            Light,          //!< Light unit.
+        };
+
+        /** @brief Index of the primary unit of a kind. */
+        static constexpr std::uint8_t PRIMARY_INDEX = 0U;
+
+        /** @brief Returns the unit of a packed `key`, see `key()`. */
+        [[nodiscard]]
+        static constexpr Unit fromKey( Key key ) noexcept
+        {
+            return Unit( static_cast<Kind>( key >> KIND_SHIFT ), static_cast<std::uint8_t>( key ) );
+        }
+
+        /** @brief Returns the name of the `Kind`. */
+        /**
+         * @details
+         * Inputs and outputs are as follows:
+         *
+         * | INPUT                  | OUTPUT            |
+         * | ---------------------- | ----------------- |
+         * | `Kind::Board`          | `board`           |
+         * | `Kind::ExpansionBoard` | `expansion-board` |
+         * | `Kind::Thermal`        | `thermal`         |
+         * | `Kind::Storage`        | `storage`         |
+         * | `Kind::Power`          | `power`           |
+         * | `Kind::Light`          | `light`           |
+         * | other                  | `Unknown`         |
+         *
+         * @param v [in] the `Kind`
+         *
+         * @return enumerator name
+         */
+        [[nodiscard]]
+        static std::string_view nameOf( Kind const &v ) noexcept;
+
+    private:
+
+        static constexpr std::uint8_t KIND_SHIFT = 8U;
+
+    /* #endregion */// Static members, Inner types
+
+    /* ^\__________________________________________ */
+    /* #region Constructors.                        */
+
+    public:
+
+        /** @brief Construct with given kind and index. */
+        /**
+         * @param kind  unit kind
+         * @param index unit index; `PRIMARY_INDEX` is the primary unit
+         */
+        explicit constexpr Unit( Kind kind, std::uint8_t index = PRIMARY_INDEX ) noexcept
+            : key_( static_cast<Key>( ( static_cast<Key>( kind ) << KIND_SHIFT ) | index ) )
+        {}
+
+    /* #endregion */// Constructors
+
+    /* ^\__________________________________________ */
+    /* #region Operators.                           */
+
+    public:
+
+        constexpr bool operator==( Unit const & ) const noexcept = default;  //!< Equality operator (default).
+        constexpr auto operator<=>( Unit const & ) const noexcept = default; //!< Three-way comparison operator (default).
+
+    /* #endregion */// Operators
+
+    /* ^\__________________________________________ */
+    /* #region Instance members.                    */
+
+    public:
+
+        /* #region Getter methods */
+
+        [[nodiscard]]
+        constexpr Key key() const noexcept { return key_; }
+
+        [[nodiscard]]
+        constexpr Kind kind() const noexcept { return static_cast<Kind>( key_ >> KIND_SHIFT ); }
+
+        [[nodiscard]]
+        constexpr std::uint8_t index() const noexcept { return static_cast<std::uint8_t>( key_ ); }
+
+        /** @brief Returns `true` if this is the primary unit of its kind. */
+        [[nodiscard]]
+        constexpr bool isPrimary() const noexcept { return index() == PRIMARY_INDEX; }
+
+        /* #endregion */// Getter methods
+
+    private:
+
+        /* #region Member variables */
+
+        Key key_; //!< Kind in the upper, index in the lower byte.
+
+        /* #endregion */// Member variables
+
+    /* #endregion */// Instance members
+
+    }; // class Unit
+
+    static_assert( sizeof( Unit ) == sizeof( Unit::Key ), "Unit must be as small as its key" );
+
+    /** @brief Stream output operator for `Unit::Kind`. */
+    /**
+     * @see std::formatter<machine::Unit::Kind> for formatting details.
+     *
+     * @param os [out] The output stream to write to.
+     * @param v  [in]  The `Unit::Kind` value to output.
+     *
+     * @return Reference to the output stream after writing.
+     */
+    std::ostream &operator<<( std::ostream &os, Unit::Kind const &v ) noexcept;
+
+    /** @brief Stream output operator for `Unit`. */
+    /**
+     * @see std::formatter<machine::Unit> for formatting details.
+     *
+     * @param os [out] The output stream to write to.
+     * @param v  [in]  The `Unit` value to output.
+     *
+     * @return Reference to the output stream after writing.
+     */
+    std::ostream &operator<<( std::ostream &os, Unit const &v ) noexcept;
+
+} // namespace machine
+
+
+namespace std // Hash specialization
+{
+
+    /** @brief Hash specialization for `machine::Unit`, over its `key()`. */
+    template <>
+    struct hash<machine::Unit>
+    {
+        std::size_t operator()( machine::Unit const &v ) const noexcept
+        {
+            return std::hash<machine::Unit::Key> {}( v.key() );
+        }
+    };
+
+} // namespace std
@@ -0,0 +1,92 @@
+#pragma once
+
+/* Self */
+#include <unit.hpp>
+
+/* C++ Standard Library */
+#include <format>
+
+namespace std // Formatter specialization
+{
+
+    /** @brief Formatter specialization for `machine::Unit::Kind`. */
+    /**
+     * @details
+     * Formats a `machine::Unit::Kind` value as its name and raw value. For example:
+     *
+     * - `Kind::Board         `: `board(0)`
+     * - `Kind::ExpansionBoard`: `expansion-board(1)`
+     * - `Kind::Thermal       `: `thermal(2)`
+     */
+    template <>
+    struct formatter<machine::Unit::Kind>
+    {
+        using Unit = machine::Unit;
+
+        /** @brief Parse format specifiers (none supported). */
+        /**
+         * @param ctx [in,out] The format parse context.
+         *
+         * @return Iterator pointing to the next character to be parsed
+         *         (no specifiers are consumed).
+         */
+        constexpr auto parse( std::format_parse_context &ctx ) const noexcept
+            -> const char *
+        {
+            return ctx.begin();
+        }
+
+        /** @brief Format `Unit::Kind` value. */
+        /**
+         * @param v   [in]     The `Unit::Kind` value to format.
+         * @param ctx [in,out] The format context.
+         *
+         * @return Iterator to the end of the formatted output.
+         */
+        template <typename FormatContext>
+        auto format( Unit::Kind const &v, FormatContext &ctx ) const noexcept
+        {
+            return std::format_to( ctx.out(), "{}({})", Unit::nameOf( v ), static_cast<std::uint8_t>( v ) );
+        }
+    };
+
+    /** @brief Formatter specialization for `machine::Unit`. */
+    /**
+     * @details
+     * Formats a `machine::Unit` instance. For example:
+     *
+     * `{ kind: thermal(2), index: 0 }`
+     */
+    template <>
+    struct formatter<machine::Unit>
+    {
+        using Unit = machine::Unit;
+
+        /** @brief Parse format specifiers (none supported). */
+        /**
+         * @param ctx [in,out] The format parse context.
+         *
+         * @return Iterator pointing to the next character to be parsed
+         *         (no specifiers are consumed).
+         */
+        constexpr auto parse( std::format_parse_context &ctx ) const noexcept
+            -> const char *
+        {
+            return ctx.begin();
+        }
+
+        /** @brief Format `Unit` value. */
+        /**
+         * @param v   [in]     The `Unit` value to format.
+         * @param ctx [in,out] The format context.
+         *
+         * @return Iterator to the end of the formatted output.
+         */
+        template <typename FormatContext>
+        auto format( Unit const &v, FormatContext &ctx ) const noexcept
+        {
+            return std::format_to( ctx.out(), "{{ kind: {}, index: {} }}", v.kind(), v.index() );
+        }
+    };
+
+} // namespace std
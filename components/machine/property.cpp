@@ -0,0 +1,75 @@
+/* Self */
+#include <property.hpp>
+
+/* C++ Standard Library */
+#include <format>
+#include <iterator>
+#include <utility>
+
+/* Custom Library */
+#include <property_format.hpp>
+
+/* ^\__________________________________________ */
+/* Namespaces.                                  */
+using namespace machine;
+
+
+/* ^\__________________________________________ */
+/* #region Factory methods, Constructors.       */
+
+std::optional<Property> Property::create( std::uint8_t code
+                                        , property::Spec &&spec ) noexcept
+{
+    auto value = spec.initVal().clone();
+
+    if ( !value.has_value() ) { return std::nullopt; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on allocation failure!! ]
+    // [===> Follows: Initial value copied]
+
+    return create( code, std::move( spec ), std::move( value.value() ) );
+}
+
+std::optional<Property> Property::create( std::uint8_t code
+                                        , property::Spec &&spec
+                                        , property::Value &&value ) noexcept
+{
+    return std::optional<Property>{
+        Property{ code, std::move( spec ), std::move( value ) }
+    };
+}
+
+Property::Property( std::uint8_t code
+                  , property::Spec &&spec
+                  , property::Value &&value ) noexcept
+    : code_( code )
+    , spec_( std::move( spec ) )
+    , value_( std::move( value ) )
+{ /* Do nothing */ }
+
+/* #endregion */// Factory methods, Constructors.
+
+
+/* ^\__________________________________________ */
+/* #region Operators.                           */
+
+namespace machine
+{
+    std::ostream &operator<<( std::ostream &os, Property const &v ) noexcept
+    {
+        std::format_to( std::ostreambuf_iterator<char>( os ), "{}", v );
+        return os;
+    }
+}
+
+/* #endregion */// Operators.
+
+
+/* ^\__________________________________________ */
+/* #region Public methods.                      */
+
+std::string Property::str() const noexcept
+{
+    return std::format( "{}", *this );
+}
+
+/* #endregion */// Public methods.
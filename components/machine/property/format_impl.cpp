@@ -2,7 +2,12 @@
 #include "format_impl.hpp"
 
 /* C++ Standard Library */
-#include <sstream>
+#include <format>
+#include <iterator>
+#include <utility>
+
+/* Custom Library */
+#include <format_format.hpp>
 
 /* ^\__________________________________________ */
 /* Namespaces.                                  */
@@ -17,7 +22,8 @@ namespace machine::property
 {
     std::ostream &operator<<( std::ostream &os, Format::Kind const &v ) noexcept
     {
-        return os << Format::strOf( v );
+        std::format_to( std::ostreambuf_iterator<char>( os ), "{}", v );
+        return os;
     }
 }
 
@@ -35,26 +41,21 @@ Format::Kind Format::fromRaw( std::uint8_t raw ) noexcept
 
 Format::Kind Format::fromValueRange( Value const &min, Value const &max ) noexcept
 {
-    auto min_size = min.size();
-    auto max_size = max.size();
-
-    if ( ( min_size == 0U ) && ( max_size == 0U ) )
+    // Note: Only the size and the first byte are needed; views are taken one
+    //       at a time so that `min` and `max` may refer to the same instance.
+    auto const head = []( Value const &v ) noexcept
     {
-        return Kind::String;
-    }
+        Value::View const view = v.view();
+        // [===> Follows: Locked]
 
-    if ( ( min_size == 0U ) && ( max_size != 0U ) )
-    {
-        return Kind::BitSet;
-    }
+        std::byte const first = view.empty() ? std::byte{ 0x00 } : view[0U];
+        return std::pair{ view.size(), first };
+    };
 
-    if ( ( min_size == BOOL_SIZE ) && ( min.bytes().at( 0U ) == BOOL_FALSE ) &&
-         ( max_size == BOOL_SIZE ) && ( max.bytes().at( 0U ) == BOOL_TRUE ) )
-    {
-        return Kind::Boolean;
-    }
+    auto const [min_size, min_first] = head( min );
+    auto const [max_size, max_first] = head( max );
 
-    return Kind::Numeric;
+    return fromHeads( min_size, min_first, max_size, max_first );
 }
 
 std::string_view Format::nameOf( Kind const &v ) noexcept
@@ -67,11 +68,7 @@ std::string_view Format::nameOf( Kind const &v ) noexcept
 
 std::string Format::strOf( Kind const &v ) noexcept
 {
-    std::ostringstream oss;
-
-    oss << nameOf( v ) << "(" << static_cast<unsigned>( v ) << ")";
-
-    return oss.str();
+    return std::format( "{}", v );
 }
 
 /* #endregion */// Public methods.
@@ -1,12 +1,16 @@
 #pragma once
 
 /* C++ Standard Library */
+#include <bit>
+#include <cstddef>
 #include <cstdint>
 #include <ostream>
+#include <span>
 #include <string_view>
 #include <string>
 
 /* Custom Library */
+#include <integer_util.hpp>
 #include <value.hpp>
 
 namespace machine::property
@@ -90,6 +94,21 @@ namespace machine::property
         [[nodiscard]]
         static Kind fromValueRange( Value const &min, Value const &max ) noexcept;
 
+        /** @brief Resolve a @ref PropertyFormat::Kind from raw property value range. */
+        /**
+         * @details
+         * Same rules as `fromValueRange( Value const &, Value const & )`,
+         * usable in constant expressions (see `StaticSpec`).
+         *
+         * @param min [in] the raw minimum property value
+         * @param max [in] the raw maximum property value
+         *
+         * @return the determined @ref Kind
+         */
+        [[nodiscard]]
+        static constexpr Kind fromValueRange( std::span<std::byte const> min
+                                            , std::span<std::byte const> max ) noexcept;
+
         /** @brief Returns the enumerator name of the given value. */
         /**
          * @details
@@ -128,6 +147,13 @@ namespace machine::property
         [[nodiscard]]
         static std::string strOf( Kind const &v ) noexcept;
 
+    private:
+
+        /** @brief The rules of `fromValueRange()`, which only need the size and first byte. */
+        [[nodiscard]]
+        static constexpr Kind fromHeads( std::size_t min_size, std::byte min_first
+                                       , std::size_t max_size, std::byte max_first ) noexcept;
+
     /* #endregion */// Static members, Inner types
 
     }; // class Format
@@ -168,5 +194,101 @@ namespace machine::property
         /** @brief Maximum size for string format. */
         constexpr std::uint8_t MAX_STRING_SIZE = UINT8_MAX;
 
+        /** @brief Decodes a 1-4 byte little-endian numeric payload. */
+        /**
+         * @details
+         * `Numeric` values are signed, so the payload is sign-extended from
+         * its size: a 1-byte `0xFF` is -1. Empty or oversized payloads
+         * decode to `0`.
+         *
+         * @param bytes [in] The raw little-endian payload.
+         *
+         * @return The decoded value.
+         */
+        [[nodiscard]]
+        constexpr std::int32_t decodeNumeric( std::span<std::byte const> bytes ) noexcept
+        {
+            return util::toInt32LE( bytes );
+        }
+
+        /** @brief Decodes a 1-4 byte little-endian bitset or boolean payload. */
+        /**
+         * @details
+         * The payload is zero-extended and returned as the same 32 bits, so
+         * a 4-byte mask keeps all its bits. Empty or oversized payloads
+         * decode to `0`.
+         *
+         * @param bytes [in] The raw little-endian payload.
+         *
+         * @return The decoded bits.
+         */
+        [[nodiscard]]
+        constexpr std::int32_t decodeBits( std::span<std::byte const> bytes ) noexcept
+        {
+            return std::bit_cast<std::int32_t>( util::toUInt32LE( bytes ) );
+        }
+
+        /** @brief Decodes a payload as the integer of the given format. */
+        /**
+         * @details
+         * `decodeNumeric()` for `Numeric`, `decodeBits()` otherwise.
+         */
+        [[nodiscard]]
+        constexpr std::int32_t decodeAs( Format::Kind format, std::span<std::byte const> bytes ) noexcept
+        {
+            return ( format == Format::Kind::Numeric ) ? decodeNumeric( bytes ) : decodeBits( bytes );
+        }
+
+        /** @brief Returns the size of the largest valid value of a format in bytes. */
+        [[nodiscard]]
+        constexpr std::uint8_t maxSizeOf( Format::Kind format ) noexcept
+        {
+            switch ( format )
+            {
+
+            case Format::Kind::String:  return MAX_STRING_SIZE;
+            case Format::Kind::BitSet:  return MAX_BITSET_SIZE;
+            case Format::Kind::Boolean: return BOOL_SIZE;
+            default:                    return MAX_NUMERIC_SIZE;
+
+            } // switch ( format )
+        }
+
     } // namespace detail
+
+    /* ^\__________________________________________ */
+    /* #region Inline methods.                      */
+
+    constexpr Format::Kind Format::fromValueRange( std::span<std::byte const> min
+                                                 , std::span<std::byte const> max ) noexcept
+    {
+        return fromHeads( min.size(), min.empty() ? std::byte{ 0x00 } : min[0U]
+                        , max.size(), max.empty() ? std::byte{ 0x00 } : max[0U] );
+    }
+
+    constexpr Format::Kind Format::fromHeads( std::size_t min_size, std::byte min_first
+                                            , std::size_t max_size, std::byte max_first ) noexcept
+    {
+        using namespace detail;
+
+        if ( ( min_size == 0U ) && ( max_size == 0U ) )
+        {
+            return Kind::String;
+        }
+
+        if ( ( min_size == 0U ) && ( max_size != 0U ) )
+        {
+            return Kind::BitSet;
+        }
+
+        if ( ( min_size == BOOL_SIZE ) && ( min_first == BOOL_FALSE ) &&
+             ( max_size == BOOL_SIZE ) && ( max_first == BOOL_TRUE ) )
+        {
+            return Kind::Boolean;
+        }
+
+        return Kind::Numeric;
+    }
+
+    /* #endregion */// Inline methods
 } // namespace machine::property
@@ -0,0 +1,119 @@
+#pragma once
+
+/* C++ Standard Library */
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+/* Custom Library */
+#include <value.hpp>
+
+namespace machine::property
+{
+
+    /** @brief Process-wide pool of shared, immutable payloads. */
+    /**
+     * @details
+     * Identical payloads are stored once and referred to by a 2-byte
+     * `Handle`. `Spec` keeps its initial, minimum and maximum values here,
+     * so thousands of specs with the same bounds (e.g. a 0 to 100
+     * percentage, or a common `String` default) share one copy.
+     *
+     * | Operation   | Cost                                              |
+     * | ----------- | ------------------------------------------------- |
+     * | `intern()`  | copy, then hash lookup; kept only if new          |
+     * | `retain()`  | O(1), no allocation                               |
+     * | `release()` | O(1); frees the payload with the last reference   |
+     * | `valueOf()` | O(1), no locking                                  |
+     *
+     * Entries are reference-counted and live in chunks of `CHUNK_SIZE`
+     * entries that are allocated on demand and never moved, so a
+     * `Value const &` returned by `valueOf()` stays valid while its handle
+     * is held. Like the slabs of `PoolAllocator`, chunks are never returned
+     * to the system. The number of entries is limited by
+     * `CONFIG_MACHINE_INTERN_POOL_CAPACITY`.
+     *
+     * Payloads are copied and freed with the pool lock released; the lock
+     * only guards the entries, buckets and free list.
+     *
+     * The empty payload is not stored; it is always `EMPTY`.
+     *
+     * @attention
+     * An interned value must not be modified. `valueOf()` only hands out
+     * `Value const &`, and the pool relies on it.
+     *
+     * @note ja: 同一のペイロードを共有する参照カウント付きプール。
+     */
+    class InternPool
+    {
+    public:
+        explicit InternPool() noexcept = delete; //!< @brief Default constructor (deleted).
+
+    /* ^\__________________________________________ */
+    /* #region Static members, Inner types.         */
+
+    public:
+
+        /** @brief Reference to an interned payload. */
+        using Handle = std::uint16_t;
+
+        /** @brief The handle of the empty payload; never allocated. */
+        static constexpr Handle EMPTY = 0U;
+
+        /** @brief Number of entries allocated at once. */
+        static constexpr std::size_t CHUNK_SIZE = 32U;
+
+        /* #region Public methods */
+
+        /** @brief Adds a reference to a payload, storing it if it is new. */
+        /**
+         * @param bytes [in] The payload.
+         *
+         * @return The handle, holding one reference; std::nullopt if the
+         *         pool is full or out of memory.
+         */
+        [[nodiscard]]
+        static std::optional<Handle> intern( std::span<std::byte const> bytes ) noexcept;
+
+        /** @brief Adds a reference to the payload of a value. */
+        /**
+         * @details
+         * `v` is locked while its payload is looked up.
+         */
+        [[nodiscard]]
+        static std::optional<Handle> intern( Value const &v ) noexcept;
+
+        /** @brief Adds a reference to an interned payload. */
+        /**
+         * @param h [in] A handle that holds a reference.
+         *
+         * @return `h`.
+         */
+        static Handle retain( Handle h ) noexcept;
+
+        /** @brief Drops a reference, freeing the payload with the last one. */
+        static void release( Handle h ) noexcept;
+
+        /** @brief Returns the interned value. */
+        /**
+         * @param h [in] A handle that holds a reference, or `EMPTY`.
+         */
+        [[nodiscard]]
+        static Value const &valueOf( Handle h ) noexcept;
+
+        /** @brief Returns the number of references to a payload; 0 for `EMPTY`. */
+        [[nodiscard]]
+        static std::uint32_t refCount( Handle h ) noexcept;
+
+        /** @brief Returns the number of distinct payloads stored. */
+        [[nodiscard]]
+        static std::size_t size() noexcept;
+
+        /* #endregion */// Public methods
+
+    /* #endregion */// Static members, Inner types
+
+    }; // class InternPool
+
+} // namespace machine::property
@@ -115,6 +115,20 @@ namespace machine::property
         [[nodiscard]]
         static std::string strOf( Kind const &v ) noexcept;
 
+        /** @brief Returns `true` if the read bit of `v` is set. */
+        [[nodiscard]]
+        static constexpr bool isReadable( Kind const &v ) noexcept
+        {
+            return ( static_cast<std::uint8_t>( v ) & 0b10U ) != 0U;
+        }
+
+        /** @brief Returns `true` if the write bit of `v` is set. */
+        [[nodiscard]]
+        static constexpr bool isWritable( Kind const &v ) noexcept
+        {
+            return ( static_cast<std::uint8_t>( v ) & 0b01U ) != 0U;
+        }
+
     /* #endregion */// Static members, Inner types.
 
     }; // class Permission
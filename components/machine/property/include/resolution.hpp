@@ -1,8 +1,12 @@
 #pragma once
 
 /* C++ Standard Library */
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <ostream>
+#include <span>
 #include <string_view>
 #include <string>
 
@@ -163,7 +167,7 @@ namespace machine::property
          * @return signed shift N
          */
         [[nodiscard]]
-        static std::int8_t shiftOf( Kind const &v ) noexcept;
+        static constexpr std::int8_t shiftOf( Kind const &v ) noexcept;
 
         /** @brief Extracts the coefficient from the given ​​value. */
         /**
@@ -186,7 +190,7 @@ namespace machine::property
          * @return coefficient (1 or 5)
          */
         [[nodiscard]]
-        static std::uint8_t coeffOf( Kind const &v ) noexcept;
+        static constexpr std::uint8_t coeffOf( Kind const &v ) noexcept;
 
         /** @brief Get the real-valued scale factor of the given resolution. */
         /**
@@ -220,20 +224,292 @@ namespace machine::property
          *
          * @note
          * This function introduces floating-point semantics intentionally.
-         * Low-level code may avoid calling this function and instead work
-         * with integer arithmetic using @ref shiftOf and @ref coeffOf.
+         * The factors come from a constant table, but `double` arithmetic is
+         * still emulated in software on ESP32 targets. Low-level code should
+         * use the integer conversions below (@ref toScaled, @ref toMillis,
+         * @ref fromScaled, @ref fromMillis) instead.
          *
          * @param v [in] the `Kind`
          *
          * @return real-valued scale factor
          */
         [[nodiscard]]
-        static double scaleFactorOf( Kind const &v ) noexcept;
+        static constexpr double scaleFactorOf( Kind const &v ) noexcept;
+
+        /** @brief A decimal number `mantissa × 10^exponent`. */
+        struct Scaled
+        {
+            std::int64_t mantissa; //!< Signed integer mantissa.
+            std::int8_t exponent;  //!< Decimal exponent.
+
+            constexpr bool operator==( Scaled const & ) const noexcept = default; //!< Equality operator (default).
+        };
+
+        /** @brief Converts a raw value to an exact decimal number. */
+        /**
+         * @details
+         * Returns `{ raw × coeffOf( v ), shiftOf( v ) }`, which is exact.
+         *
+         * @par Examples:
+         * - `toScaled( 51, Kind::X0_5 )` → `{ 255, -1 }` (25.5)
+         * - `toScaled( 3, Kind::X50 )`   → `{ 15, +1 }`  (150)
+         *
+         * @param raw [in] the raw property value
+         * @param v   [in] the `Kind`
+         *
+         * @return `raw` scaled by the resolution
+         */
+        [[nodiscard]]
+        static constexpr Scaled toScaled( std::int32_t raw, Kind const &v ) noexcept;
+
+        /** @brief Converts a raw value to thousandths of the real-world quantity. */
+        /**
+         * @details
+         * One multiplication by an integer factor from a constant table.
+         * Exact for every resolution, since the finest one is `x0.01`.
+         *
+         * @par Examples:
+         * - `toMillis( 51, Kind::X0_5 )` → `25500` (25.5)
+         * - `toMillis( -7, Kind::X0_01 )` → `-70` (-0.07)
+         *
+         * @param raw [in] the raw property value
+         * @param v   [in] the `Kind`
+         *
+         * @return the real-world quantity × 1000
+         */
+        [[nodiscard]]
+        static constexpr std::int64_t toMillis( std::int32_t raw, Kind const &v ) noexcept;
+
+        /** @brief Converts a decimal number back to a raw value. */
+        /**
+         * @details
+         * Computes `mantissa × 10^exponent / scaleFactorOf( v )` in integer
+         * arithmetic, rounding half away from zero.
+         *
+         * @par Examples:
+         * - `fromScaled( { 255, -1 }, Kind::X0_5 )` → `51`
+         * - `fromScaled( { 26, -1 }, Kind::X0_5 )`  → `5` (2.6 / 0.5 = 5.2)
+         *
+         * @param scaled [in] the real-world quantity
+         * @param v      [in] the `Kind`
+         *
+         * @return the raw property value; std::nullopt if it does not fit
+         *         in `std::int32_t` or the exponent difference to the
+         *         resolution exceeds ±18.
+         */
+        [[nodiscard]]
+        static constexpr std::optional<std::int32_t> fromScaled( Scaled scaled, Kind const &v ) noexcept;
+
+        /** @brief Converts thousandths of the real-world quantity back to a raw value. */
+        /**
+         * @details
+         * Same as `fromScaled( { millis, -3 }, v )`.
+         *
+         * @param millis [in] the real-world quantity × 1000
+         * @param v      [in] the `Kind`
+         *
+         * @return the raw property value; std::nullopt if it does not fit
+         *         in `std::int32_t`.
+         */
+        [[nodiscard]]
+        static constexpr std::optional<std::int32_t> fromMillis( std::int64_t millis, Kind const &v ) noexcept;
+
+        /** @brief Converts raw values to thousandths in one call. */
+        /**
+         * @details
+         * Batch version of `toMillis( std::int32_t, Kind const & )`:
+         * `out[i] = toMillis( raw[i], v )`. The factor is looked up once.
+         *
+         * @param raw [in]  the raw property values
+         * @param v   [in]  the `Kind` shared by all values
+         * @param out [out] the converted values
+         *
+         * @return the number of converted values, `min( raw.size(), out.size() )`
+         */
+        static std::size_t toMillis( std::span<std::int32_t const> raw
+                                   , Kind const &v
+                                   , std::span<std::int64_t> out ) noexcept;
+
+        /** @brief Converts thousandths back to raw values in one call. */
+        /**
+         * @details
+         * Batch version of `fromMillis( std::int64_t, Kind const & )`.
+         * Conversion stops at the first value that does not fit.
+         *
+         * @param millis [in]  the real-world quantities × 1000
+         * @param v      [in]  the `Kind` shared by all values
+         * @param out    [out] the raw property values
+         *
+         * @return the number of converted values; less than
+         *         `min( millis.size(), out.size() )` if a value did not fit.
+         */
+        static std::size_t fromMillis( std::span<std::int64_t const> millis
+                                     , Kind const &v
+                                     , std::span<std::int32_t> out ) noexcept;
 
     /* #endregion */// Static members, Inner types
 
     }; // class Resolution
 
+    namespace detail
+    {
+
+        /** @brief Powers of ten representable in `std::int64_t`. */
+        constexpr std::array<std::int64_t, 19U> POW10 = []() constexpr
+        {
+            std::array<std::int64_t, 19U> table {};
+            std::int64_t p = 1;
+
+            for ( std::int64_t &e : table )
+            {
+                e = p;
+                p *= ( p < INT64_MAX / 10 ) ? 10 : 1;
+            }
+
+            return table;
+        }();
+
+        /** @brief Exponent of the real-world quantity returned by `Resolution::toMillis()`. */
+        constexpr std::int8_t MILLIS_EXPONENT = -3;
+
+    } // namespace detail
+
+    /* ^\__________________________________________ */
+    /* #region Inline methods.                      */
+
+    constexpr std::int8_t Resolution::shiftOf( Kind const &v ) noexcept
+    {
+        auto raw = static_cast<std::uint8_t>( v ); // Note: 0 to 7
+
+        std::uint8_t bit2_bit1 = static_cast<std::uint8_t>( ( raw >> 1 ) & 0b11 ); // Note: 0 to 3
+
+        /* Note: Calculation details.
+            + ------- + ------------------ + ---------------- + ------ +
+            | Step0:  | Step1:             | Step2:           | Step3: |
+            | Origin  | << 6 (as unsigned) | >> 6 (as signed) | Result |
+            + ------- + ------------------ + ---------------- + ------ +
+            |  0b'00  |      0b'0000'0000  |    0b'0000'0000  |    +0  |
+            |  0b'01  |      0b'0100'0000  |    0b'0000'0001  |    +1  |
+            |  0b'10  |      0b'1000'0000  |    0b'1111'1110  |    -2  |
+            |  0b'11  |      0b'1100'0000  |    0b'1111'1111  |    -1  |
+            + ------- + ------------------ + ---------------- + ------ +
+        */
+        return static_cast<std::int8_t>( static_cast<std::int8_t>( bit2_bit1 << 6 ) >> 6 ); // Note: -2 to +1
+    }
+
+    constexpr std::uint8_t Resolution::coeffOf( Kind const &v ) noexcept
+    {
+        auto raw = static_cast<std::uint8_t>( v );
+        auto bit0 = raw & 0b1;
+        return bit0 ? 5U : 1U; // 5 if bit0 == 1, 1 if bit0 == 0
+    }
+
+    namespace detail
+    {
+
+        /** @brief `coeffOf( v ) × 10^( shiftOf( v ) + 3 )`, indexed by the raw `Kind`. */
+        constexpr std::array<std::int32_t, 8U> RESOLUTION_MILLI_FACTORS = []() constexpr
+        {
+            std::array<std::int32_t, 8U> table {};
+
+            for ( std::uint8_t i = 0U; i < table.size(); i++ )
+            {
+                auto const kind = static_cast<Resolution::Kind>( i );
+                table[i] = Resolution::coeffOf( kind )
+                         * static_cast<std::int32_t>( POW10[Resolution::shiftOf( kind ) - MILLIS_EXPONENT] );
+            }
+
+            return table;
+        }();
+
+        /** @brief `coeffOf( v ) × 10^shiftOf( v )`, indexed by the raw `Kind`. */
+        constexpr std::array<double, 8U> RESOLUTION_SCALE_FACTORS = []() constexpr
+        {
+            std::array<double, 8U> table {};
+
+            for ( std::uint8_t i = 0U; i < table.size(); i++ )
+            {
+                table[i] = static_cast<double>( RESOLUTION_MILLI_FACTORS[i] ) / 1000.0;
+            }
+
+            return table;
+        }();
+
+    } // namespace detail
+
+    constexpr double Resolution::scaleFactorOf( Kind const &v ) noexcept
+    {
+        return detail::RESOLUTION_SCALE_FACTORS[static_cast<std::uint8_t>( v ) & 0b111U];
+    }
+
+    constexpr Resolution::Scaled Resolution::toScaled( std::int32_t raw, Kind const &v ) noexcept
+    {
+        return Scaled{ static_cast<std::int64_t>( raw ) * coeffOf( v ), shiftOf( v ) };
+    }
+
+    constexpr std::int64_t Resolution::toMillis( std::int32_t raw, Kind const &v ) noexcept
+    {
+        return static_cast<std::int64_t>( raw )
+             * detail::RESOLUTION_MILLI_FACTORS[static_cast<std::uint8_t>( v ) & 0b111U];
+    }
+
+    constexpr std::optional<std::int32_t> Resolution::fromScaled( Scaled scaled, Kind const &v ) noexcept
+    {
+        using detail::POW10;
+
+        // Note: raw = mantissa × 10^d / coeff, where d = exponent - shift.
+        int const d = scaled.exponent - shiftOf( v );
+        int const max_d = static_cast<int>( POW10.size() ) - 1;
+
+        if ( ( d > max_d ) || ( -d > max_d ) ) { return std::nullopt; }
+        // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on out of range!! ]
+        // [===> Follows: 10^|d| is representable]
+
+        bool const negative = ( scaled.mantissa < 0 );
+        std::uint64_t const magnitude = negative
+            ? ( 0U - static_cast<std::uint64_t>( scaled.mantissa ) )
+            : static_cast<std::uint64_t>( scaled.mantissa );
+
+        std::uint64_t num = magnitude;
+        std::uint64_t den = coeffOf( v );
+
+        if ( d >= 0 )
+        {
+            auto const p = static_cast<std::uint64_t>( POW10[d] );
+            if ( num > UINT64_MAX / p ) { return std::nullopt; }
+            // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on overflow!! ]
+
+            num *= p;
+        }
+        else
+        {
+            den *= static_cast<std::uint64_t>( POW10[-d] );
+        }
+
+        // Note: Round half away from zero.
+        std::uint64_t q = num / den;
+        if ( ( num % den ) * 2U >= den ) { q++; }
+
+        std::uint64_t const limit = negative
+            ? static_cast<std::uint64_t>( INT32_MAX ) + 1U
+            : static_cast<std::uint64_t>( INT32_MAX );
+
+        if ( q > limit ) { return std::nullopt; }
+        // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on overflow!! ]
+        // [===> Follows: Fits in std::int32_t]
+
+        return negative
+            ? static_cast<std::int32_t>( 0U - static_cast<std::uint32_t>( q ) )
+            : static_cast<std::int32_t>( q );
+    }
+
+    constexpr std::optional<std::int32_t> Resolution::fromMillis( std::int64_t millis, Kind const &v ) noexcept
+    {
+        return fromScaled( Scaled{ millis, detail::MILLIS_EXPONENT }, v );
+    }
+
+    /* #endregion */// Inline methods
+
     /** @brief Stream output operator for `Resolution::Kind`. */
     /**
      * @details
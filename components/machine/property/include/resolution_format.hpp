@@ -4,7 +4,10 @@
 #include <resolution.hpp>
 
 /* C++ Standard Library */
+#include <algorithm>
+#include <cstdint>
 #include <format>
+#include <string_view>
 
 namespace std {
 
@@ -43,16 +46,18 @@ namespace std {
          * @return Iterator to the end of the formatted output.
          */
         template <typename FormatContext>
-        auto format( Resolution::Kind const &v, FormatContext &ctx ) const
+        auto format( Resolution::Kind const &v, FormatContext &ctx ) const noexcept
         {
-            std::string str = Resolution::strOf( v );
-            
-            for ( char c : str )
-            {
-                *ctx.out()++ = c;
-            }
-
-            return ctx.out();
+            // Note: Raw values are at most 3 bits wide, i.e. a single digit.
+            std::string_view const name = Resolution::nameOf( v );
+
+            auto out = std::copy( name.begin(), name.end(), ctx.out() );
+
+            *out++ = '(';
+            *out++ = static_cast<char>( '0' + static_cast<std::uint8_t>( v ) );
+            *out++ = ')';
+
+            return out;
         }
     };
 
@@ -1,21 +1,148 @@
 #pragma once
 
 /* C++ Standard Library */
+#include <array>
+#include <bit>
 #include <cstddef>
 #include <cstdint>
 #include <optional>
 #include <ostream>
+#include <span>
 #include <string>
 
 /* Custom Library */
 #include <format.hpp>
+#include <intern_pool.hpp>
 #include <permission.hpp>
 #include <resolution.hpp>
 #include <value.hpp>
 
+namespace machine
+{
+    class DiagLog;
+    class PropertyTable;
+}
+
 namespace machine::property
 {
 
+    namespace detail
+    {
+
+        /** @brief Decoded bounds of a `Spec`, see `Spec::Bounds`. */
+        struct RangeBounds
+        {
+            std::int32_t lo; //!< Lower bound.
+            std::int32_t hi; //!< Upper bound or bitmask.
+        };
+
+        /** @brief Derives the bounds of a format from its decoded minimum and maximum values. */
+        /**
+         * @param format [in] The format of the spec.
+         * @param min    [in] The decoded minimum value.
+         * @param max    [in] The decoded maximum value.
+         *
+         * @return The bounds used by the range checks.
+         */
+        [[nodiscard]]
+        constexpr RangeBounds rangeOf( Format::Kind format
+                                     , std::int32_t min
+                                     , std::int32_t max ) noexcept
+        {
+            switch ( format )
+            {
+
+            case Format::Kind::Numeric:
+                return { min, max };
+
+            case Format::Kind::Boolean:
+                return { std::to_integer<std::int32_t>( BOOL_FALSE )
+                       , std::to_integer<std::int32_t>( BOOL_TRUE ) };
+
+            case Format::Kind::BitSet:
+                return { 0, max };
+
+            case Format::Kind::String:
+                return { 1, MAX_STRING_SIZE };
+
+            default:
+                return { 0, 0 }; // Note: Unknown format, nothing is in range.
+
+            } // switch ( format )
+        }
+
+        /** @brief Checks a decoded value against the bounds of a format. */
+        /**
+         * @see Spec::isWithinRange( std::int32_t ) for the conditions.
+         */
+        [[nodiscard]]
+        constexpr bool isWithinBounds( Format::Kind format
+                                     , RangeBounds bounds
+                                     , std::int32_t n ) noexcept
+        {
+            switch ( format )
+            {
+
+            case Format::Kind::Numeric:
+            case Format::Kind::Boolean:
+                return ( bounds.lo <= n ) && ( n <= bounds.hi );
+
+            case Format::Kind::BitSet:
+                return ( n & ~bounds.hi ) == 0; // Note: No bits outside the mask.
+
+            case Format::Kind::String:
+                return false; // Note: Not an integer format.
+
+            default:
+                return false; // Note: Unknown format.
+
+            } // switch ( format )
+        }
+
+        /** @brief Checks a raw value against the bounds of a format. */
+        /**
+         * @see Spec::isWithinRange( std::span<std::byte const> ) for the conditions.
+         */
+        [[nodiscard]]
+        constexpr bool isWithinBounds( Format::Kind format
+                                     , RangeBounds bounds
+                                     , std::span<std::byte const> bytes ) noexcept
+        {
+            std::size_t const size = bytes.size();
+
+            if ( size == 0U )
+            {
+                return false; // Note: Must not be empty.
+            }
+
+            switch ( format )
+            {
+
+            case Format::Kind::String:
+                return ( size <= MAX_STRING_SIZE );
+
+            case Format::Kind::BitSet:
+                return ( size <= MAX_BITSET_SIZE )
+                    && isWithinBounds( format, bounds, decodeBits( bytes ) );
+
+            case Format::Kind::Boolean:
+                return ( size == BOOL_SIZE )
+                    && isWithinBounds( format, bounds, decodeBits( bytes ) );
+
+            case Format::Kind::Numeric:
+                return ( size <= MAX_NUMERIC_SIZE )
+                    && isWithinBounds( format, bounds, decodeNumeric( bytes ) );
+
+            default:
+                return false; // Note: Unknown format.
+
+            } // switch ( format )
+        }
+
+    } // namespace detail
+
+    class StaticSpec;
+
     /** @brief Represents a property specification. */
     /**
      * @details
@@ -51,6 +178,14 @@ namespace machine::property
      *           ただし、`BitSet`の場合はビットマスクとして使用します。
      *           その値は、定義済ビットは全て1、未定義ビットは0になっています。
      *
+     * @par Shared values:
+     * The three values are kept in `InternPool` and referred to by handle,
+     * so specs with identical values share one copy of each payload, and
+     * `clone()` neither allocates nor copies.
+     *
+     * @note ja: 値は`InternPool`で共有されるため、同じ値を持つ`Spec`同士で
+     *           ペイロードが重複しません。
+     *
      * @par Hierarchy:
      * - Machine
      *   - `Unit[]` (unique: kind, index)
@@ -149,19 +284,35 @@ namespace machine::property
                                          , Value const &init_val
                                          , Value const &min_val
                                          , Value const &max_val ) noexcept;
-        
+
+        /** @brief Create a Spec instance from a compile-time `StaticSpec`. */
+        /**
+         * @details
+         * Copies the values of `spec` into a runtime `Spec`. Only needed
+         * where a `Spec` object is required; `StaticSpec` itself offers the
+         * same read accessors without leaving flash.
+         *
+         * @param spec compile-time property specification
+         *
+         * @return Spec instance if the values could be copied; std::nullopt otherwise.
+         */
+        static std::optional<Spec> create( StaticSpec const &spec ) noexcept;
+
     private:
 
         static std::optional<Spec> create( Permission::Kind permission
                                          , Resolution::Kind resolution
-                                         , std::optional<Value> &&init
-                                         , std::optional<Value> &&min
-                                         , std::optional<Value> &&max ) noexcept;
+                                         , std::optional<InternPool::Handle> init
+                                         , std::optional<InternPool::Handle> min
+                                         , std::optional<InternPool::Handle> max ) noexcept;
 
         /* #endregion */// Factory methods
 
     private:
 
+        friend class machine::DiagLog;       // Note: Logs and decodes the raw `Fragments` byte.
+        friend class machine::PropertyTable; // Note: Keeps the raw `Fragments` byte in a column of its own.
+
         struct Fragments
         {
             std::uint8_t format : 2;
@@ -170,6 +321,58 @@ namespace machine::property
             std::uint8_t reserved : 1;
         };
 
+        /** @brief Bounds decoded once at creation time. */
+        /**
+         * @details
+         * Holds the bounds of the `Spec` as native `std::int32_t` values so
+         * that range checks need neither locking nor decoding.
+         * They are stored byte-wise to keep `Spec` 1-byte aligned.
+         *
+         * | Format    | lower                   | upper                     |
+         * | --------- | ----------------------- | ------------------------- |
+         * | `Numeric` | decoded minimum value   | decoded maximum value     |
+         * | `Boolean` | `0`                     | `1`                       |
+         * | `BitSet`  | `0`                     | decoded bitmask           |
+         * | `String`  | `1` (minimum size)      | `MAX_STRING_SIZE`         |
+         *
+         * `Numeric` values are decoded signed, the bitmask unsigned, see
+         * `detail::decodeAs()`.
+         */
+        struct Bounds
+        {
+            std::array<std::byte, sizeof( std::int32_t )> lower;
+            std::array<std::byte, sizeof( std::int32_t )> upper;
+
+            static constexpr Bounds of( std::int32_t lo, std::int32_t hi ) noexcept
+            {
+                using Bytes = std::array<std::byte, sizeof( std::int32_t )>;
+                return { std::bit_cast<Bytes>( lo ), std::bit_cast<Bytes>( hi ) };
+            }
+
+            constexpr std::int32_t lo() const noexcept { return std::bit_cast<std::int32_t>( lower ); }
+            constexpr std::int32_t hi() const noexcept { return std::bit_cast<std::int32_t>( upper ); }
+
+            constexpr detail::RangeBounds range() const noexcept { return { lo(), hi() }; }
+        };
+
+        /** @brief An `InternPool::Handle`, stored byte-wise to keep `Spec` 1-byte aligned. */
+        struct Interned
+        {
+            std::array<std::byte, sizeof( InternPool::Handle )> raw;
+
+            static constexpr Interned of( InternPool::Handle h ) noexcept
+            {
+                return { std::bit_cast<std::array<std::byte, sizeof( InternPool::Handle )>>( h ) };
+            }
+
+            constexpr InternPool::Handle handle() const noexcept
+            {
+                return std::bit_cast<InternPool::Handle>( raw );
+            }
+
+            Value const &value() const noexcept { return InternPool::valueOf( handle() ); }
+        };
+
     /* #endregion */// Static members, Inner types
 
     /* ^\__________________________________________ */
@@ -177,16 +380,17 @@ namespace machine::property
 
     public:
 
-        ~Spec() noexcept = default;             //!< Destructor (default).
-        Spec( const Spec & ) noexcept = delete; //!< Copy constructor (deleted).
-        Spec( Spec && ) noexcept = default;     //!< Move constructor (default).
+        ~Spec() noexcept;                       //!< Destructor (releases the values).
+        Spec( const Spec & ) noexcept = delete; //!< Copy constructor (deleted), see `clone()`.
+        Spec( Spec &&other ) noexcept;          //!< Move constructor.
 
     private:
 
         explicit Spec( Fragments frags
-                     , Value &&init_val
-                     , Value &&min_val
-                     , Value &&max_val ) noexcept;
+                     , Bounds bounds
+                     , InternPool::Handle init_val
+                     , InternPool::Handle min_val
+                     , InternPool::Handle max_val ) noexcept;
 
     /* #endregion */// Constructors
 
@@ -196,7 +400,7 @@ namespace machine::property
     public:
 
         Spec &operator=( Spec const & ) noexcept = delete;          //!< Copy operator (deleted).
-        Spec &operator=( Spec && ) noexcept = default;              //!< Move operator (default).
+        Spec &operator=( Spec &&other ) noexcept;                   //!< Move operator.
         bool constexpr operator==( Spec const & ) const noexcept = delete;  //!< Equality operator (deleted).
         auto constexpr operator<=>( Spec const & ) const noexcept = delete; //!< Three-way comparison operator (deleted).
 
@@ -215,6 +419,9 @@ namespace machine::property
          * This method checks whether the provided value falls within the
          * minimum and maximum values defined in the `Spec`.
          *
+         * Only `v` is locked, and only while its payload is read.
+         * No memory is allocated.
+         *
          * @param v [in] The value to check.
          *
          * @return `true` if the value is within range; `false` otherwise.
@@ -222,6 +429,66 @@ namespace machine::property
         [[nodiscard]]
         bool isWithinRange( Value const &v ) const noexcept;
 
+        /** @brief Checks if the given raw value is within the range specified by the `Spec`. */
+        /**
+         * @details
+         * Same as `isWithinRange(Value const &)`, but for a raw little-endian
+         * payload such as one received from the external machine.
+         *
+         * @param bytes [in] The raw value to check.
+         *
+         * @return `true` if the value is within range; `false` otherwise.
+         */
+        [[nodiscard]]
+        bool isWithinRange( std::span<std::byte const> bytes ) const noexcept;
+
+        /** @brief Checks if the given decoded value is within the range specified by the `Spec`. */
+        /**
+         * @details
+         * Compares `n` against the bounds decoded at creation time.
+         * Neither locking nor decoding is performed.
+         *
+         * | Format    | Condition                          |
+         * | --------- | ---------------------------------- |
+         * | `Numeric` | `min <= n && n <= max`             |
+         * | `Boolean` | `n == 0 \|\| n == 1`               |
+         * | `BitSet`  | `n` has no bits outside the mask   |
+         * | `String`  | always `false` (not an integer)    |
+         *
+         * @param n [in] The decoded value to check.
+         *
+         * @return `true` if the value is within range; `false` otherwise.
+         */
+        [[nodiscard]]
+        bool isWithinRange( std::int32_t n ) const noexcept;
+
+        /** @brief Creates a copy that shares the values of this `Spec`. */
+        /**
+         * @details
+         * Only reference counts are incremented; nothing is allocated.
+         *
+         * @return The copy.
+         */
+        [[nodiscard]]
+        Spec clone() const noexcept;
+
+        /** @brief Checks if both specs are identical in every item. */
+        /**
+         * @details
+         * Because the values are interned, identical values have identical
+         * handles, so this compares 15 bytes and locks nothing.
+         *
+         * @param other [in] The spec to compare with.
+         *
+         * @return `true` if all items are identical; `false` otherwise.
+         */
+        [[nodiscard]]
+        bool isSameAs( Spec const &other ) const noexcept;
+
+        /** @brief Returns a hash consistent with `isSameAs()`. */
+        [[nodiscard]]
+        std::uint32_t hash() const noexcept;
+
         /** @brief Returns a string representation of the `Spec`. */
         /**
          * @details
@@ -233,6 +500,9 @@ namespace machine::property
          *   initial_value: [ 0x0A ], minimum_value: [ 0x00 ], maximum_value: [ 0x00 0x04 ] }
          * \endcode
          *
+         * @note This allocates the returned string. To format into a caller
+         *       buffer instead, use `util::formatTo()` with `spec_format.hpp`.
+         *
          * @return String representation of the `Spec`.
          */
         [[nodiscard]]
@@ -261,13 +531,27 @@ namespace machine::property
         }
 
         [[nodiscard]]
-        Value const &initVal() const noexcept { return initVal_; }
+        Value const &initVal() const noexcept { return initVal_.value(); }
+
+        [[nodiscard]]
+        Value const &minVal() const noexcept { return minVal_.value(); }
+
+        [[nodiscard]]
+        Value const &maxVal() const noexcept { return maxVal_.value(); }
 
+        /** @brief Returns the lower bound decoded at creation time. */
+        /**
+         * @see Bounds for the meaning per format.
+         */
         [[nodiscard]]
-        Value const &minVal() const noexcept { return minVal_; }
+        std::int32_t lowerBound() const noexcept { return bounds_.lo(); }
 
+        /** @brief Returns the upper bound decoded at creation time. */
+        /**
+         * @see Bounds for the meaning per format.
+         */
         [[nodiscard]]
-        Value const &maxVal() const noexcept { return maxVal_; }
+        std::int32_t upperBound() const noexcept { return bounds_.hi(); }
 
         /* #endregion */// Getter methods
 
@@ -275,18 +559,25 @@ namespace machine::property
 
         /* #region : Private methods */
 
-        std::int32_t decodeNumericValue( Value const &v ) const noexcept;
+        void releaseValues() noexcept;
+
+        static std::int32_t decodeValueAs( Format::Kind format, Value const &v ) noexcept;
+
+        static Bounds boundsOf( Format::Kind format
+                              , Value const &min_val
+                              , Value const &max_val ) noexcept;
 
         /* #endregion */ // Private methods
 
         /* #region : member variables */
 
         Fragments frags_;   // 1 bytes
-        Value initVal_;     // 6 bytes
-        Value minVal_;      // 6 bytes
-        Value maxVal_;      // 6 bytes
+        Bounds bounds_;     // 8 bytes
+        Interned initVal_;  // 2 bytes
+        Interned minVal_;   // 2 bytes
+        Interned maxVal_;   // 2 bytes
         // ---------------------------------
-        //             Total: 19 bytes
+        //             Total: 15 bytes
 
         /* #endregion */
 
@@ -309,7 +600,7 @@ namespace machine::property
 
     /* ^\__________________________________________ */
     /* Static assertions.                           */
-    static_assert( sizeof(machine::property::Spec) == 19, "Unexpected Spec size" );
+    static_assert( sizeof(machine::property::Spec) == 15, "Unexpected Spec size" );
     static_assert( alignof(machine::property::Spec) == 1, "Unexpected Spec alignment" );
 
 } // namespace machine
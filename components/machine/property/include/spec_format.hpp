@@ -6,6 +6,28 @@
 /* C++ Standard Library */
 #include <format>
 
+/* Custom Library */
+#include <format_format.hpp>
+#include <permission_format.hpp>
+#include <resolution_format.hpp>
+#include <value255_format.hpp>
+
+namespace machine::property::detail
+{
+
+    /** @brief Format string of a `Spec`, shared with decoders of binary log records. */
+    /**
+     * @details
+     * Arguments: format, permission, resolution, initial, minimum and
+     * maximum value.
+     */
+    inline constexpr char SPEC_FORMAT[] =
+        "{{ format: {}, permission: {}, resolution: {}"
+        ", initial_value: {}, minimum_value: {}, maximum_value: {} }}";
+
+} // namespace machine::property::detail
+
+
 namespace std
 {
 
@@ -19,6 +41,9 @@ namespace std
      *   will be formatted as:
      *   `{ format: numeric(0), permission: read-write(3), resolution: x1(0),
      *     initial_value: [ 0x0A ], minimum_value: [ 0x00 ], maximum_value: [ 0x00 0x04 ] }`
+     *
+     * Every field is written by its own formatter directly to the output
+     * iterator; no intermediate `std::string` is built.
      */
     template <>
     struct formatter<machine::property::Spec>
@@ -32,7 +57,8 @@ namespace std
          * @return Iterator pointing to the next character to be parsed
          *         (no specifiers are consumed).
          */
-        constexpr auto parse( std::format_parse_context &ctx )
+        constexpr auto parse( std::format_parse_context &ctx ) const noexcept
+            -> const char *
         {
             return ctx.begin();
         }
@@ -45,16 +71,12 @@ namespace std
          * @return Iterator to the end of the formatted output.
          */
         template <typename FormatContext>
-        auto format( Spec const &v, FormatContext &ctx ) const
+        auto format( Spec const &v, FormatContext &ctx ) const noexcept
         {
-            std::string str = v.str();
-            
-            for ( char c : str )
-            {
-                *ctx.out()++ = c;
-            }
-
-            return ctx.out();
+            return std::format_to( ctx.out()
+                , machine::property::detail::SPEC_FORMAT
+                , v.format(), v.permission(), v.resolution()
+                , v.initVal(), v.minVal(), v.maxVal() );
         }
     };
 
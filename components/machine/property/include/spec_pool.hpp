@@ -0,0 +1,102 @@
+#pragma once
+
+/* C++ Standard Library */
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+/* Custom Library */
+#include <spec.hpp>
+
+namespace machine::property
+{
+
+    /** @brief Process-wide registry of distinct specs. */
+    /**
+     * @details
+     * A machine typically has thousands of properties but only a few
+     * hundred distinct specs. The pool keeps each distinct `Spec` once and
+     * refers to it by a 2-byte `Handle`, so a property can store the handle
+     * instead of the spec (see `CompactProperty`).
+     *
+     * Specs are keyed by `Spec::hash()` and compared with `Spec::isSameAs()`.
+     * Both work on the fragments, the decoded bounds and the `InternPool`
+     * handles of the values, so registering a spec neither locks nor reads
+     * any payload. The spec is cloned, and a dropped one destroyed, with
+     * the pool lock released, so that lock is never held while
+     * `InternPool` is entered.
+     *
+     * Entries are reference-counted and live in chunks of `CHUNK_SIZE`
+     * entries that are allocated on demand and never moved, as in
+     * `InternPool`. The number of entries is limited by
+     * `CONFIG_MACHINE_SPEC_POOL_CAPACITY`.
+     *
+     * @note ja: 重複しない`Spec`を2バイトのハンドルで共有するレジストリ。
+     */
+    class SpecPool
+    {
+    public:
+        explicit SpecPool() noexcept = delete; //!< @brief Default constructor (deleted).
+
+    /* ^\__________________________________________ */
+    /* #region Static members, Inner types.         */
+
+    public:
+
+        /** @brief Reference to a registered spec. */
+        using Handle = std::uint16_t;
+
+        /** @brief A handle that refers to no spec. */
+        static constexpr Handle NONE = 0U;
+
+        /** @brief Number of entries allocated at once. */
+        static constexpr std::size_t CHUNK_SIZE = 32U;
+
+        /* #region Public methods */
+
+        /** @brief Adds a reference to a spec, registering it if it is new. */
+        /**
+         * @details
+         * A new spec is stored with `Spec::clone()`, which does not allocate.
+         *
+         * @param spec [in] The spec.
+         *
+         * @return The handle, holding one reference; std::nullopt if the
+         *         pool is full or out of memory.
+         */
+        [[nodiscard]]
+        static std::optional<Handle> intern( Spec const &spec ) noexcept;
+
+        /** @brief Adds a reference to a registered spec. */
+        /**
+         * @param h [in] A handle that holds a reference.
+         *
+         * @return `h`.
+         */
+        static Handle retain( Handle h ) noexcept;
+
+        /** @brief Drops a reference, removing the spec with the last one. */
+        static void release( Handle h ) noexcept;
+
+        /** @brief Returns the registered spec. */
+        /**
+         * @param h [in] A handle that holds a reference; not `NONE`.
+         */
+        [[nodiscard]]
+        static Spec const &specOf( Handle h ) noexcept;
+
+        /** @brief Returns the number of references to a spec; 0 for `NONE`. */
+        [[nodiscard]]
+        static std::uint32_t refCount( Handle h ) noexcept;
+
+        /** @brief Returns the number of distinct specs registered. */
+        [[nodiscard]]
+        static std::size_t size() noexcept;
+
+        /* #endregion */// Public methods
+
+    /* #endregion */// Static members, Inner types
+
+    }; // class SpecPool
+
+} // namespace machine::property
@@ -0,0 +1,354 @@
+#pragma once
+
+/* C++ Standard Library */
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+/* Custom Library */
+#include <format.hpp>
+#include <permission.hpp>
+#include <resolution.hpp>
+#include <spec.hpp>
+#include <value.hpp>
+
+namespace machine::property
+{
+
+    namespace detail
+    {
+
+        /** @brief Rejects an invalid `StaticSpec` at compile time. */
+        /**
+         * @details
+         * Deliberately not `constexpr`: reaching a call in a `consteval`
+         * factory makes the program ill-formed, and the compiler reports
+         * `reason` together with the offending call.
+         *
+         * @param reason [in] Why the spec is invalid.
+         */
+        inline void rejectStaticSpec( [[maybe_unused]] char const *reason ) noexcept
+        { /* Do nothing */ }
+
+    } // namespace detail
+
+    /** @brief Compile-time property specification. */
+    /**
+     * @details
+     * A literal counterpart of `Spec` for catalogs that are known at build
+     * time. Instances are created by `consteval` factories, so a `constexpr`
+     * `StaticSpec` (or an array of them) is emitted as constant data into
+     * `.rodata`, which resides in flash on ESP32 targets. Neither heap nor
+     * DRAM is used, and nothing runs at boot.
+     *
+     * The factories apply the same rules as `Spec::create()`:
+     *
+     * - The format is resolved by `Format::fromValueRange()`.
+     * - The bounds are derived exactly as in `Spec`.
+     *
+     * In addition, the following specs are rejected at compile time:
+     *
+     * - `Numeric` without a maximum value, or with minimum > maximum.
+     * - An initial value that is not within range.
+     * - A string initial value longer than `MAX_STRING_SIZE`.
+     * - A typed factory whose values resolve to a different format,
+     *   e.g. `numeric<std::uint8_t>( ..., 0, 0, 1 )`, which is `Boolean`.
+     *
+     * The read accessors have the same names and semantics as those of
+     * `Spec`, so code can be written once for both. Use
+     * `Spec::create( StaticSpec const & )` where a `Spec` object is needed.
+     *
+     * @par Example:
+     * \code{.cpp}
+     * constexpr StaticSpec TEMPERATURE =
+     *     StaticSpec::numeric<std::int16_t>( Permission::Kind::ReadOnly
+     *                                      , Resolution::Kind::X0_5
+     *                                      , 50, 0, 200 );
+     * static_assert( TEMPERATURE.isWithinRange( 120 ) );
+     * \endcode
+     *
+     * @note ja: ビルド時に確定するプロパティ仕様。フラッシュ上の定数データとして配置されます。
+     */
+    class StaticSpec
+    {
+    /* ^\__________________________________________ */
+    /* #region Static members, Inner types.         */
+
+    public:
+
+        /** @brief Raw little-endian payload of up to 4 bytes. */
+        struct Raw
+        {
+            std::array<std::byte, detail::MAX_NUMERIC_SIZE> bytes {}; //!< Payload, little-endian.
+            std::uint8_t size = 0U;                                 //!< Payload size in bytes.
+
+            /** @brief An empty payload. */
+            static consteval Raw none() noexcept { return Raw{}; }
+
+            /** @brief Encodes `v` as `sizeof( T )` little-endian bytes. */
+            template <std::integral T>
+            static consteval Raw of( T v ) noexcept
+            {
+                static_assert( sizeof( T ) <= detail::MAX_NUMERIC_SIZE, "At most 4 bytes" );
+
+                Raw raw;
+                auto u = static_cast<std::make_unsigned_t<T>>( v );
+
+                for ( std::size_t i = 0U; i < sizeof( T ); i++ )
+                {
+                    raw.bytes[i] = static_cast<std::byte>( ( u >> ( 8U * i ) ) & 0xFFU );
+                }
+                raw.size = sizeof( T );
+
+                return raw;
+            }
+
+            /** @brief Uses the given bytes as they are. */
+            static consteval Raw of( std::initializer_list<std::uint8_t> list ) noexcept
+            {
+                Raw raw;
+
+                if ( list.size() > detail::MAX_NUMERIC_SIZE )
+                {
+                    detail::rejectStaticSpec( "A raw payload has at most 4 bytes" );
+                }
+
+                for ( std::uint8_t const b : list )
+                {
+                    raw.bytes[raw.size++] = static_cast<std::byte>( b );
+                }
+
+                return raw;
+            }
+
+            /** @brief Returns the payload as bytes. */
+            [[nodiscard]]
+            constexpr std::span<std::byte const> span() const noexcept
+            {
+                return std::span<std::byte const>( bytes.data(), size );
+            }
+        };
+
+        /* #region Factory methods */
+
+        /** @brief Create a StaticSpec from raw values. */
+        /**
+         * @details
+         * Compile-time counterpart of `Spec::create()` with raw values.
+         * Invalid specs do not compile.
+         *
+         * @param permission value access permission
+         * @param resolution value resolution
+         * @param init initial property value
+         * @param min  minimum property value
+         * @param max  maximum property value
+         *
+         * @return StaticSpec instance.
+         */
+        static consteval StaticSpec create( Permission::Kind permission
+                                          , Resolution::Kind resolution
+                                          , Raw init
+                                          , Raw min
+                                          , Raw max ) noexcept
+        {
+            return StaticSpec( permission, resolution, init, min, max, std::string_view{} );
+        }
+
+        /** @brief Create a `Numeric` StaticSpec encoded as `sizeof( T )` bytes. */
+        template <std::integral T>
+        static consteval StaticSpec numeric( Permission::Kind permission
+                                           , Resolution::Kind resolution
+                                           , T init, T min, T max ) noexcept
+        {
+            StaticSpec const spec = create( permission, resolution
+                                          , Raw::of( init ), Raw::of( min ), Raw::of( max ) );
+
+            if ( spec.format() != Format::Kind::Numeric )
+            {
+                detail::rejectStaticSpec( "The values resolve to another format than Numeric" );
+            }
+
+            return spec;
+        }
+
+        /** @brief Create a `BitSet` StaticSpec encoded as `sizeof( T )` bytes. */
+        template <std::unsigned_integral T>
+        static consteval StaticSpec bitset( Permission::Kind permission
+                                          , T init, T mask ) noexcept
+        {
+            return create( permission, Resolution::Kind::X1
+                         , Raw::of( init ), Raw::none(), Raw::of( mask ) );
+        }
+
+        /** @brief Create a `Boolean` StaticSpec. */
+        static consteval StaticSpec boolean( Permission::Kind permission
+                                           , bool init ) noexcept
+        {
+            return create( permission, Resolution::Kind::X1
+                         , Raw::of( { static_cast<std::uint8_t>( init ) } )
+                         , Raw::of( { std::to_integer<std::uint8_t>( detail::BOOL_FALSE ) } )
+                         , Raw::of( { std::to_integer<std::uint8_t>( detail::BOOL_TRUE ) } ) );
+        }
+
+        /** @brief Create a `String` StaticSpec. */
+        /**
+         * @param permission value access permission
+         * @param init initial value; must refer to static storage,
+         *             typically a string literal.
+         *
+         * @return StaticSpec instance.
+         */
+        static consteval StaticSpec string( Permission::Kind permission
+                                          , std::string_view init ) noexcept
+        {
+            return StaticSpec( permission, Resolution::Kind::X1
+                             , Raw::none(), Raw::none(), Raw::none(), init );
+        }
+
+        /* #endregion */// Factory methods
+
+    /* #endregion */// Static members, Inner types
+
+    /* ^\__________________________________________ */
+    /* #region Constructors.                        */
+
+    private:
+
+        consteval StaticSpec( Permission::Kind permission
+                            , Resolution::Kind resolution
+                            , Raw init
+                            , Raw min
+                            , Raw max
+                            , std::string_view text ) noexcept
+            : format_( Format::fromValueRange( min.span(), max.span() ) )
+            , permission_( permission )
+            , resolution_( resolution )
+            , init_( init )
+            , min_( min )
+            , max_( max )
+            , text_( text )
+            , bounds_( detail::rangeOf( format_
+                                      , detail::decodeAs( format_, min.span() )
+                                      , detail::decodeAs( format_, max.span() ) ) )
+        {
+            if ( ( format_ == Format::Kind::Numeric ) && ( max.size == 0U ) )
+            {
+                detail::rejectStaticSpec( "Numeric requires a maximum value" );
+            }
+
+            if ( ( format_ == Format::Kind::Numeric ) && ( bounds_.lo > bounds_.hi ) )
+            {
+                detail::rejectStaticSpec( "The minimum value exceeds the maximum value" );
+            }
+
+            if ( text.size() > detail::MAX_STRING_SIZE )
+            {
+                detail::rejectStaticSpec( "The initial value exceeds MAX_STRING_SIZE" );
+            }
+
+            if ( ( init.size != 0U ) &&
+                 !detail::isWithinBounds( format_, bounds_, init.span() ) )
+            {
+                detail::rejectStaticSpec( "The initial value is not within range" );
+            }
+        }
+
+    /* #endregion */// Constructors
+
+    /* ^\__________________________________________ */
+    /* #region Instance members.                    */
+
+    public:
+
+        /* #region Public methods */
+
+        /** @copydoc Spec::isWithinRange( Value const & ) */
+        [[nodiscard]]
+        bool isWithinRange( Value const &v ) const noexcept
+        {
+            Value::View const view = v.view();
+            // [===> Follows: Locked]
+
+            return isWithinRange( view.span() );
+        }
+
+        /** @copydoc Spec::isWithinRange( std::span<std::byte const> ) */
+        [[nodiscard]]
+        constexpr bool isWithinRange( std::span<std::byte const> bytes ) const noexcept
+        {
+            return detail::isWithinBounds( format_, bounds_, bytes );
+        }
+
+        /** @copydoc Spec::isWithinRange( std::int32_t ) */
+        [[nodiscard]]
+        constexpr bool isWithinRange( std::int32_t n ) const noexcept
+        {
+            return detail::isWithinBounds( format_, bounds_, n );
+        }
+
+        /* #endregion */// Public methods
+
+        /* #region Getter methods */
+
+        [[nodiscard]]
+        constexpr Format::Kind format() const noexcept { return format_; }
+
+        [[nodiscard]]
+        constexpr Permission::Kind permission() const noexcept { return permission_; }
+
+        [[nodiscard]]
+        constexpr Resolution::Kind resolution() const noexcept { return resolution_; }
+
+        [[nodiscard]]
+        constexpr std::int32_t lowerBound() const noexcept { return bounds_.lo; }
+
+        [[nodiscard]]
+        constexpr std::int32_t upperBound() const noexcept { return bounds_.hi; }
+
+        /** @brief Returns the raw initial value. */
+        [[nodiscard]]
+        std::span<std::byte const> initBytes() const noexcept
+        {
+            if ( !text_.empty() )
+            {
+                return std::as_bytes( std::span<char const>( text_ ) );
+            }
+
+            return init_.span();
+        }
+
+        /** @brief Returns the raw minimum value. */
+        [[nodiscard]]
+        constexpr std::span<std::byte const> minBytes() const noexcept { return min_.span(); }
+
+        /** @brief Returns the raw maximum value. */
+        [[nodiscard]]
+        constexpr std::span<std::byte const> maxBytes() const noexcept { return max_.span(); }
+
+        /* #endregion */// Getter methods
+
+    private:
+
+        /* #region Member variables */
+
+        Format::Kind format_;
+        Permission::Kind permission_;
+        Resolution::Kind resolution_;
+        Raw init_;                  //!< Initial value unless `text_` is used.
+        Raw min_;
+        Raw max_;
+        std::string_view text_;     //!< Initial value of a `String`, in static storage.
+        detail::RangeBounds bounds_;
+
+        /* #endregion */// Member variables
+
+    /* #endregion */// Instance members
+
+    }; // class StaticSpec
+
+} // namespace machine::property
@@ -0,0 +1,101 @@
+#pragma once
+
+/* C++ Standard Library */
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+/* Custom Library */
+#include <spec.hpp>
+#include <value.hpp>
+
+namespace machine::property
+{
+
+    /** @brief Validates many property values in one call. */
+    /**
+     * @details
+     * Batch counterpart of `Spec::isWithinRange(Value const &)` for ingest
+     * paths that receive many values at once, e.g. one frame per component.
+     *
+     * Values are processed in chunks of `CHUNK_SIZE`:
+     *
+     * 1. **Gather**: each value is locked once, and only its size and up to
+     *    4 bytes are sampled. Each sample is appended, together with the
+     *    bounds cached in its `Spec`, to a contiguous lane for its format.
+     * 2. **Compare**: a branch-free integer loop runs over each lane.
+     *
+     * | Format    | Lane  | Sample    | Condition                |
+     * | --------- | ----- | --------- | ------------------------ |
+     * | `Numeric` | range | value     | `lo <= n && n <= hi`     |
+     * | `Boolean` | range | value     | `lo <= n && n <= hi`     |
+     * | `String`  | range | size      | `lo <= n && n <= hi`     |
+     * | `BitSet`  | mask  | value     | `( n & ~hi ) == 0`       |
+     *
+     * Sizes are checked as in `Spec::isWithinRange()`, so every result is
+     * identical to the result of the one-at-a-time check.
+     *
+     * @note ja: 多数のプロパティ値をまとめて検証します。
+     *
+     * @attention
+     * - A value must not be locked by the caller while it is validated.
+     * - The compare loops are plain C++. This project is only built for the
+     *   esp32c6 and Linux targets, which have no SIMD extension for them.
+     *   The ESP32-S3 (PIE) and ESP32-P4 do; such a path would go behind
+     *   `CONFIG_IDF_TARGET_ESP32S3` / `CONFIG_IDF_TARGET_ESP32P4`, with these
+     *   loops as the fallback, over the same chunked, branch-free lanes.
+     */
+    class Validator
+    {
+    public:
+        explicit Validator() noexcept = delete; //!< @brief Default constructor (deleted).
+
+    /* ^\__________________________________________ */
+    /* #region Static members, Inner types.         */
+
+    public:
+
+        /** @brief Number of values gathered before the compare loops run. */
+        static constexpr std::size_t CHUNK_SIZE = 16U;
+
+        /** @brief Validates each value against its own `Spec`. */
+        /**
+         * @details
+         * `results[i]` is set to `specs[i]->isWithinRange( *values[i] )`.
+         * A null `Spec` or value results in `false`.
+         * Only the first `min( specs.size(), values.size(), results.size() )`
+         * entries are processed.
+         *
+         * @param specs   [in]  The specs to validate against.
+         * @param values  [in]  The values to validate.
+         * @param results [out] The result per value.
+         *
+         * @return The number of values within range.
+         */
+        static std::size_t validate( std::span<Spec const * const> specs
+                                   , std::span<Value const * const> values
+                                   , std::span<bool> results ) noexcept;
+
+        /** @brief Validates every value against the same `Spec`. */
+        /**
+         * @details
+         * `results[i]` is set to `spec.isWithinRange( *values[i] )`.
+         * A null value results in `false`.
+         * Only the first `min( values.size(), results.size() )` entries are
+         * processed.
+         *
+         * @param spec    [in]  The spec to validate against.
+         * @param values  [in]  The values to validate.
+         * @param results [out] The result per value.
+         *
+         * @return The number of values within range.
+         */
+        static std::size_t validate( Spec const &spec
+                                   , std::span<Value const * const> values
+                                   , std::span<bool> results ) noexcept;
+
+    /* #endregion */// Static members, Inner types
+
+    }; // class Validator
+
+} // namespace machine::property
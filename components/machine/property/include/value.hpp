@@ -1,14 +1,34 @@
 #pragma once
 
+/* C++ Standard Library */
+#include <cstdint>
+
 /* Custom Library */
+#include <lock_policy.hpp>
 #include <namespace.hpp>
 #include <value255.hpp>
 
 namespace machine::property
 {
+    /** @copydoc ::value::BasicValue255 */
+    template <typename LockPolicy = ::value::lock::Default, std::uint8_t InlineSize = 4U>
+    using BasicValue = ::value::BasicValue255<LockPolicy, InlineSize>;
+
+    /** @copydoc ::value::BasicMutableValue255 */
+    template <typename LockPolicy = ::value::lock::Default, std::uint8_t InlineSize = 4U>
+    using BasicMutableValue = ::value::BasicMutableValue255<LockPolicy, InlineSize>;
+
     /** @copydoc ::value::Value255 */
-    using Value = ::value::Value255;
+    using Value = BasicValue<>;
 
     /** @copydoc ::value::MutableValue255 */
-    using MutableValue = ::value::MutableValue255;
+    using MutableValue = BasicMutableValue<>;
+
+    /** @copydoc ::value::InlineValue255 */
+    template <std::uint8_t InlineSize>
+    using InlineValue = ::value::InlineValue255<InlineSize>;
+
+    /** @copydoc ::value::InlineMutableValue255 */
+    template <std::uint8_t InlineSize>
+    using InlineMutableValue = ::value::InlineMutableValue255<InlineSize>;
 }
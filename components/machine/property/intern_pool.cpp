@@ -0,0 +1,324 @@
+/* Self */
+#include <intern_pool.hpp>
+
+/* C++ Standard Library */
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <new>
+#include <utility>
+
+/* Custom Library */
+#include <hash_util.hpp>
+#include <lock_policy.hpp>
+
+/* ESP-IDF */
+#include <esp_heap_caps.h>
+#include <sdkconfig.h>
+
+/* ^\__________________________________________ */
+/* Namespaces.                                  */
+using namespace machine::property;
+
+
+/* ^\__________________________________________ */
+/* #region Private types, functions.            */
+
+namespace
+{
+    using Handle = InternPool::Handle;
+
+#ifdef CONFIG_MACHINE_INTERN_POOL_CAPACITY
+    constexpr std::size_t CAPACITY = CONFIG_MACHINE_INTERN_POOL_CAPACITY;
+#else
+    constexpr std::size_t CAPACITY = 1024U;
+#endif
+
+    static_assert( ( CAPACITY > 0U ) && ( CAPACITY <= UINT16_MAX ), "Handles are 16-bit and 0 is EMPTY" );
+
+    constexpr std::size_t CHUNK_SIZE   = InternPool::CHUNK_SIZE;
+    constexpr std::size_t CHUNK_COUNT  = ( CAPACITY + CHUNK_SIZE - 1U ) / CHUNK_SIZE;
+    constexpr std::size_t BUCKET_COUNT = 128U;
+
+    /** @brief One interned payload. */
+    struct Entry
+    {
+        MutableValue value;         //!< The payload; empty while the entry is free.
+        std::uint32_t hash = 0U;    //!< `util::hashBytes()` of the payload.
+        std::uint32_t refs = 0U;    //!< Reference count; 0 while the entry is free.
+        Handle next = InternPool::EMPTY; //!< Next entry of the bucket, or of the free list.
+    };
+
+    /** @brief Entries, hash buckets and free list. */
+    struct Pool
+    {
+        std::atomic<bool> lock_ = false;             //!< Spinlock with backoff. false=unlocked, true=locked.
+        std::array<Entry *, CHUNK_COUNT> chunks_ {}; //!< Allocated chunks, never moved.
+        std::array<Handle, BUCKET_COUNT> buckets_ {};//!< First entry of each bucket.
+        std::size_t chunkCount_ = 0U;                //!< Number of allocated chunks.
+        std::size_t size_ = 0U;                      //!< Number of entries in use.
+        Handle free_ = InternPool::EMPTY;            //!< First free entry.
+
+        void lock() noexcept
+        {
+            value::lock::Backoff backoff;
+
+            while( lock_.exchange( true, std::memory_order_acquire ) )
+            {
+                // Note: Wait on a load; only retry the store once the lock looks free.
+                do { backoff.pause(); } while( lock_.load( std::memory_order_relaxed ) );
+            }
+        }
+
+        void unlock() noexcept
+        {
+            lock_.store( false, std::memory_order_release );
+        }
+
+        Entry &at( Handle h ) noexcept
+        {
+            std::size_t const i = h - 1U;
+            return chunks_[i / CHUNK_SIZE][i % CHUNK_SIZE];
+        }
+
+        /** @brief Returns `true` if no further chunk may be linked. */
+        [[nodiscard]]
+        bool isFull() const noexcept { return chunkCount_ == CHUNK_COUNT; }
+
+        /** @brief Allocates a chunk of free entries, without taking the lock. */
+        /**
+         * @return The chunk, or `nullptr` on allocation failure.
+         */
+        static Entry *allocateChunk() noexcept
+        {
+            auto *chunk = static_cast<Entry *>(
+                heap_caps_malloc( sizeof( Entry ) * CHUNK_SIZE, MALLOC_CAP_DEFAULT ) );
+            if ( !chunk ) { return nullptr; }
+            // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on allocation failure!! ]
+
+            for ( std::size_t i = 0U; i < CHUNK_SIZE; i++ )
+            {
+                new ( &chunk[i] ) Entry{};
+            }
+
+            return chunk;
+        }
+
+        /** @brief Frees a chunk of `allocateChunk()` that was not linked; `nullptr` is ignored. */
+        static void freeChunk( Entry *chunk ) noexcept
+        {
+            if ( !chunk ) { return; }
+
+            for ( std::size_t i = 0U; i < CHUNK_SIZE; i++ )
+            {
+                chunk[i].~Entry();
+            }
+            heap_caps_free( chunk );
+        }
+
+        /** @brief Links all entries of `chunk` into the free list. */
+        /**
+         * @param chunk [in] A chunk of `allocateChunk()`.
+         *
+         * @return `true` if linked; `false` if full, then `chunk` is still owned by the caller.
+         */
+        bool link( Entry *chunk ) noexcept
+        {
+            // [===> Prerequisite: The pool is locked]
+
+            if ( isFull() ) { return false; }
+            // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on full pool!! ]
+
+            chunks_[chunkCount_] = chunk;
+
+            std::size_t const base = chunkCount_ * CHUNK_SIZE;
+            chunkCount_++;
+
+            for ( std::size_t i = CHUNK_SIZE; i > 0U; i-- )
+            {
+                std::size_t const h = base + i;
+                if ( h > CAPACITY ) { continue; }
+
+                chunk[i - 1U].next = free_;
+                free_ = static_cast<Handle>( h );
+            }
+            // [===> Follows: All entries are linked in handle order]
+
+            return true;
+        }
+    };
+
+    constinit Pool pool {};
+
+    MutableValue const empty_value {};
+
+} // namespace
+
+/* #endregion */// Private types, functions.
+
+
+/* ^\__________________________________________ */
+/* #region Public methods.                      */
+
+std::optional<InternPool::Handle> InternPool::intern( std::span<std::byte const> bytes ) noexcept
+{
+    if ( bytes.empty() ) { return EMPTY; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on empty payload!! ]
+
+    std::uint32_t const hash = util::hashBytes( bytes );
+    Handle &bucket = pool.buckets_[hash % BUCKET_COUNT];
+
+    // Note: Copied before locking, so the lock is never held across a payload allocation.
+    MutableValue payload;
+    if ( !payload.set( bytes.data(), static_cast<std::uint8_t>( bytes.size() ) ) ) { return std::nullopt; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on allocation failure!! ]
+
+    Entry *spare = nullptr;
+
+    pool.lock();
+    // [===> Follows: Locked]
+
+    // Note: A chunk is allocated with the lock released; the bucket is searched again afterwards.
+    for ( ;; )
+    {
+        if ( spare && pool.link( spare ) ) { spare = nullptr; }
+
+        for ( Handle h = bucket; h != EMPTY; h = pool.at( h ).next )
+        {
+            Entry &e = pool.at( h );
+
+            if ( e.hash != hash ) { continue; }
+
+            Value::View const view = e.value.view();
+            if ( std::ranges::equal( view.span(), bytes ) )
+            {
+                e.refs++;
+                pool.unlock();
+                Pool::freeChunk( spare );
+                return h;
+            }
+        }
+        // [===> Follows: New payload]
+
+        if ( pool.free_ != EMPTY ) { break; }
+
+        if ( pool.isFull() )
+        {
+            pool.unlock();
+            Pool::freeChunk( spare );
+            return std::nullopt;
+        }
+        // [===> Follows: No free entry, but room for a chunk]
+
+        pool.unlock();
+
+        spare = Pool::allocateChunk();
+        if ( !spare ) { return std::nullopt; }
+        // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on allocation failure!! ]
+
+        pool.lock();
+    }
+    // [===> Follows: At least one entry is free; `spare` is only left if the pool is full]
+
+    Handle const h = pool.free_;
+    Entry &e = pool.at( h );
+
+    e.value = std::move( payload ); // Note: A free entry is empty; nothing is freed or allocated.
+    pool.free_ = e.next;
+    e.hash = hash;
+    e.refs = 1U;
+    e.next = bucket;
+    bucket = h;
+    pool.size_++;
+
+    pool.unlock();
+    Pool::freeChunk( spare );
+
+    return h;
+}
+
+std::optional<InternPool::Handle> InternPool::intern( Value const &v ) noexcept
+{
+    // Note: Copied out first, so that `v` may itself be interned; its lock is not held below.
+    std::array<std::byte, UINT8_MAX> buffer;
+    std::optional<std::uint8_t> const size = v.copyTo( buffer );
+
+    if ( !size.has_value() ) { return std::nullopt; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on copy failure!! ]
+
+    return intern( std::span<std::byte const>( buffer.data(), size.value() ) );
+}
+
+InternPool::Handle InternPool::retain( Handle h ) noexcept
+{
+    if ( h == EMPTY ) { return h; }
+
+    pool.lock();
+    pool.at( h ).refs++;
+    pool.unlock();
+
+    return h;
+}
+
+void InternPool::release( Handle h ) noexcept
+{
+    if ( h == EMPTY ) { return; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on empty payload!! ]
+
+    pool.lock();
+    // [===> Follows: Locked]
+
+    Entry &e = pool.at( h );
+
+    if ( --e.refs > 0U )
+    {
+        pool.unlock();
+        return;
+    }
+    // [===> Follows: Last reference dropped]
+
+    Handle *link = &pool.buckets_[e.hash % BUCKET_COUNT];
+    while ( *link != h )
+    {
+        link = &pool.at( *link ).next;
+    }
+    *link = e.next;
+    // [===> Follows: Unlinked from its bucket]
+
+    MutableValue const dropped = std::move( e.value ); // Note: Freed after unlocking, see below.
+    e.next = pool.free_;
+    pool.free_ = h;
+    pool.size_--;
+
+    pool.unlock();
+    // [===> Follows: `dropped` frees the payload with the lock released]
+}
+
+Value const &InternPool::valueOf( Handle h ) noexcept
+{
+    if ( h == EMPTY ) { return empty_value; }
+
+    return pool.at( h ).value;
+}
+
+std::uint32_t InternPool::refCount( Handle h ) noexcept
+{
+    if ( h == EMPTY ) { return 0U; }
+
+    pool.lock();
+    std::uint32_t const refs = pool.at( h ).refs;
+    pool.unlock();
+
+    return refs;
+}
+
+std::size_t InternPool::size() noexcept
+{
+    pool.lock();
+    std::size_t const n = pool.size_;
+    pool.unlock();
+
+    return n;
+}
+
+/* #endregion */// Public methods.
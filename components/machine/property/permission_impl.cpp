@@ -2,7 +2,11 @@
 #include "permission_impl.hpp"
 
 /* C++ Standard Library */
-#include <sstream>
+#include <format>
+#include <iterator>
+
+/* Custom Library */
+#include <permission_format.hpp>
 
 /* ^\__________________________________________ */
 /* Namespaces.                                  */
@@ -17,7 +21,8 @@ namespace machine::property
 {
     std::ostream &operator<<( std::ostream &os, Permission::Kind const &v ) noexcept
     {
-        return os << Permission::strOf( v );
+        std::format_to( std::ostreambuf_iterator<char>( os ), "{}", v );
+        return os;
     }
 }
 
@@ -43,11 +48,7 @@ std::string_view Permission::nameOf( Kind const &v ) noexcept
 
 std::string Permission::strOf( Kind const &v ) noexcept
 {
-    std::ostringstream oss;
-
-    oss << nameOf( v ) << "(" << static_cast<unsigned>( v ) << ")";
-
-    return oss.str();
+    return std::format( "{}", v );
 }
 
 /* #endregion */// Public methods.
@@ -2,8 +2,12 @@
 #include "resolution_impl.hpp"
 
 /* C++ Standard Library */
-#include <cmath>
-#include <sstream>
+#include <algorithm>
+#include <format>
+#include <iterator>
+
+/* Custom Library */
+#include <resolution_format.hpp>
 
 /* ^\__________________________________________ */
 /* Namespaces.                                  */
@@ -18,7 +22,8 @@ namespace machine::property
 {
     std::ostream &operator<<( std::ostream &os, Resolution::Kind const &v ) noexcept
     {
-        return os << Resolution::strOf( v );
+        std::format_to( std::ostreambuf_iterator<char>( os ), "{}", v );
+        return os;
     }
 }
 
@@ -44,46 +49,40 @@ std::string_view Resolution::nameOf( Kind const &v ) noexcept
 
 std::string Resolution::strOf( Kind const &v ) noexcept
 {
-    std::ostringstream oss;
-
-    oss << nameOf( v ) << "(" << static_cast<unsigned>( v ) << ")";
-
-    return oss.str();
+    return std::format( "{}", v );
 }
 
-std::int8_t Resolution::shiftOf( Kind const &v ) noexcept
+std::size_t Resolution::toMillis( std::span<std::int32_t const> raw
+                                , Kind const &v
+                                , std::span<std::int64_t> out ) noexcept
 {
-    auto raw = static_cast<std::uint8_t>( v ); // Note: 0 to 7
-
-    std::uint8_t bit2_bit1 = static_cast<std::uint8_t>( ( raw >> 1 ) & 0b11 ); // Note: 0 to 3
-
-    /* Note: Calculation details.
-        + ------- + ------------------ + ---------------- + ------ +
-        | Step0:  | Step1:             | Step2:           | Step3: |
-        | Origin  | << 6 (as unsigned) | >> 6 (as signed) | Result |
-        + ------- + ------------------ + ---------------- + ------ +
-        |  0b'00  |      0b'0000'0000  |    0b'0000'0000  |    +0  |
-        |  0b'01  |      0b'0100'0000  |    0b'0000'0001  |    +1  |
-        |  0b'10  |      0b'1000'0000  |    0b'1111'1110  |    -2  |
-        |  0b'11  |      0b'1100'0000  |    0b'1111'1111  |    -1  |
-        + ------- + ------------------ + ---------------- + ------ +
-    */
-    return static_cast<std::int8_t>( bit2_bit1 << 6 ) >> 6; // Note: -2 to +1
-}
+    std::size_t const count = std::min( raw.size(), out.size() );
+    std::int64_t const factor = RESOLUTION_MILLI_FACTORS[static_cast<std::uint8_t>( v ) & 0b111U];
 
-std::uint8_t Resolution::coeffOf( Kind const &v ) noexcept
-{
-    auto raw = static_cast<std::uint8_t>( v );
-    auto bit0 = raw & 0b1;
-    return bit0 ? 5U : 1U; // 5 if bit0 == 1, 1 if bit0 == 0
+    for ( std::size_t i = 0U; i < count; i++ )
+    {
+        out[i] = static_cast<std::int64_t>( raw[i] ) * factor;
+    }
+
+    return count;
 }
 
-double Resolution::scaleFactorOf( Kind const &v ) noexcept
+std::size_t Resolution::fromMillis( std::span<std::int64_t const> millis
+                                  , Kind const &v
+                                  , std::span<std::int32_t> out ) noexcept
 {
-    double coeff = static_cast<double>( coeffOf( v ) );
-    std::int8_t shift = shiftOf( v );
+    std::size_t const count = std::min( millis.size(), out.size() );
+
+    for ( std::size_t i = 0U; i < count; i++ )
+    {
+        auto const raw = fromMillis( millis[i], v );
+        if ( !raw.has_value() ) { return i; }
+        // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on overflow!! ]
+
+        out[i] = raw.value();
+    }
 
-    return coeff * std::pow( 10.0, shift );
+    return count;
 }
 
 /* #endregion */// Public methods.
@@ -2,10 +2,17 @@
 #include <spec.hpp>
 
 /* C++ Standard Library */
-#include <cstring>
-#include <sstream>
+#include <algorithm>
+#include <format>
+#include <initializer_list>
+#include <iterator>
+#include <span>
 #include <utility>
-#include <vector>
+
+/* Custom Library */
+#include <hash_util.hpp>
+#include <spec_format.hpp>
+#include <static_spec.hpp>
 
 /* ^\__________________________________________ */
 /* Namespaces.                                  */
@@ -20,8 +27,25 @@ namespace machine::property
 {
     std::ostream &operator<<( std::ostream &os, Spec const &v ) noexcept
     {
-        return os << v.str();
+        std::format_to( std::ostreambuf_iterator<char>( os ), "{}", v );
+        return os;
+    }
+}
+
+Spec &Spec::operator=( Spec &&other ) noexcept
+{
+    if ( this != &other )
+    {
+        releaseValues();
+
+        frags_   = other.frags_;
+        bounds_  = other.bounds_;
+        initVal_ = std::exchange( other.initVal_, Interned::of( InternPool::EMPTY ) );
+        minVal_  = std::exchange( other.minVal_, Interned::of( InternPool::EMPTY ) );
+        maxVal_  = std::exchange( other.maxVal_, Interned::of( InternPool::EMPTY ) );
     }
+
+    return *this;
 }
 
 /* #endregion */// Operators.
@@ -39,15 +63,17 @@ std::optional<Spec> Spec::create( Permission::Kind permission
                                 , std::byte const *max_val
                                 , std::uint8_t max_size ) noexcept
 {
-    auto init = Value::create( init_val, init_size );
-    auto min  = Value::create( min_val, min_size );
-    auto max  = Value::create( max_val, max_size );
+    if ( ( !init_val && init_size ) || ( !min_val && min_size ) || ( !max_val && max_size ) )
+    {
+        return std::nullopt;
+    }
+    // ~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on null data!! ]
 
     return create( permission
                  , resolution
-                 , std::move( init )
-                 , std::move( min )
-                 , std::move( max ) );
+                 , InternPool::intern( std::span<std::byte const>( init_val, init_size ) )
+                 , InternPool::intern( std::span<std::byte const>( min_val, min_size ) )
+                 , InternPool::intern( std::span<std::byte const>( max_val, max_size ) ) );
 }
 
 std::optional<Spec> Spec::create( Permission::Kind permission
@@ -56,56 +82,92 @@ std::optional<Spec> Spec::create( Permission::Kind permission
                                 , Value const &min_val
                                 , Value const &max_val ) noexcept
 {
-    auto cloned_init = init_val.clone();
-    auto cloned_min = min_val.clone();
-    auto cloned_max = max_val.clone();
-
     return create( permission
-                  , resolution
-                  , std::move( cloned_init )
-                  , std::move( cloned_min )
-                  , std::move( cloned_max ) );
+                 , resolution
+                 , InternPool::intern( init_val )
+                 , InternPool::intern( min_val )
+                 , InternPool::intern( max_val ) );
+}
+
+std::optional<Spec> Spec::create( StaticSpec const &spec ) noexcept
+{
+    std::span<std::byte const> const init = spec.initBytes();
+    std::span<std::byte const> const min  = spec.minBytes();
+    std::span<std::byte const> const max  = spec.maxBytes();
+
+    return create( spec.permission()
+                 , spec.resolution()
+                 , init.data(), static_cast<std::uint8_t>( init.size() )
+                 , min.data() , static_cast<std::uint8_t>( min.size() )
+                 , max.data() , static_cast<std::uint8_t>( max.size() ) );
 }
 
 std::optional<Spec> Spec::create( Permission::Kind permission
                                 , Resolution::Kind resolution
-                                , std::optional<Value> &&init
-                                , std::optional<Value> &&min
-                                , std::optional<Value> &&max ) noexcept
+                                , std::optional<InternPool::Handle> init
+                                , std::optional<InternPool::Handle> min
+                                , std::optional<InternPool::Handle> max ) noexcept
 {
     if ( init.has_value() &&
          min.has_value()  &&
          max.has_value() )
     {
+        Value const &min_val = InternPool::valueOf( min.value() );
+        Value const &max_val = InternPool::valueOf( max.value() );
+
+        Format::Kind const format =
+            Format::fromValueRange( min_val, max_val );
+
         return std::optional<Spec>{
             Spec{
                 {
-                    static_cast<std::uint8_t>(
-                        Format::fromValueRange( min.value(), max.value() ) ),
+                    static_cast<std::uint8_t>( format ),
                     static_cast<std::uint8_t>( permission ),
                     static_cast<std::uint8_t>( resolution ),
                     0
                 },
-                std::move( init.value() ),
-                std::move( min.value() ),
-                std::move( max.value() )
+                boundsOf( format, min_val, max_val ),
+                init.value(),
+                min.value(),
+                max.value()
             }
         };
     }
 
+    // Note: Give back the values that were interned.
+    for ( auto const &h : { init, min, max } )
+    {
+        if ( h.has_value() ) { InternPool::release( h.value() ); }
+    }
+
     return std::nullopt;
 }
 
 Spec::Spec( Fragments frags
-          , Value &&init_val
-          , Value &&min_val
-          , Value &&max_val ) noexcept
+          , Bounds bounds
+          , InternPool::Handle init_val
+          , InternPool::Handle min_val
+          , InternPool::Handle max_val ) noexcept
     : frags_( frags )
-    , initVal_( std::move( init_val ) )
-    , minVal_( std::move( min_val ) )
-    , maxVal_( std::move( max_val ) )
+    , bounds_( bounds )
+    , initVal_( Interned::of( init_val ) )
+    , minVal_( Interned::of( min_val ) )
+    , maxVal_( Interned::of( max_val ) )
+{ /* Do nothing */ }
+
+Spec::Spec( Spec &&other ) noexcept
+    : frags_( other.frags_ )
+    , bounds_( other.bounds_ )
+    , initVal_( std::exchange( other.initVal_, Interned::of( InternPool::EMPTY ) ) )
+    , minVal_( std::exchange( other.minVal_, Interned::of( InternPool::EMPTY ) ) )
+    , maxVal_( std::exchange( other.maxVal_, Interned::of( InternPool::EMPTY ) ) )
 { /* Do nothing */ }
 
+Spec::~Spec() noexcept
+{
+    releaseValues();
+}
+
 /* #endregion */// Factory methods, Constructors.
 
 
@@ -114,65 +176,60 @@ Spec::Spec( Fragments frags
 
 bool Spec::isWithinRange( Value const &v ) const noexcept
 {
-    std::uint8_t const size = v.size();
-
-    if ( size == 0U )
-    {
-        return false; // Note: Must not be empty.
-    }
+    Value::View const view = v.view();
+    // [===> Follows: Locked]
 
-    std::vector<std::byte> const bytes = v.bytes();
-
-    switch ( format() )
-    {
-
-    case Format::Kind::String:
-        return ( size <= MAX_STRING_SIZE );
-
-    case Format::Kind::BitSet:
-        return ( size <= MAX_BITSET_SIZE );
-
-    case Format::Kind::Boolean:
-        { // Validate value is either 0x00 or 0x01.
-            bool const is_valid_size = ( size == BOOL_SIZE );
-            bool const is_false_value = ( bytes.at( 0U ) == BOOL_FALSE );
-            bool const is_true_value  = ( bytes.at( 0U ) == BOOL_TRUE );
-
-            return ( is_valid_size && ( is_false_value || is_true_value ) );
-        }
+    return isWithinRange( view.span() );
+}
 
-    case Format::Kind::Numeric:
-        if ( size <= MAX_NUMERIC_SIZE )
-        { // Validate value is within the valid range.
-            std::int32_t n = decodeNumericValue( v );
-            std::int32_t min = decodeNumericValue( minVal() );
-            std::int32_t max = decodeNumericValue( maxVal() );
+bool Spec::isWithinRange( std::span<std::byte const> bytes ) const noexcept
+{
+    return isWithinBounds( format(), bounds_.range(), bytes );
+}
 
-            return ( ( min <= n ) && ( n <= max ) );
-        }
-        return false; // Note: Size exceeds maximum allowed.
+bool Spec::isWithinRange( std::int32_t n ) const noexcept
+{
+    return isWithinBounds( format(), bounds_.range(), n );
+}
 
-    default:
-        return false; // Note: Unknown format.
+Spec Spec::clone() const noexcept
+{
+    return Spec{ frags_
+               , bounds_
+               , InternPool::retain( initVal_.handle() )
+               , InternPool::retain( minVal_.handle() )
+               , InternPool::retain( maxVal_.handle() ) };
+}
 
-    } // switch ( format() )
+bool Spec::isSameAs( Spec const &other ) const noexcept
+{
+    return ( std::bit_cast<std::uint8_t>( frags_ ) == std::bit_cast<std::uint8_t>( other.frags_ ) )
+        && ( bounds_.lower == other.bounds_.lower )
+        && ( bounds_.upper == other.bounds_.upper )
+        && ( initVal_.raw == other.initVal_.raw )
+        && ( minVal_.raw == other.minVal_.raw )
+        && ( maxVal_.raw == other.maxVal_.raw );
+}
 
-    return false; // Note: Should not reach here.
+std::uint32_t Spec::hash() const noexcept
+{
+    // Note: Copied into one buffer, so it is hashed a word at a time.
+    std::array<std::byte, 1U + 2U * sizeof( std::int32_t ) + 3U * sizeof( InternPool::Handle )> key;
+    auto out = key.begin();
+
+    *out++ = std::bit_cast<std::byte>( frags_ );
+    out = std::ranges::copy( bounds_.lower, out ).out;
+    out = std::ranges::copy( bounds_.upper, out ).out;
+    out = std::ranges::copy( initVal_.raw, out ).out;
+    out = std::ranges::copy( minVal_.raw, out ).out;
+    std::ranges::copy( maxVal_.raw, out );
+
+    return util::hashBytes( key );
 }
 
 std::string Spec::str() const noexcept
 {
-    std::ostringstream oss;
-
-    oss << "{ format: "        << format()
-        << ", permission: "    << permission()
-        << ", resolution: "    << resolution()
-        << ", initial_value: " << initVal_.str()
-        << ", minimum_value: " << minVal_.str()
-        << ", maximum_value: " << maxVal_.str()
-        << " }";
-
-    return oss.str();
+    return std::format( "{}", *this );
 }
 
 /* #endregion */// Public methods.
@@ -181,19 +238,35 @@ std::string Spec::str() const noexcept
 /* ^\__________________________________________ */
 /* #region Private methods.                     */
 
-std::int32_t Spec::decodeNumericValue( Value const &v ) const noexcept
+void Spec::releaseValues() noexcept
 {
-    if ( ( v.size() == 0U ) || ( v.size() > MAX_NUMERIC_SIZE ) )
-    {
-        return 0;
-    }
-    // [===> Follows: Size is 1 to 4 bytes]
+    InternPool::release( initVal_.handle() );
+    InternPool::release( minVal_.handle() );
+    InternPool::release( maxVal_.handle() );
+}
+
+std::int32_t Spec::decodeValueAs( Format::Kind format, Value const &v ) noexcept
+{
+    Value::View const view = v.view();
+    // [===> Follows: Locked]
+
+    return decodeAs( format, view.span() );
+}
+
+Spec::Bounds Spec::boundsOf( Format::Kind format
+                           , Value const &min_val
+                           , Value const &max_val ) noexcept
+{
+    // Note: Values are only decoded for the formats whose bounds depend on them.
+    bool const numeric = ( format == Format::Kind::Numeric );
+    bool const bitset  = ( format == Format::Kind::BitSet );
+
+    std::int32_t const min = numeric ? decodeValueAs( format, min_val ) : 0;
+    std::int32_t const max = ( numeric || bitset ) ? decodeValueAs( format, max_val ) : 0;
 
-    std::vector<std::byte> const &bytes = v.bytes();
-    std::int32_t val = 0;
-    std::memcpy( &val, bytes.data(), bytes.size() );
+    RangeBounds const range = rangeOf( format, min, max );
 
-    return val;
+    return Bounds::of( range.lo, range.hi );
 }
 
 /* #endregion */// Private methods.
\ No newline at end of file
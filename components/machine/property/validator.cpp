@@ -0,0 +1,198 @@
+/* Self */
+#include <validator.hpp>
+
+/* C++ Standard Library */
+#include <algorithm>
+#include <array>
+
+/* ^\__________________________________________ */
+/* Namespaces.                                  */
+using namespace machine::property;
+using namespace machine::property::detail;
+
+
+/* ^\__________________________________________ */
+/* #region Private types, functions.            */
+
+namespace
+{
+    /** @brief Maximum payload size per `Format::Kind`, indexed by its raw value. */
+    constexpr std::array<std::uint8_t, 4U> MAX_SIZE_OF =
+    {
+        MAX_NUMERIC_SIZE, // Numeric
+        BOOL_SIZE,        // Boolean
+        MAX_BITSET_SIZE,  // BitSet
+        MAX_STRING_SIZE,  // String
+    };
+
+    /** @brief Contiguous samples and bounds of one compare loop. */
+    struct Lane
+    {
+        std::array<std::int32_t, Validator::CHUNK_SIZE> n;     //!< Sampled values.
+        std::array<std::int32_t, Validator::CHUNK_SIZE> lo;    //!< Lower bounds.
+        std::array<std::int32_t, Validator::CHUNK_SIZE> hi;    //!< Upper bounds or masks.
+        std::array<std::uint8_t, Validator::CHUNK_SIZE> index; //!< Positions within the chunk.
+        std::array<bool, Validator::CHUNK_SIZE> pass;          //!< Compare results.
+        std::size_t count = 0U;                                //!< Number of samples.
+
+        void push( std::size_t at, std::int32_t v, std::int32_t l, std::int32_t h ) noexcept
+        {
+            n[count] = v;
+            lo[count] = l;
+            hi[count] = h;
+            index[count] = static_cast<std::uint8_t>( at );
+            count++;
+        }
+    };
+
+    /** @brief Samples a value for the compare loops of the given format. */
+    /**
+     * @param format [in]  The format of the spec.
+     * @param v      [in]  The value to sample.
+     * @param n      [out] The value, or the size for `String`.
+     *
+     * @return `true` if the size is valid for the format; `false` otherwise.
+     */
+    bool sample( Format::Kind format, Value const &v, std::int32_t &n ) noexcept
+    {
+        Value::View const view = v.view();
+        // [===> Follows: Locked]
+
+        std::size_t const size = view.size();
+        bool const ok = ( size > 0U )
+                     && ( size <= MAX_SIZE_OF[static_cast<std::uint8_t>( format )] );
+
+        n = 0;
+
+        if ( format == Format::Kind::String )
+        {
+            n = static_cast<std::int32_t>( size );
+        }
+        else if ( ok )
+        {
+            // Note: Same decoding as `Spec::isWithinRange()`.
+            n = decodeAs( format, view.span() );
+        }
+
+        return ok;
+    }
+
+    /** @brief Validates one chunk and writes its results. */
+    template <typename SpecAt>
+    std::size_t validateChunk( SpecAt const &spec_at
+                             , std::span<Value const * const> values
+                             , std::span<bool> results ) noexcept
+    {
+        Lane range; // Note: Numeric, Boolean, String and all invalid samples.
+        Lane mask;  // Note: BitSet.
+
+        // [===> Follows: Gather, each value is locked exactly once]
+        for ( std::size_t i = 0U; i < values.size(); i++ )
+        {
+            Spec const *spec = spec_at( i );
+            Value const *value = values[i];
+
+            if ( ( spec == nullptr ) || ( value == nullptr ) )
+            {
+                range.push( i, 0, 1, 0 ); // Note: Empty range, always fails.
+                continue;
+            }
+
+            Format::Kind const format = spec->format();
+            std::int32_t n = 0;
+
+            if ( !sample( format, *value, n ) )
+            {
+                range.push( i, 0, 1, 0 ); // Note: Empty range, always fails.
+            }
+            else if ( format == Format::Kind::BitSet )
+            {
+                mask.push( i, n, 0, spec->upperBound() );
+            }
+            else
+            {
+                range.push( i, n, spec->lowerBound(), spec->upperBound() );
+            }
+        }
+
+        // [===> Follows: Compare, branch-free over contiguous lanes]
+        for ( std::size_t k = 0U; k < range.count; k++ )
+        {
+            range.pass[k] = ( range.lo[k] <= range.n[k] ) & ( range.n[k] <= range.hi[k] );
+        }
+
+        for ( std::size_t k = 0U; k < mask.count; k++ )
+        {
+            mask.pass[k] = ( mask.n[k] & ~mask.hi[k] ) == 0;
+        }
+
+        // [===> Follows: Scatter back to the caller's order]
+        std::size_t valid = 0U;
+
+        for ( Lane const *lane : { &range, &mask } )
+        {
+            for ( std::size_t k = 0U; k < lane->count; k++ )
+            {
+                results[lane->index[k]] = lane->pass[k];
+                valid += lane->pass[k];
+            }
+        }
+
+        return valid;
+    }
+
+    /** @brief Splits the input into chunks of `CHUNK_SIZE`. */
+    template <typename SpecAt>
+    std::size_t validateAll( std::size_t count
+                           , SpecAt const &spec_at
+                           , std::span<Value const * const> values
+                           , std::span<bool> results ) noexcept
+    {
+        std::size_t valid = 0U;
+
+        for ( std::size_t base = 0U; base < count; base += Validator::CHUNK_SIZE )
+        {
+            std::size_t const len = std::min( Validator::CHUNK_SIZE, count - base );
+
+            valid += validateChunk(
+                [&spec_at, base]( std::size_t i ) noexcept { return spec_at( base + i ); }
+              , values.subspan( base, len )
+              , results.subspan( base, len ) );
+        }
+
+        return valid;
+    }
+
+} // namespace
+
+/* #endregion */// Private types, functions.
+
+
+/* ^\__________________________________________ */
+/* #region Public methods.                      */
+
+std::size_t Validator::validate( std::span<Spec const * const> specs
+                               , std::span<Value const * const> values
+                               , std::span<bool> results ) noexcept
+{
+    std::size_t const count = std::min( { specs.size(), values.size(), results.size() } );
+
+    return validateAll( count
+                      , [specs]( std::size_t i ) noexcept { return specs[i]; }
+                      , values
+                      , results );
+}
+
+std::size_t Validator::validate( Spec const &spec
+                               , std::span<Value const * const> values
+                               , std::span<bool> results ) noexcept
+{
+    std::size_t const count = std::min( values.size(), results.size() );
+
+    return validateAll( count
+                      , [&spec]( std::size_t ) noexcept { return &spec; }
+                      , values
+                      , results );
+}
+
+/* #endregion */// Public methods.
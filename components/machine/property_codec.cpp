@@ -0,0 +1,271 @@
+/* Self */
+#include <property_codec.hpp>
+
+/* C++ Standard Library */
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+/* ^\__________________________________________ */
+/* Namespaces.                                  */
+using namespace machine;
+using namespace machine::property;
+
+
+/* ^\__________________________________________ */
+/* #region Private types, functions.            */
+
+namespace
+{
+    /** @brief Header offsets, see the `PropertyCodec` description. */
+    enum Offset : std::uint8_t
+    {
+        CODE = 0U,
+        FRAGMENTS,
+        INIT_SIZE,
+        MIN_SIZE,
+        MAX_SIZE,
+        VALUE_SIZE,
+    };
+
+    constexpr std::uint8_t FORMAT_SHIFT     = 0U;
+    constexpr std::uint8_t PERMISSION_SHIFT = 2U;
+    constexpr std::uint8_t RESOLUTION_SHIFT = 4U;
+    constexpr std::uint8_t VALUE_MASK       = 0b1000'0000U;
+
+    std::byte packFragments( Spec const &spec ) noexcept
+    {
+        return static_cast<std::byte>(
+              ( static_cast<std::uint8_t>( spec.format() )     << FORMAT_SHIFT )
+            | ( static_cast<std::uint8_t>( spec.permission() ) << PERMISSION_SHIFT )
+            | ( static_cast<std::uint8_t>( spec.resolution() ) << RESOLUTION_SHIFT ) );
+    }
+
+    std::uint8_t byteAt( std::span<std::byte const> bytes, std::uint8_t offset ) noexcept
+    {
+        return std::to_integer<std::uint8_t>( bytes[offset] );
+    }
+
+    /** @brief Writes a frame; a null `value` writes a spec-only frame. */
+    std::size_t writeFrame( std::uint8_t code
+                          , Spec const &spec
+                          , Value const *value
+                          , std::span<std::byte> out ) noexcept
+    {
+        if ( out.size() < PropertyCodec::HEADER_SIZE ) { return 0U; }
+        // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on short buffer!! ]
+
+        out[CODE] = static_cast<std::byte>( code );
+        out[FRAGMENTS] = packFragments( spec ) | ( value != nullptr ? std::byte{ VALUE_MASK } : std::byte{ 0x00 } );
+
+        Value const *const parts[] = { &spec.initVal(), &spec.minVal(), &spec.maxVal(), value };
+        std::size_t pos = PropertyCodec::HEADER_SIZE;
+
+        for ( std::uint8_t k = 0U; k < std::size( parts ); k++ )
+        {
+            if ( parts[k] == nullptr )
+            {
+                out[INIT_SIZE + k] = std::byte{ 0x00 };
+                continue;
+            }
+
+            Value::View const view = parts[k]->view();
+            // [===> Follows: Locked]
+
+            if ( view.size() > out.size() - pos ) { return 0U; }
+            // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on short buffer!! ]
+
+            out[INIT_SIZE + k] = static_cast<std::byte>( view.size() );
+            std::memcpy( out.data() + pos, view.span().data(), view.size() );
+            pos += view.size();
+        }
+
+        return pos;
+    }
+
+} // namespace
+
+/* #endregion */// Private types, functions.
+
+
+/* ^\__________________________________________ */
+/* #region Public methods.                      */
+
+std::size_t PropertyCodec::sizeOf( Property const &property ) noexcept
+{
+    Spec const &spec = property.spec();
+
+    return HEADER_SIZE
+         + spec.initVal().size()
+         + spec.minVal().size()
+         + spec.maxVal().size()
+         + property.value().size();
+}
+
+std::size_t PropertyCodec::encode( Property const &property, std::span<std::byte> out ) noexcept
+{
+    return writeFrame( property.code(), property.spec(), &property.value(), out );
+}
+
+std::size_t PropertyCodec::encode( std::uint8_t code
+                                 , Spec const &spec
+                                 , std::span<std::byte> out ) noexcept
+{
+    return writeFrame( code, spec, nullptr, out );
+}
+
+std::optional<std::size_t> PropertyCodec::frameSizeOf( std::span<std::byte const> header ) noexcept
+{
+    if ( header.size() < HEADER_SIZE ) { return std::nullopt; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on short header!! ]
+
+    // Note: A spec-only frame has no value bytes; an empty value sets the flag with size 0.
+    bool const malformed = ( !( byteAt( header, FRAGMENTS ) & VALUE_MASK ) && ( byteAt( header, VALUE_SIZE ) != 0U ) )
+                        || ( byteAt( header, MIN_SIZE ) > detail::MAX_NUMERIC_SIZE )
+                        || ( byteAt( header, MAX_SIZE ) > detail::MAX_NUMERIC_SIZE );
+
+    if ( malformed ) { return std::nullopt; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on malformed header!! ]
+
+    return HEADER_SIZE
+         + byteAt( header, INIT_SIZE )
+         + byteAt( header, MIN_SIZE )
+         + byteAt( header, MAX_SIZE )
+         + byteAt( header, VALUE_SIZE );
+}
+
+std::optional<PropertyCodec::Frame> PropertyCodec::parse( std::span<std::byte const> input ) noexcept
+{
+    auto const size = frameSizeOf( input );
+
+    if ( !size.has_value() || ( input.size() < size.value() ) ) { return std::nullopt; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on incomplete frame!! ]
+    // [===> Follows: Complete frame]
+
+    std::uint8_t const frags = byteAt( input, FRAGMENTS );
+    std::size_t pos = HEADER_SIZE;
+
+    auto const take = [&input, &pos]( std::uint8_t offset ) noexcept
+    {
+        auto const part = input.subspan( pos, byteAt( input, offset ) );
+        pos += part.size();
+        return part;
+    };
+
+    Frame frame {
+        byteAt( input, CODE ),
+        Format::fromRaw( static_cast<std::uint8_t>( frags >> FORMAT_SHIFT ) ),
+        Permission::fromRaw( static_cast<std::uint8_t>( frags >> PERMISSION_SHIFT ) ),
+        Resolution::fromRaw( static_cast<std::uint8_t>( frags >> RESOLUTION_SHIFT ) ),
+        take( INIT_SIZE ),
+        take( MIN_SIZE ),
+        take( MAX_SIZE ),
+        take( VALUE_SIZE ),
+        ( frags & VALUE_MASK ) != 0U,
+    };
+
+    if ( frame.format != Format::fromValueRange( frame.minVal, frame.maxVal ) ) { return std::nullopt; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on format mismatch!! ]
+
+    return frame;
+}
+
+std::optional<Spec> PropertyCodec::toSpec( Frame const &frame ) noexcept
+{
+    return Spec::create( frame.permission
+                       , frame.resolution
+                       , frame.initVal.data(), static_cast<std::uint8_t>( frame.initVal.size() )
+                       , frame.minVal.data() , static_cast<std::uint8_t>( frame.minVal.size() )
+                       , frame.maxVal.data() , static_cast<std::uint8_t>( frame.maxVal.size() ) );
+}
+
+std::optional<Property> PropertyCodec::toProperty( Frame const &frame ) noexcept
+{
+    auto spec = toSpec( frame );
+
+    if ( !spec.has_value() ) { return std::nullopt; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on allocation failure!! ]
+
+    if ( !frame.hasValue )
+    {
+        return Property::create( frame.code, std::move( spec.value() ) );
+    }
+
+    auto value = Value::create( frame.value.data(), static_cast<std::uint8_t>( frame.value.size() ) );
+
+    if ( !value.has_value() ) { return std::nullopt; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on allocation failure!! ]
+
+    return Property::create( frame.code, std::move( spec.value() ), std::move( value.value() ) );
+}
+
+PropertyCodec::Decoder::Result PropertyCodec::Decoder::feed( std::span<std::byte const> input ) noexcept
+{
+    // [===> Follows: Zero-copy path, nothing buffered]
+    if ( pendingSize_ == 0U )
+    {
+        auto const size = frameSizeOf( input );
+
+        if ( !size.has_value() && ( input.size() >= HEADER_SIZE ) )
+        {
+            return Result{ Status::Error, 1U, {} };
+        }
+
+        if ( size.has_value() && ( input.size() >= size.value() ) )
+        {
+            auto const frame = parse( input );
+
+            if ( !frame.has_value() ) { return Result{ Status::Error, 1U, {} }; }
+            // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on malformed frame!! ]
+
+            return Result{ Status::Frame, size.value(), frame.value() };
+        }
+    }
+
+    // [===> Follows: Assemble a split frame in `pending_`]
+    std::size_t consumed = 0U;
+
+    auto const append = [this, &input, &consumed]( std::size_t target ) noexcept
+    {
+        std::size_t const n = std::min( target - pendingSize_, input.size() - consumed );
+        std::memcpy( pending_.data() + pendingSize_, input.data() + consumed, n );
+        pendingSize_ = static_cast<std::uint16_t>( pendingSize_ + n );
+        consumed += n;
+    };
+
+    if ( pendingSize_ < HEADER_SIZE )
+    {
+        append( HEADER_SIZE );
+
+        if ( pendingSize_ < HEADER_SIZE ) { return Result{ Status::NeedMore, consumed, {} }; }
+        // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on partial header!! ]
+    }
+
+    auto const size = frameSizeOf( std::span<std::byte const>( pending_.data(), pendingSize_ ) );
+
+    if ( !size.has_value() )
+    {
+        // Note: Drop the first buffered byte, and hand back the rest of this input to be scanned again.
+        std::size_t const rescan = std::min<std::size_t>( consumed, pendingSize_ - 1U );
+        pendingSize_ = 0U;
+        return Result{ Status::Error, consumed - rescan, {} };
+    }
+
+    append( size.value() );
+
+    if ( pendingSize_ < size.value() ) { return Result{ Status::NeedMore, consumed, {} }; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on partial frame!! ]
+    // [===> Follows: Frame complete]
+
+    auto const frame = parse( std::span<std::byte const>( pending_.data(), size.value() ) );
+
+    pendingSize_ = 0U; // Note: The data stays in `pending_` until the next call.
+
+    if ( !frame.has_value() ) { return Result{ Status::Error, consumed, {} }; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on malformed frame!! ]
+
+    return Result{ Status::Frame, consumed, frame.value() };
+}
+
+/* #endregion */// Public methods.
+
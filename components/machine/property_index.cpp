@@ -0,0 +1,129 @@
+/* Self */
+#include <property_index.hpp>
+
+/* C++ Standard Library */
+#include <algorithm>
+#include <bit>
+
+/* ^\__________________________________________ */
+/* Namespaces.                                  */
+using namespace machine;
+
+
+/* ^\__________________________________________ */
+/* #region Constructors.                        */
+
+PropertyIndex::PropertyIndex( PropertyTable const &table ) noexcept
+    : table_( table )
+    , words_( ( table.size() + WORD_BITS - 1U ) / WORD_BITS )
+    , bitmaps_( PLANES * words_, Word{ 0U } )
+{
+    for ( std::size_t i = 0U; i < table_.size(); i++ )
+    {
+        std::size_t const w = i / WORD_BITS;
+        Word const bit = Word{ 1U } << ( i % WORD_BITS );
+
+        bitmaps_[( PERMISSION_PLANE + static_cast<std::size_t>( table_.permissionAt( i ) ) ) * words_ + w] |= bit;
+        bitmaps_[( FORMAT_PLANE + static_cast<std::size_t>( table_.formatAt( i ) ) ) * words_ + w] |= bit;
+        bitmaps_[( RESOLUTION_PLANE + static_cast<std::size_t>( table_.resolutionAt( i ) ) ) * words_ + w] |= bit;
+    }
+}
+
+/* #endregion */// Constructors.
+
+
+/* ^\__________________________________________ */
+/* #region Public methods.                      */
+
+std::size_t PropertyIndex::select( Filter const &filter, std::span<std::size_t> out, std::size_t from ) const noexcept
+{
+    std::size_t count = 0U;
+
+    forEachWord( filter, from, [&]( std::size_t w, Word bits ) noexcept
+    {
+        while ( ( bits != 0U ) && ( count < out.size() ) )
+        {
+            int const b = std::countr_zero( bits );
+            out[count++] = w * WORD_BITS + static_cast<std::size_t>( b );
+            bits &= bits - 1U; // Note: Clear the lowest set bit.
+        }
+
+        return count < out.size();
+    } );
+
+    return count;
+}
+
+std::size_t PropertyIndex::count( Filter const &filter ) const noexcept
+{
+    std::size_t count = 0U;
+
+    forEachWord( filter, 0U, [&count]( std::size_t, Word bits ) noexcept
+    {
+        count += static_cast<std::size_t>( std::popcount( bits ) );
+        return true;
+    } );
+
+    return count;
+}
+
+/* #endregion */// Public methods.
+
+
+/* ^\__________________________________________ */
+/* #region Private methods.                     */
+
+PropertyIndex::Word PropertyIndex::matchAt( Filter const &filter, std::size_t w ) const noexcept
+{
+    Word bits = ~Word{ 0U };
+
+    // Note: A dimension that accepts every kind matches every property; its bitmaps are not read.
+    if ( filter.permissions != ALL_PERMISSIONS ) { bits &= unionAt( PERMISSION_PLANE, filter.permissions, w ); }
+    if ( ( bits != 0U ) && ( filter.formats != ALL_FORMATS ) ) { bits &= unionAt( FORMAT_PLANE, filter.formats, w ); }
+    if ( ( bits != 0U ) && ( filter.resolutions != ALL_RESOLUTIONS ) ) { bits &= unionAt( RESOLUTION_PLANE, filter.resolutions, w ); }
+
+    return bits;
+}
+
+PropertyIndex::Word PropertyIndex::unionAt( std::size_t first, Mask mask, std::size_t w ) const noexcept
+{
+    Word bits = 0U;
+
+    while ( mask != 0U )
+    {
+        int const k = std::countr_zero( mask );
+        bits |= bitmaps_[( first + static_cast<std::size_t>( k ) ) * words_ + w];
+        mask &= static_cast<Mask>( mask - 1U ); // Note: Clear the lowest set bit.
+    }
+
+    return bits;
+}
+
+template <typename F>
+void PropertyIndex::forEachWord( Filter const &filter, std::size_t from, F &&f ) const noexcept
+{
+    PropertyTable::Indices const range = table_.indicesOf( filter.keys );
+    std::size_t const first = std::max( range.first, from );
+    std::size_t const last = range.last;
+
+    if ( first >= last ) { return; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on empty range!! ]
+
+    std::size_t const lastWord = ( last - 1U ) / WORD_BITS;
+
+    for ( std::size_t w = first / WORD_BITS; w <= lastWord; w++ )
+    {
+        Word bits = matchAt( filter, w );
+
+        // Note: Clip the first and last word to `[first, last)`.
+        if ( w == first / WORD_BITS ) { bits &= ~Word{ 0U } << ( first % WORD_BITS ); }
+        if ( ( w == lastWord ) && ( last % WORD_BITS != 0U ) ) { bits &= ( Word{ 1U } << ( last % WORD_BITS ) ) - 1U; }
+
+        if ( bits == 0U ) { continue; }
+        // [===> Follows: At least one match in this word]
+
+        if ( !f( w, bits ) ) { return; }
+    }
+}
+
+/* #endregion */// Private methods.
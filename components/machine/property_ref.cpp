@@ -0,0 +1,39 @@
+/* Self */
+#include <property_ref.hpp>
+
+/* C++ Standard Library */
+#include <format>
+#include <iterator>
+
+/* Custom Library */
+#include <property_format.hpp>
+
+/* ^\__________________________________________ */
+/* Namespaces.                                  */
+using namespace machine;
+
+
+/* ^\__________________________________________ */
+/* #region Operators.                           */
+
+namespace machine
+{
+    std::ostream &operator<<( std::ostream &os, PropertyRef const &v ) noexcept
+    {
+        std::format_to( std::ostreambuf_iterator<char>( os ), "{}", v );
+        return os;
+    }
+}
+
+/* #endregion */// Operators.
+
+
+/* ^\__________________________________________ */
+/* #region Public methods.                      */
+
+std::string PropertyRef::str() const noexcept
+{
+    return std::format( "{}", *this );
+}
+
+/* #endregion */// Public methods.
@@ -0,0 +1,297 @@
+/* Self */
+#include <property_table.hpp>
+
+/* C++ Standard Library */
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <numeric>
+#include <utility>
+
+/* Custom Library */
+#include <spec.hpp>
+#include <spec_pool.hpp>
+
+/* ^\__________________________________________ */
+/* Namespaces.                                  */
+using namespace machine;
+
+
+/* ^\__________________________________________ */
+/* #region Builder.                             */
+
+void PropertyTable::Builder::reserve( std::size_t count ) noexcept
+{
+    keys_.reserve( count );
+    properties_.reserve( count );
+}
+
+void PropertyTable::Builder::add( Address address, Property &&property ) noexcept
+{
+    keys_.push_back( address );
+    properties_.push_back( std::move( property ) );
+}
+
+bool PropertyTable::Builder::add( std::span<PropertyDescriptor const> catalog ) noexcept
+{
+    reserve( keys_.size() + catalog.size() );
+
+    for ( PropertyDescriptor const &d : catalog )
+    {
+        auto spec = property::Spec::create( d.spec );
+        if ( !spec.has_value() ) { return false; }
+        // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on allocation failure!! ]
+
+        auto property = Property::create( d.address.propertyCode(), std::move( spec.value() ) );
+        if ( !property.has_value() ) { return false; }
+        // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on allocation failure!! ]
+
+        add( d.address, std::move( property.value() ) );
+    }
+
+    return true;
+}
+
+std::optional<PropertyTable> PropertyTable::Builder::build() noexcept
+{
+    std::size_t const count = keys_.size();
+
+    // Note: Sort a permutation, `Property` is movable but not assignable.
+    std::vector<std::uint32_t> order( count );
+    std::iota( order.begin(), order.end(), 0U );
+    std::sort( order.begin(), order.end(), [this]( std::uint32_t a, std::uint32_t b ) noexcept
+    {
+        return keys_[a] < keys_[b];
+    } );
+
+    std::vector<Address> keys;
+    std::vector<Property> properties;
+    keys.reserve( count );
+    properties.reserve( count );
+
+    for ( std::uint32_t const i : order )
+    {
+        keys.push_back( keys_[i] );
+        properties.push_back( std::move( properties_[i] ) );
+    }
+    // [===> Follows: Sorted by key]
+
+    keys_.clear();
+    properties_.clear();
+    // [===> Follows: This builder is empty]
+
+    if ( std::adjacent_find( keys.begin(), keys.end() ) != keys.end() )
+    {
+        return std::nullopt;
+    }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on duplicate address!! ]
+    // [===> Follows: All addresses are unique]
+
+    PropertyTable table{ std::move( keys ), std::move( properties ) };
+
+#if CONFIG_MACHINE_PROPERTY_TABLE_SOA
+    auto const unregistered = []( SpecHandle const &h ) noexcept { return h.get() == property::SpecPool::NONE; };
+    if ( std::ranges::any_of( table.specs_, unregistered ) ) { return std::nullopt; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on a full SpecPool!! ]
+#endif
+
+    return std::optional<PropertyTable>{ std::move( table ) };
+}
+
+/* #endregion */// Builder.
+
+
+/* ^\__________________________________________ */
+/* #region Constructors.                        */
+
+#if CONFIG_MACHINE_PROPERTY_TABLE_SOA
+
+PropertyTable::PropertyTable( std::vector<Address> &&keys
+                            , std::vector<Property> &&properties ) noexcept
+    : keys_( std::move( keys ) )
+    , dirty_( ( keys_.size() + DIRTY_WORD_BITS - 1U ) / DIRTY_WORD_BITS )
+{
+    std::size_t const count = properties.size();
+    codes_.reserve( count );
+    frags_.reserve( count );
+    bounds_.reserve( count );
+    specs_.reserve( count );
+    values_.reserve( count );
+
+    // Note: Takes every property apart; the moved-from shells are dropped with `properties`.
+    for ( Property &p : properties )
+    {
+        codes_.push_back( p.code_ );
+        frags_.push_back( std::bit_cast<std::uint8_t>( p.spec_.frags_ ) );
+        bounds_.push_back( { p.spec_.lowerBound(), p.spec_.upperBound() } );
+        specs_.emplace_back( property::SpecPool::intern( p.spec_ ).value_or( property::SpecPool::NONE ) );
+        values_.push_back( std::move( p.value_ ) );
+    }
+}
+
+#else
+
+PropertyTable::PropertyTable( std::vector<Address> &&keys
+                            , std::vector<Property> &&properties ) noexcept
+    : keys_( std::move( keys ) )
+    , properties_( std::move( properties ) )
+    , dirty_( ( keys_.size() + DIRTY_WORD_BITS - 1U ) / DIRTY_WORD_BITS )
+{ /* Do nothing */ }
+
+#endif
+
+/* #endregion */// Constructors.
+
+
+/* ^\__________________________________________ */
+/* #region Public methods.                      */
+
+std::optional<std::size_t> PropertyTable::indexOf( Address address ) const noexcept
+{
+    std::size_t const i = lowerIndexOf( address.key() );
+
+    if ( ( i < keys_.size() ) && ( keys_[i] == address ) )
+    {
+        return i;
+    }
+
+    return std::nullopt;
+}
+
+PropertyTable::Pointer PropertyTable::find( Address address ) const noexcept
+{
+    auto const i = indexOf( address );
+
+#if CONFIG_MACHINE_PROPERTY_TABLE_SOA
+    return i.has_value() ? Pointer{ at( i.value() ) } : std::nullopt;
+#else
+    return i.has_value() ? &properties_[i.value()] : nullptr;
+#endif
+}
+
+value::SetResult PropertyTable::set( std::size_t index, std::byte const *data, std::uint8_t size ) noexcept
+{
+#if CONFIG_MACHINE_PROPERTY_TABLE_SOA
+    value::SetResult const result = values_[index].setEx( data, size );
+#else
+    value::SetResult const result = properties_[index].setValue( data, size );
+#endif
+
+    if ( result == value::SetResult::Success )
+    {
+        markDirty( index );
+        // [===> Follows: The bit is raised after the value is visible]
+
+        if ( hook_ != nullptr ) { hook_( *this, index, hookContext_ ); }
+    }
+
+    return result;
+}
+
+value::SetResult PropertyTable::set( Address address, std::byte const *data, std::uint8_t size ) noexcept
+{
+    auto const i = indexOf( address );
+
+    if ( !i.has_value() ) { return value::SetResult::IllegalArgument; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on unknown address!! ]
+
+    return set( i.value(), data, size );
+}
+
+std::size_t PropertyTable::takeDirty( std::span<std::size_t> out ) noexcept
+{
+    std::size_t count = 0U;
+
+    for ( std::size_t w = 0U; ( w < dirty_.size() ) && ( count < out.size() ); w++ )
+    {
+        if ( dirty_[w].load( std::memory_order_relaxed ) == 0U ) { continue; }
+        // [===> Follows: At least one bit is set]
+
+        DirtyWord bits = dirty_[w].exchange( 0U, std::memory_order_acquire );
+
+        while ( ( bits != 0U ) && ( count < out.size() ) )
+        {
+            int const b = std::countr_zero( bits );
+            out[count++] = w * DIRTY_WORD_BITS + static_cast<std::size_t>( b );
+            bits &= bits - 1U; // Note: Clear the lowest set bit.
+        }
+
+        if ( bits != 0U )
+        {
+            dirty_[w].fetch_or( bits, std::memory_order_relaxed ); // Note: Did not fit, keep them dirty.
+        }
+    }
+
+    return count;
+}
+
+bool PropertyTable::isDirty( std::size_t index ) const noexcept
+{
+    DirtyWord const bit = DirtyWord{ 1U } << ( index % DIRTY_WORD_BITS );
+
+    return ( dirty_[index / DIRTY_WORD_BITS].load( std::memory_order_relaxed ) & bit ) != 0U;
+}
+
+std::size_t PropertyTable::dirtyCount() const noexcept
+{
+    std::size_t count = 0U;
+
+    for ( std::atomic<DirtyWord> const &word : dirty_ )
+    {
+        count += static_cast<std::size_t>( std::popcount( word.load( std::memory_order_relaxed ) ) );
+    }
+
+    return count;
+}
+
+void PropertyTable::markAllDirty() noexcept
+{
+    for ( std::size_t i = 0U; i < size(); i += DIRTY_WORD_BITS )
+    {
+        std::size_t const n = std::min( DIRTY_WORD_BITS, size() - i );
+        DirtyWord const bits = ( n == DIRTY_WORD_BITS ) ? ~DirtyWord{ 0U } : ( ( DirtyWord{ 1U } << n ) - 1U );
+
+        dirty_[i / DIRTY_WORD_BITS].fetch_or( bits, std::memory_order_release );
+    }
+}
+
+/* #endregion */// Public methods.
+
+
+/* ^\__________________________________________ */
+/* #region Private methods.                     */
+
+std::size_t PropertyTable::lowerIndexOf( Address::Key key ) const noexcept
+{
+    auto const it = std::partition_point( keys_.begin(), keys_.end(), [key]( Address a ) noexcept
+    {
+        return a.key() < key;
+    } );
+
+    return static_cast<std::size_t>( it - keys_.begin() );
+}
+
+PropertyTable::Range PropertyTable::range( Address::Range r ) const noexcept
+{
+    Indices const i = indicesOf( r );
+
+    return range( i.first, i.last - i.first );
+}
+
+PropertyTable::Range PropertyTable::range( std::size_t first, std::size_t count ) const noexcept
+{
+#if CONFIG_MACHINE_PROPERTY_TABLE_SOA
+    return Slice( *this, first, count );
+#else
+    return std::span<Property const>( properties_ ).subspan( first, count );
+#endif
+}
+
+void PropertyTable::markDirty( std::size_t index ) noexcept
+{
+    DirtyWord const bit = DirtyWord{ 1U } << ( index % DIRTY_WORD_BITS );
+
+    dirty_[index / DIRTY_WORD_BITS].fetch_or( bit, std::memory_order_release );
+}
+
+/* #endregion */// Private methods.
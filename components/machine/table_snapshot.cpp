@@ -0,0 +1,154 @@
+/* Self */
+#include <table_snapshot.hpp>
+
+/* C++ Standard Library */
+#include <algorithm>
+#include <utility>
+
+/* ^\__________________________________________ */
+/* Namespaces.                                  */
+using namespace machine;
+using namespace machine::property;
+
+
+/* ^\__________________________________________ */
+/* #region Constructors.                        */
+
+TableSnapshot::TableSnapshot( PropertyTable const &table ) noexcept
+    : offsets_( table.size() )
+    , capacities_( table.size() )
+    , lastChanged_( table.size(), 1U )
+{
+    std::uint32_t total = 0U;
+
+    for ( std::size_t i = 0U; i < table.size(); i++ )
+    {
+        offsets_[i] = total;
+        capacities_[i] = detail::maxSizeOf( table.formatAt( i ) );
+        total += capacities_[i];
+    }
+
+    for ( Buffer &buffer : buffers_ )
+    {
+        buffer.bytes.resize( total );
+        buffer.sizes.resize( table.size() );
+    }
+    // [===> Follows: Layout fixed; every property changed in publication 1]
+
+    static_cast<void>( publishPending( table ) ); // Note: No reader yet, so a copy is free.
+}
+
+TableSnapshot::View::View( View &&other ) noexcept
+    : owner_( std::exchange( other.owner_, nullptr ) )
+    , buffer_( other.buffer_ )
+{ /* Do nothing */ }
+
+TableSnapshot::View::~View() noexcept
+{
+    if ( owner_ )
+    {
+        owner_->buffers_[buffer_].readers.fetch_sub( 1U, std::memory_order_release );
+    }
+}
+
+/* #endregion */// Constructors
+
+
+/* ^\__________________________________________ */
+/* #region Public methods.                      */
+
+TableSnapshot::View TableSnapshot::acquire() const noexcept
+{
+    while ( true )
+    {
+        std::uint8_t const i = current_.load( std::memory_order_acquire );
+        buffers_[i].readers.fetch_add( 1U, std::memory_order_seq_cst );
+
+        // Note: Republished in between; the writer may already be reusing `i`.
+        //       Sequentially consistent, paired with the writer's check of `readers`.
+        if ( current_.load( std::memory_order_seq_cst ) == i ) { return View( this, i ); }
+
+        buffers_[i].readers.fetch_sub( 1U, std::memory_order_release );
+    }
+}
+
+bool TableSnapshot::publish( PropertyTable const &table, std::span<std::size_t const> changed ) noexcept
+{
+    for ( std::size_t index : changed )
+    {
+        lastChanged_[index] = generation_ + 1U;
+    }
+
+    return publishPending( table );
+}
+
+bool TableSnapshot::publishAll( PropertyTable const &table ) noexcept
+{
+    std::fill( lastChanged_.begin(), lastChanged_.end(), generation_ + 1U );
+
+    return publishPending( table );
+}
+
+std::size_t TableSnapshot::View::size() const noexcept
+{
+    return owner_->size();
+}
+
+std::span<std::byte const> TableSnapshot::View::value( std::size_t index ) const noexcept
+{
+    Buffer const &buffer = owner_->buffers_[buffer_];
+
+    return std::span<std::byte const>( buffer.bytes.data() + owner_->offsets_[index], buffer.sizes[index] );
+}
+
+std::uint32_t TableSnapshot::View::generation() const noexcept
+{
+    return owner_->buffers_[buffer_].generation;
+}
+
+/* #endregion */// Public methods.
+
+
+/* ^\__________________________________________ */
+/* #region Private methods.                     */
+
+bool TableSnapshot::publishPending( PropertyTable const &table ) noexcept
+{
+    std::uint8_t const current = current_.load( std::memory_order_relaxed );
+    std::size_t target = BUFFER_COUNT;
+
+    for ( std::size_t i = 0U; i < BUFFER_COUNT; i++ )
+    {
+        bool const free = ( i != current ) || ( generation_ == 0U );
+
+        if ( free && ( buffers_[i].readers.load( std::memory_order_seq_cst ) == 0U ) )
+        {
+            target = i;
+            break;
+        }
+    }
+
+    if ( target == BUFFER_COUNT ) { return false; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on all copies held!! ]
+    // [===> Follows: No reader can start reading `target` until it is published]
+
+    Buffer &buffer = buffers_[target];
+    std::uint32_t const next = generation_ + 1U;
+
+    for ( std::size_t i = 0U; i < offsets_.size(); i++ )
+    {
+        if ( lastChanged_[i] <= buffer.generation ) { continue; }
+        // Note: Unchanged since this copy was written.
+
+        std::span<std::byte> const slot( buffer.bytes.data() + offsets_[i], capacities_[i] );
+        buffer.sizes[i] = table.at( i ).value().copyTo( slot ).value_or( 0U );
+    }
+
+    buffer.generation = next;
+    generation_ = next;
+    current_.store( static_cast<std::uint8_t>( target ), std::memory_order_seq_cst );
+
+    return true;
+}
+
+/* #endregion */// Private methods.
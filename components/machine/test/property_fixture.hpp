@@ -0,0 +1,40 @@
+#pragma once
+
+#include <property_table.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+/** @brief Properties and tables shared by the tests of `machine` and of the components above it. */
+namespace machine::test
+{
+    using property::Permission;
+    using property::Spec;
+
+    /** @brief A one-byte numeric property in `[0, max]`, starting at `init`. */
+    inline Property makeNumber(std::uint8_t code, std::uint8_t init = 0, std::uint8_t max = 100,
+                               Permission::Kind permission = Permission::Kind::ReadWrite)
+    {
+        std::byte min{0}, top{max}, first{init};
+        auto spec = Spec::create(permission, &first, 1, &min, 1, &top, 1);
+        return std::move(Property::create(code, std::move(*spec)).value());
+    }
+
+    /** @brief A text property without limits, starting empty. */
+    inline Property makeText(std::uint8_t code, Permission::Kind permission = Permission::Kind::ReadWrite)
+    {
+        auto spec = Spec::create(permission, nullptr, 0, nullptr, 0, nullptr, 0);
+        return std::move(Property::create(code, std::move(*spec)).value());
+    }
+
+    /** @brief Two numbers and a text at `Address(0, 0, 7, 0, 1..3)`; `max` changes the spec of the first. */
+    inline std::optional<PropertyTable> makeTable(std::uint8_t max = 100)
+    {
+        PropertyTable::Builder builder;
+        builder.add(Address(0, 0, 7, 0, 1), makeNumber(1, 0, max));
+        builder.add(Address(0, 0, 7, 0, 2), makeNumber(2));
+        builder.add(Address(0, 0, 7, 0, 3), makeText(3));
+        return builder.build();
+    }
+}
@@ -0,0 +1,83 @@
+#include <unity.h>
+#include <unity_test_runner.h>
+#include <address.hpp>
+#include <component_format.hpp>
+#include <unit_format.hpp>
+
+#include <algorithm>
+#include <array>
+#include <format>
+#include <sstream>
+#include <unordered_set>
+
+using namespace machine;
+
+
+namespace
+{
+    constexpr Unit THERMAL_2{Unit::Kind::Thermal, 2};
+    constexpr Component FAN_1{0x01, 1};
+    constexpr Address FAN_SPEED{THERMAL_2, FAN_1, 0x10};
+
+    // Note: Packing is constexpr and matches the field constructor of `Address`.
+    static_assert(THERMAL_2.key() == 0x0202);
+    static_assert(FAN_1.key() == 0x0101);
+    static_assert(FAN_SPEED == Address(2, 2, 1, 1, 0x10));
+    static_assert(FAN_SPEED.unit() == THERMAL_2 && FAN_SPEED.component() == FAN_1);
+    static_assert(Unit::fromKey(THERMAL_2.key()) == THERMAL_2);
+    static_assert(Component::fromKey(FAN_1.key()) == FAN_1);
+}
+
+TEST_CASE("Unit and Component pack into keys ordered as addresses", "[Address]")
+{
+    TEST_ASSERT_TRUE(Unit(Unit::Kind::Board).isPrimary());
+    TEST_ASSERT_FALSE(THERMAL_2.isPrimary());
+    TEST_ASSERT_TRUE(Unit::Kind::Thermal == THERMAL_2.kind());
+    TEST_ASSERT_EQUAL(2, THERMAL_2.index());
+    TEST_ASSERT_EQUAL(0x01, FAN_1.code());
+    TEST_ASSERT_EQUAL(1, FAN_1.index());
+
+    // Note: Kind before index, code before index.
+    std::array<Unit, 4> units{Unit(Unit::Kind::Power, 0), Unit(Unit::Kind::Thermal, 3),
+                              Unit(Unit::Kind::Board, 9), Unit(Unit::Kind::Thermal, 1)};
+    std::sort(units.begin(), units.end());
+    for (std::size_t i = 1; i < units.size(); i++)
+    {
+        TEST_ASSERT_TRUE(units[i - 1].key() < units[i].key());
+        TEST_ASSERT_TRUE(Address(units[i - 1], FAN_1, 0xFF) < Address(units[i], Component(0), 0));
+    }
+    TEST_ASSERT_TRUE(Component(1, 9) < Component(2, 0));
+
+    std::unordered_set<Unit> seen(units.begin(), units.end());
+    TEST_ASSERT_EQUAL(4, seen.size());
+    TEST_ASSERT_EQUAL(1, seen.count(Unit(Unit::Kind::Thermal, 3)));
+    TEST_ASSERT_EQUAL(0, seen.count(Unit(Unit::Kind::Thermal, 2)));
+
+    std::unordered_set<Component> components{FAN_1, Component(0x01, 0), FAN_1};
+    TEST_ASSERT_EQUAL(2, components.size());
+}
+
+TEST_CASE("Address ranges of a Unit and a Component", "[Address]")
+{
+    auto const unit = Address::rangeOf(THERMAL_2);
+    TEST_ASSERT_TRUE(unit.first == Address(2, 2, 0, 0, 0).key());
+    TEST_ASSERT_TRUE(unit.last == Address(2, 3, 0, 0, 0).key());
+
+    auto const component = Address::rangeOf(THERMAL_2, FAN_1);
+    TEST_ASSERT_TRUE(component.first == Address(2, 2, 1, 1, 0).key());
+    TEST_ASSERT_TRUE(component.last == Address(2, 2, 1, 2, 0).key());
+    TEST_ASSERT_TRUE(FAN_SPEED.key() >= component.first && FAN_SPEED.key() < component.last);
+}
+
+TEST_CASE("Unit and Component format", "[Address]")
+{
+    TEST_ASSERT_EQUAL_STRING("thermal(2)", std::format("{}", Unit::Kind::Thermal).c_str());
+    TEST_ASSERT_EQUAL_STRING("expansion-board(1)", std::format("{}", Unit::Kind::ExpansionBoard).c_str());
+    TEST_ASSERT_EQUAL_STRING("Unknown(200)", std::format("{}", static_cast<Unit::Kind>(200)).c_str());
+    TEST_ASSERT_EQUAL_STRING("{ kind: thermal(2), index: 2 }", std::format("{}", THERMAL_2).c_str());
+    TEST_ASSERT_EQUAL_STRING("{ code: 0x01, index: 1 }", std::format("{}", FAN_1).c_str());
+
+    std::ostringstream os;
+    os << THERMAL_2 << ' ' << FAN_1 << ' ' << Unit::Kind::Light;
+    TEST_ASSERT_EQUAL_STRING("{ kind: thermal(2), index: 2 } { code: 0x01, index: 1 } light(5)", os.str().c_str());
+}
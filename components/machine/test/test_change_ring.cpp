@@ -0,0 +1,133 @@
+#include <unity.h>
+#include <unity_test_runner.h>
+#include <change_ring.hpp>
+#include "property_fixture.hpp"
+
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+
+using namespace machine;
+using namespace machine::property;
+
+
+namespace
+{
+    using test::makeTable;
+
+    void setNumber(PropertyTable &table, std::size_t index, std::uint8_t number)
+    {
+        std::byte const n{number};
+        TEST_ASSERT_EQUAL(static_cast<int>(value::SetResult::Success), static_cast<int>(table.set(index, &n, 1)));
+    }
+}
+
+TEST_CASE("ChangeRing delivers changes of tracked properties in order", "[ChangeRing]")
+{
+    auto table = makeTable();
+    ChangeRing ring(*table);
+    ring.track(0);
+    ring.track(2);
+    TEST_ASSERT_TRUE(ring.isTracked(0));
+    TEST_ASSERT_FALSE(ring.isTracked(1));
+
+    setNumber(*table, 0, 10);
+    setNumber(*table, 1, 20); // Note: Untracked, no event.
+    setNumber(*table, 0, 11);
+    std::string const text = "abc";
+    auto const bytes = std::as_bytes(std::span(text));
+    TEST_ASSERT_EQUAL(static_cast<int>(value::SetResult::Success), static_cast<int>(table->set(2, bytes.data(), 3)));
+
+    // Note: An unchanged value is not a change.
+    std::byte const same{11};
+    TEST_ASSERT_EQUAL(static_cast<int>(value::SetResult::NoChange), static_cast<int>(table->set(0, &same, 1)));
+
+    TEST_ASSERT_EQUAL(3, ring.size());
+
+    auto first = ring.pop();
+    TEST_ASSERT_TRUE(first.has_value());
+    TEST_ASSERT_EQUAL_UINT32(0, first->index);
+    TEST_ASSERT_TRUE(first->key == table->addressAt(0).key());
+    TEST_ASSERT_TRUE(first->complete);
+    TEST_ASSERT_EQUAL(1, first->bytes().size());
+    TEST_ASSERT_EQUAL_UINT8(10, std::to_integer<std::uint8_t>(first->bytes()[0]));
+
+    auto second = ring.pop();
+    TEST_ASSERT_EQUAL_UINT8(11, std::to_integer<std::uint8_t>(second->bytes()[0]));
+
+    auto third = ring.pop();
+    TEST_ASSERT_EQUAL_UINT32(2, third->index);
+    TEST_ASSERT_TRUE(std::ranges::equal(third->bytes(), bytes));
+
+    TEST_ASSERT_FALSE(ring.pop().has_value());
+    TEST_ASSERT_EQUAL_UINT32(3, ring.stats().pushed);
+
+    // Note: Untracking stops events; the dirty bits are kept either way.
+    ring.track(0, false);
+    setNumber(*table, 0, 12);
+    TEST_ASSERT_EQUAL(0, ring.size());
+    TEST_ASSERT_TRUE(table->isDirty(0));
+}
+
+TEST_CASE("ChangeRing marks properties missed on overflow for a resync", "[ChangeRing]")
+{
+    auto table = makeTable();
+    ChangeRing ring(*table);
+    ring.trackAll();
+    TEST_ASSERT_TRUE(ring.isTracked(2));
+
+    for (std::size_t i = 0; i < ChangeRing::CAPACITY; i++)
+    {
+        setNumber(*table, 0, static_cast<std::uint8_t>((i + 1) % 2)); // Note: Starts at 0, so every write changes it.
+    }
+    TEST_ASSERT_EQUAL(ChangeRing::CAPACITY, ring.size());
+
+    setNumber(*table, 1, 42); // Note: Dropped, the ring is full.
+    setNumber(*table, 0, 99);
+    ChangeRing::Stats const stats = ring.stats();
+    TEST_ASSERT_EQUAL_UINT32(ChangeRing::CAPACITY, stats.pushed);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.overflows);
+
+    std::array<std::size_t, 1> one;
+    TEST_ASSERT_EQUAL(1, ring.takeMissed(one));
+    TEST_ASSERT_EQUAL(0, one[0]);
+    TEST_ASSERT_EQUAL(1, ring.takeMissed(one)); // Note: The rest did not fit the first time.
+    TEST_ASSERT_EQUAL(1, one[0]);
+    TEST_ASSERT_EQUAL(0, ring.takeMissed(one));
+
+    std::size_t popped = 0;
+    while (ring.pop()) { popped++; }
+    TEST_ASSERT_EQUAL(ChangeRing::CAPACITY, popped);
+
+    // Note: With room again, changes are events again.
+    setNumber(*table, 1, 43);
+    TEST_ASSERT_EQUAL(1, ring.size());
+}
+
+TEST_CASE("ChangeRing cuts long values and detaches from the table", "[ChangeRing]")
+{
+    auto table = makeTable();
+    {
+        ChangeRing ring(*table);
+        ring.trackAll();
+
+        std::string const text(ChangeRing::PAYLOAD_SIZE + 3, 'x');
+        auto const bytes = std::as_bytes(std::span(text));
+        TEST_ASSERT_EQUAL(static_cast<int>(value::SetResult::Success),
+                          static_cast<int>(table->set(2, bytes.data(), static_cast<std::uint8_t>(bytes.size()))));
+
+        auto const event = ring.pop();
+        TEST_ASSERT_TRUE(event.has_value());
+        TEST_ASSERT_FALSE(event->complete);
+        TEST_ASSERT_EQUAL(text.size(), event->size);
+        TEST_ASSERT_EQUAL(ChangeRing::PAYLOAD_SIZE, event->bytes().size());
+        TEST_ASSERT_EQUAL_UINT32(1, ring.stats().truncated);
+    }
+
+    // Note: The ring is gone; `set()` must not call into it.
+    setNumber(*table, 0, 5);
+    TEST_ASSERT_TRUE(table->isDirty(0));
+}
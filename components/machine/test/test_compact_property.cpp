@@ -0,0 +1,71 @@
+#include <unity.h>
+#include <unity_test_runner.h>
+#include <compact_property.hpp>
+#include <property.hpp>
+#include <property_format.hpp>
+#include <spec_pool.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+using namespace machine;
+using namespace machine::property;
+
+
+TEST_CASE("SpecPool registers each distinct spec once", "[SpecPool]")
+{
+    std::byte init{50}, min{0}, max{100};
+    auto percent = Spec::create(Permission::Kind::ReadWrite, &init, 1, &min, 1, &max, 1);
+    auto same = Spec::create(Permission::Kind::ReadWrite, &init, 1, &min, 1, &max, 1);
+    auto other = Spec::create(Permission::Kind::ReadOnly, &init, 1, &min, 1, &max, 1);
+    TEST_ASSERT_TRUE(percent.has_value() && same.has_value() && other.has_value());
+    TEST_ASSERT_TRUE(percent->isSameAs(*same));
+    TEST_ASSERT_FALSE(percent->isSameAs(*other));
+    TEST_ASSERT_EQUAL_UINT32(percent->hash(), same->hash());
+
+    std::size_t const before = SpecPool::size();
+    auto const a = SpecPool::intern(*percent);
+    auto const b = SpecPool::intern(*same);
+    auto const c = SpecPool::intern(*other);
+    TEST_ASSERT_TRUE(a.has_value() && b.has_value() && c.has_value());
+    TEST_ASSERT_EQUAL_UINT16(*a, *b);
+    TEST_ASSERT_NOT_EQUAL(*a, *c);
+    TEST_ASSERT_EQUAL_UINT32(before + 2U, SpecPool::size());
+    TEST_ASSERT_EQUAL_UINT32(2U, SpecPool::refCount(*a));
+    TEST_ASSERT_TRUE(SpecPool::specOf(*a).isSameAs(*percent));
+
+    SpecPool::release(*a);
+    SpecPool::release(*b);
+    SpecPool::release(*c);
+    TEST_ASSERT_EQUAL_UINT32(before, SpecPool::size());
+}
+
+TEST_CASE("CompactProperty shares specs and matches Property", "[CompactProperty]")
+{
+    std::byte init{10}, min{0}, max{100};
+    auto spec = Spec::create(Permission::Kind::ReadWrite, &init, 1, &min, 1, &max, 1);
+    TEST_ASSERT_TRUE(spec.has_value());
+    std::size_t const before = SpecPool::size();
+
+    std::vector<CompactProperty> props;
+    for (std::uint8_t code = 0U; code < 8U; code++) {
+        auto p = CompactProperty::create(code, *spec);
+        TEST_ASSERT_TRUE(p.has_value());
+        props.push_back(std::move(*p));
+    }
+    TEST_ASSERT_EQUAL_UINT32(before + 1U, SpecPool::size());
+    TEST_ASSERT_EQUAL_UINT32(8U, SpecPool::refCount(props[0].specHandle()));
+
+    std::byte const next{42};
+    TEST_ASSERT_EQUAL(value::SetResult::Success, props[3].setValue(&next, 1));
+    TEST_ASSERT_TRUE(props[3].spec().isWithinRange(props[3].value()));
+
+    auto full = Property::create(3U, spec->clone());
+    TEST_ASSERT_TRUE(full.has_value());
+    TEST_ASSERT_EQUAL(value::SetResult::Success, full->setValue(&next, 1));
+    TEST_ASSERT_EQUAL_STRING(full->str().c_str(), props[3].str().c_str());
+
+    props.clear();
+    TEST_ASSERT_EQUAL_UINT32(before, SpecPool::size());
+}
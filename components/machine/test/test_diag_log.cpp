@@ -0,0 +1,117 @@
+#include <unity.h>
+#include <unity_test_runner.h>
+#include <diag_log.hpp>
+#include <property_format.hpp>
+
+#include <array>
+#include <bit>
+#include <format>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace machine;
+using namespace machine::property;
+
+
+namespace
+{
+    /** @brief Collects the drained records. */
+    struct Records
+    {
+        std::vector<std::vector<std::byte>> all;
+
+        static void sink(std::span<std::byte const> record, void *context) noexcept
+        {
+            static_cast<Records *>(context)->all.emplace_back(record.begin(), record.end());
+        }
+    };
+
+    std::optional<Spec> makeNumericSpec()
+    {
+        using Array4 = std::array<std::byte, 4>;
+        Array4 min = std::bit_cast<Array4>(INT32_MIN);
+        Array4 max = std::bit_cast<Array4>(INT32_MAX);
+        Array4 init = std::bit_cast<Array4>(-1);
+
+        return Spec::create(Permission::Kind::ReadWrite, Resolution::Kind::X0_01,
+                            init.data(), 4, min.data(), 4, max.data(), 4);
+    }
+}
+
+TEST_CASE("DiagLog records decode to the text formatters", "[DiagLog]")
+{
+    Records records;
+    DiagLog log(DiagLog::Config{&Records::sink, &records});
+
+    auto spec = makeNumericSpec();
+    TEST_ASSERT_TRUE(spec.has_value());
+
+    std::byte const raw{75};
+    auto value = Value::create(&raw, 1);
+    auto property = Property::create(0xA5, spec->clone(), std::move(*value));
+    TEST_ASSERT_TRUE(property.has_value());
+
+    TEST_ASSERT_TRUE(log.log(7, *spec));
+    TEST_ASSERT_TRUE(log.log(8, property->value()));
+    TEST_ASSERT_TRUE(log.log(9, *property));
+
+    // Note: Nothing reaches the sink before the drain.
+    TEST_ASSERT_EQUAL(0, records.all.size());
+    log.drain();
+    TEST_ASSERT_EQUAL(3, records.all.size());
+
+    auto const s = DiagLog::decode(records.all[0]);
+    TEST_ASSERT_TRUE(s.has_value());
+    TEST_ASSERT_EQUAL(static_cast<int>(DiagLog::Kind::Spec), static_cast<int>(s->kind));
+    TEST_ASSERT_EQUAL_UINT16(7, s->tag);
+    TEST_ASSERT_FALSE(s->truncated);
+    TEST_ASSERT_EQUAL_STRING(spec->str().c_str(), s->text.c_str());
+
+    auto const v = DiagLog::decode(records.all[1]);
+    TEST_ASSERT_TRUE(v.has_value());
+    TEST_ASSERT_EQUAL_STRING(property->value().str().c_str(), v->text.c_str());
+
+    auto const p = DiagLog::decode(records.all[2]);
+    TEST_ASSERT_TRUE(p.has_value());
+    TEST_ASSERT_EQUAL_STRING(std::format("{}", *property).c_str(), p->text.c_str());
+
+    TEST_ASSERT_EQUAL_UINT32(3, log.stats().logged);
+}
+
+TEST_CASE("DiagLog drops records when full and cuts long values", "[DiagLog]")
+{
+    Records records;
+    DiagLog log(DiagLog::Config{&Records::sink, &records});
+    auto spec = makeNumericSpec();
+
+    for (std::size_t i = 0; i < DiagLog::CAPACITY; i++)
+    {
+        TEST_ASSERT_TRUE(log.log(1, *spec));
+    }
+    TEST_ASSERT_FALSE(log.log(1, *spec));
+    TEST_ASSERT_EQUAL_UINT32(1, log.stats().dropped);
+
+    log.drain();
+    TEST_ASSERT_EQUAL(DiagLog::CAPACITY, records.all.size());
+
+    // Note: Room again after the drain, also across the wrap of the ring.
+    std::string const text(DiagLog::RECORD_SIZE, 'x');
+    auto const bytes = std::as_bytes(std::span{text});
+    auto longSpec = Spec::create(Permission::Kind::ReadOnly, bytes.data(), static_cast<std::uint8_t>(bytes.size()),
+                                 nullptr, 0, nullptr, 0);
+    TEST_ASSERT_TRUE(longSpec.has_value());
+    TEST_ASSERT_TRUE(log.log(2, *longSpec));
+    log.drain();
+
+    TEST_ASSERT_EQUAL(DiagLog::RECORD_SIZE, records.all.back().size());
+    auto const d = DiagLog::decode(records.all.back());
+    TEST_ASSERT_TRUE(d.has_value());
+    TEST_ASSERT_TRUE(d->truncated);
+    TEST_ASSERT_EQUAL_UINT32(1, log.stats().truncated);
+
+    // Note: A record cut in its middle is rejected.
+    auto cut = records.all.back();
+    cut.pop_back();
+    TEST_ASSERT_FALSE(DiagLog::decode(cut).has_value());
+}
@@ -0,0 +1,213 @@
+#include <unity.h>
+#include <unity_test_runner.h>
+#include <flash_snapshot.hpp>
+#include "property_fixture.hpp"
+
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+#include <sdkconfig.h>
+#if CONFIG_IDF_TARGET_LINUX
+#include <esp_private/partition_linux.h>
+#endif
+
+using namespace machine;
+using namespace machine::property;
+
+
+namespace
+{
+    constexpr FlashSnapshot::Config CONFIG{"propsnap", pdMS_TO_TICKS(60000), true};
+
+    using test::makeNumber;
+    using test::makeTable;
+    using test::makeText;
+
+    void eraseAll()
+    {
+        auto const *partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, CONFIG.label);
+        TEST_ASSERT_NOT_NULL(partition);
+        TEST_ASSERT_EQUAL(ESP_OK, esp_partition_erase_range(partition, 0, partition->size));
+    }
+
+    void setAll(PropertyTable &table, std::uint8_t number, std::string_view text)
+    {
+        std::byte const n{number};
+        TEST_ASSERT_EQUAL(static_cast<int>(value::SetResult::Success), static_cast<int>(table.set(0, &n, 1)));
+        TEST_ASSERT_EQUAL(static_cast<int>(value::SetResult::Success), static_cast<int>(table.set(1, &n, 1)));
+        auto const bytes = std::as_bytes(std::span(text));
+        TEST_ASSERT_EQUAL(static_cast<int>(value::SetResult::Success),
+                          static_cast<int>(table.set(2, bytes.data(), static_cast<std::uint8_t>(bytes.size()))));
+    }
+
+    bool cachedIs(FlashSnapshot const &flash, std::size_t index, std::span<std::byte const> expected)
+    {
+        auto const cached = flash.cached(index);
+        return cached && std::ranges::equal(*cached, expected);
+    }
+}
+
+TEST_CASE("FlashSnapshot serves saved values after a restart until refreshed", "[FlashSnapshot]")
+{
+    eraseAll();
+    {
+        auto table = makeTable();
+        FlashSnapshot flash(*table, CONFIG);
+        TEST_ASSERT_TRUE(flash.open());
+        TEST_ASSERT_FALSE(flash.restored());
+        TEST_ASSERT_FALSE(flash.saveNow()); // Note: Nothing changed yet.
+
+        setAll(*table, 42, "warm");
+        std::array<std::size_t, 3> changed;
+        TEST_ASSERT_EQUAL(3, table->takeDirty(changed));
+        flash.refreshed(changed);
+
+        TEST_ASSERT_FALSE(flash.save()); // Note: Rate-limited since open().
+        TEST_ASSERT_TRUE(flash.saveNow());
+        TEST_ASSERT_EQUAL_UINT32(1, flash.generation());
+    }
+
+    // Note: After the "restart" the table is back at its initial values.
+    auto table = makeTable();
+    FlashSnapshot flash(*table, CONFIG);
+    TEST_ASSERT_TRUE(flash.open());
+    TEST_ASSERT_TRUE(flash.restored());
+    TEST_ASSERT_EQUAL(3, flash.staleCount());
+
+    std::array<std::byte, 1> const n{std::byte{42}};
+    TEST_ASSERT_TRUE(cachedIs(flash, 0, n));
+    TEST_ASSERT_TRUE(cachedIs(flash, 1, n));
+    TEST_ASSERT_TRUE(cachedIs(flash, 2, std::as_bytes(std::span(std::string_view("warm")))));
+
+    // Note: A fresh value replaces the stored one; the others are carried into the next image.
+    std::byte const fresh{7};
+    TEST_ASSERT_EQUAL(static_cast<int>(value::SetResult::Success), static_cast<int>(table->set(0, &fresh, 1)));
+    std::array<std::size_t, 3> changed;
+    std::size_t const count = table->takeDirty(changed);
+    flash.refreshed(std::span(changed).first(count));
+
+    TEST_ASSERT_FALSE(flash.cached(0).has_value());
+    TEST_ASSERT_EQUAL(2, flash.staleCount());
+    TEST_ASSERT_TRUE(flash.saveNow());
+
+    auto later = makeTable();
+    FlashSnapshot reopened(*later, CONFIG);
+    TEST_ASSERT_TRUE(reopened.open());
+    TEST_ASSERT_EQUAL_UINT32(2, reopened.generation());
+    TEST_ASSERT_TRUE(cachedIs(reopened, 0, std::span(&fresh, 1)));
+    TEST_ASSERT_TRUE(cachedIs(reopened, 1, n));
+}
+
+TEST_CASE("FlashSnapshot skips values whose spec changed and other layouts", "[FlashSnapshot]")
+{
+    eraseAll();
+    {
+        auto table = makeTable();
+        FlashSnapshot flash(*table, CONFIG);
+        TEST_ASSERT_TRUE(flash.open());
+        setAll(*table, 5, "abc");
+        std::array<std::size_t, 3> changed;
+        flash.refreshed(std::span(changed).first(table->takeDirty(changed)));
+        TEST_ASSERT_TRUE(flash.saveNow());
+    }
+
+    // Note: Property 1 got a new maximum, e.g. by a firmware update.
+    auto updated = makeTable(200);
+    FlashSnapshot flash(*updated, CONFIG);
+    TEST_ASSERT_TRUE(flash.open());
+    TEST_ASSERT_TRUE(flash.restored());
+    TEST_ASSERT_FALSE(flash.cached(0).has_value());
+    TEST_ASSERT_TRUE(flash.cached(1).has_value());
+    TEST_ASSERT_EQUAL(2, flash.staleCount());
+
+    // Note: A table of other addresses ignores the image altogether.
+    PropertyTable::Builder builder;
+    builder.add(Address(0, 0, 8, 0, 1), makeNumber(1));
+    builder.add(Address(0, 0, 8, 0, 2), makeNumber(2));
+    builder.add(Address(0, 0, 8, 0, 3), makeText(3));
+    auto other = builder.build();
+    FlashSnapshot foreign(*other, CONFIG);
+    TEST_ASSERT_TRUE(foreign.open());
+    TEST_ASSERT_FALSE(foreign.restored());
+}
+
+TEST_CASE("FlashSnapshot falls back to the previous image and wraps the partition", "[FlashSnapshot]")
+{
+    eraseAll();
+    auto const *partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, CONFIG.label);
+    std::size_t const sectors = partition->size / partition->erase_size;
+
+    auto table = makeTable();
+    {
+        FlashSnapshot flash(*table, CONFIG);
+        TEST_ASSERT_TRUE(flash.open());
+
+        // Note: One sector per image, so this passes the end of the partition once.
+        for (std::size_t i = 0; i < sectors + 2; i++)
+        {
+            char const c = static_cast<char>('a' + i % 26);
+            setAll(*table, static_cast<std::uint8_t>(1 + i % 99), std::string_view(&c, 1));
+            std::array<std::size_t, 3> changed;
+            flash.refreshed(std::span(changed).first(table->takeDirty(changed)));
+            TEST_ASSERT_TRUE(flash.saveNow());
+        }
+        TEST_ASSERT_EQUAL_UINT32(sectors + 2, flash.generation());
+    }
+
+    auto fresh = makeTable();
+    FlashSnapshot flash(*fresh, CONFIG);
+    TEST_ASSERT_TRUE(flash.open());
+    TEST_ASSERT_EQUAL_UINT32(sectors + 2, flash.generation());
+
+    // Note: The newest image sits in sector 1; clear bits of its index, as a cut write would.
+    std::byte const zero{0};
+    TEST_ASSERT_EQUAL(ESP_OK, esp_partition_write(partition, partition->erase_size + FlashSnapshot::HEADER_SIZE, &zero, 1));
+
+    auto again = makeTable();
+    FlashSnapshot previous(*again, CONFIG);
+    TEST_ASSERT_TRUE(previous.open());
+    TEST_ASSERT_EQUAL_UINT32(sectors + 1, previous.generation());
+    std::byte const expected{static_cast<std::uint8_t>(1 + sectors % 99)};
+    TEST_ASSERT_TRUE(cachedIs(previous, 0, std::span(&expected, 1)));
+}
+
+#if CONFIG_IDF_TARGET_LINUX
+TEST_CASE("FlashSnapshot saves again after a failed save next to the served image", "[FlashSnapshot]")
+{
+    eraseAll();
+    auto table = makeTable();
+    FlashSnapshot flash(*table, CONFIG);
+    TEST_ASSERT_TRUE(flash.open());
+
+    std::array<std::size_t, 3> changed;
+    setAll(*table, 1, "a");
+    flash.refreshed(std::span(changed).first(table->takeDirty(changed)));
+    TEST_ASSERT_TRUE(flash.saveNow()); // Note: Served from offset 0.
+
+    // Note: Every write of the emulated flash fails, e.g. by a transient flash error.
+    setAll(*table, 2, "b");
+    flash.refreshed(std::span(changed).first(table->takeDirty(changed)));
+    esp_partition_fail_after(0, ESP_PARTITION_FAIL_AFTER_MODE_WRITE);
+    TEST_ASSERT_FALSE(flash.saveNow());
+    esp_partition_fail_after(SIZE_MAX, 0);
+    TEST_ASSERT_EQUAL_UINT32(1, flash.generation());
+
+    // Note: The changes are still pending, and the next image must not aim at the served one.
+    TEST_ASSERT_TRUE(flash.saveNow());
+    TEST_ASSERT_EQUAL_UINT32(2, flash.generation());
+
+    setAll(*table, 3, "c");
+    flash.refreshed(std::span(changed).first(table->takeDirty(changed)));
+    TEST_ASSERT_TRUE(flash.saveNow());
+
+    auto later = makeTable();
+    FlashSnapshot reopened(*later, CONFIG);
+    TEST_ASSERT_TRUE(reopened.open());
+    TEST_ASSERT_EQUAL_UINT32(3, reopened.generation());
+    std::byte const expected{3};
+    TEST_ASSERT_TRUE(cachedIs(reopened, 0, std::span(&expected, 1)));
+}
+#endif
@@ -0,0 +1,155 @@
+#include <unity.h>
+#include <unity_test_runner.h>
+#include <property_codec.hpp>
+
+#include <array>
+#include <utility>
+#include <vector>
+
+using namespace machine;
+using namespace machine::property;
+
+
+namespace
+{
+    Property makeProperty(std::uint8_t code = 0xA5)
+    {
+        std::byte init{0x0A}, min{0x00}, max{0x64};
+        auto spec = Spec::create(Permission::Kind::ReadWrite, Resolution::Kind::X0_5, &init, 1, &min, 1, &max, 1);
+        std::byte current{0x2A};
+        auto value = Value::create(&current, 1);
+        return std::move(Property::create(code, std::move(spec.value()), std::move(value.value())).value());
+    }
+
+    using Status = PropertyCodec::Decoder::Status;
+}
+
+TEST_CASE("PropertyCodec round trip", "[PropertyCodec]")
+{
+    Property const property = makeProperty();
+    std::array<std::byte, PropertyCodec::MAX_FRAME_SIZE> buf {};
+
+    std::size_t const size = PropertyCodec::encode(property, buf);
+    TEST_ASSERT_EQUAL(PropertyCodec::sizeOf(property), size);
+    TEST_ASSERT_EQUAL(PropertyCodec::HEADER_SIZE + 4U, size);
+    TEST_ASSERT_EQUAL(0U, PropertyCodec::encode(property, std::span(buf).first(size - 1U)));
+
+    auto const frame = PropertyCodec::parse(std::span<std::byte const>(buf.data(), size));
+    TEST_ASSERT_TRUE(frame.has_value());
+    TEST_ASSERT_EQUAL_HEX8(0xA5, frame->code);
+    TEST_ASSERT_TRUE(frame->format == Format::Kind::Numeric);
+    TEST_ASSERT_TRUE(frame->permission == Permission::Kind::ReadWrite);
+    TEST_ASSERT_TRUE(frame->resolution == Resolution::Kind::X0_5);
+    TEST_ASSERT_EQUAL_PTR(buf.data() + size - 1U, frame->value.data()); // Note: Zero-copy.
+    TEST_ASSERT_TRUE(property.spec().isWithinRange(frame->value));
+
+    auto const decoded = PropertyCodec::toProperty(*frame);
+    TEST_ASSERT_TRUE(decoded.has_value());
+    TEST_ASSERT_EQUAL_STRING(property.str().c_str(), decoded->str().c_str());
+
+    TEST_ASSERT_FALSE(PropertyCodec::parse(std::span<std::byte const>(buf.data(), size - 1U)).has_value());
+}
+
+TEST_CASE("PropertyCodec spec-only frame", "[PropertyCodec]")
+{
+    Property const property = makeProperty();
+    std::array<std::byte, 32U> buf {};
+
+    std::size_t const size = PropertyCodec::encode(0x01, property.spec(), buf);
+    TEST_ASSERT_EQUAL(PropertyCodec::HEADER_SIZE + 3U, size);
+
+    auto const frame = PropertyCodec::parse(buf);
+    TEST_ASSERT_TRUE(frame.has_value());
+    TEST_ASSERT_TRUE(frame->value.empty());
+    TEST_ASSERT_FALSE(frame->hasValue);
+
+    auto const decoded = PropertyCodec::toProperty(*frame);
+    TEST_ASSERT_TRUE(decoded.has_value());
+    TEST_ASSERT_EQUAL(0x0A, decoded->value().view()[0]);
+}
+
+TEST_CASE("PropertyCodec round trip of an empty value", "[PropertyCodec]")
+{
+    std::byte const init[] = {std::byte{'a'}, std::byte{'b'}};
+    auto spec = Spec::create(Permission::Kind::ReadWrite, init, 2, nullptr, 0, nullptr, 0);
+    auto value = Value::create(nullptr, 0);
+    Property const property = std::move(Property::create(0x03, std::move(spec.value()), std::move(value.value())).value());
+    std::array<std::byte, 32U> buf {};
+
+    std::size_t const size = PropertyCodec::encode(property, buf);
+    TEST_ASSERT_EQUAL(PropertyCodec::sizeOf(property), size);
+
+    auto const frame = PropertyCodec::parse(buf);
+    TEST_ASSERT_TRUE(frame.has_value());
+    TEST_ASSERT_TRUE(frame->value.empty());
+    TEST_ASSERT_TRUE(frame->hasValue);
+
+    // Note: Stays empty instead of falling back to the initial value.
+    auto const decoded = PropertyCodec::toProperty(*frame);
+    TEST_ASSERT_TRUE(decoded.has_value());
+    TEST_ASSERT_EQUAL(0U, decoded->value().size());
+    TEST_ASSERT_EQUAL(2U, decoded->spec().initVal().size());
+
+    // Note: Value bytes without the value present bit are malformed.
+    buf[1] &= std::byte{0x7F};
+    buf[5] = std::byte{0x01};
+    TEST_ASSERT_FALSE(PropertyCodec::frameSizeOf(buf).has_value());
+}
+
+TEST_CASE("PropertyCodec decoder resumes across partial frames", "[PropertyCodec]")
+{
+    Property const property = makeProperty();
+    std::vector<std::byte> stream(3U * PropertyCodec::sizeOf(property));
+    std::size_t const size = PropertyCodec::encode(property, stream);
+    TEST_ASSERT_EQUAL(size, PropertyCodec::encode(property, std::span(stream).subspan(size)));
+    TEST_ASSERT_EQUAL(size, PropertyCodec::encode(property, std::span(stream).subspan(2U * size)));
+
+    // Note: Deliver in chunks of 1, 3 and 7 bytes.
+    for (std::size_t chunk : { 1U, 3U, 7U })
+    {
+        PropertyCodec::Decoder decoder;
+        std::size_t frames = 0U;
+
+        for (std::size_t base = 0U; base < stream.size(); base += chunk)
+        {
+            auto input = std::span<std::byte const>(stream).subspan(base, std::min(chunk, stream.size() - base));
+
+            while (!input.empty())
+            {
+                auto const r = decoder.feed(input);
+                input = input.subspan(r.consumed);
+                TEST_ASSERT_TRUE(r.status != Status::Error);
+
+                if (r.status == Status::Frame)
+                {
+                    TEST_ASSERT_EQUAL_HEX8(0xA5, r.frame.code);
+                    TEST_ASSERT_EQUAL_HEX8(0x2A, std::to_integer<std::uint8_t>(r.frame.value[0]));
+                    frames++;
+                }
+            }
+        }
+
+        TEST_ASSERT_EQUAL(3U, frames);
+        TEST_ASSERT_EQUAL(0U, decoder.pending());
+    }
+}
+
+TEST_CASE("PropertyCodec decoder resynchronizes", "[PropertyCodec]")
+{
+    // Note: Read one byte early, the code 0x25 is a fragments byte without the value present bit.
+    Property const property = makeProperty(0x25);
+    std::array<std::byte, 64U> stream {};
+    stream[0] = std::byte{0xFF};
+    std::size_t const size = PropertyCodec::encode(property, std::span(stream).subspan(1U));
+
+    PropertyCodec::Decoder decoder;
+    auto input = std::span<std::byte const>(stream).first(1U + size);
+
+    auto const r1 = decoder.feed(input);
+    TEST_ASSERT_TRUE(r1.status == Status::Error);
+    TEST_ASSERT_EQUAL(1U, r1.consumed);
+
+    auto const r2 = decoder.feed(input.subspan(r1.consumed));
+    TEST_ASSERT_TRUE(r2.status == Status::Frame);
+    TEST_ASSERT_EQUAL(size, r2.consumed);
+}
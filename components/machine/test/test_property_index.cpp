@@ -0,0 +1,118 @@
+#include <unity.h>
+#include <unity_test_runner.h>
+#include <property_index.hpp>
+
+#include <array>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+using namespace machine;
+using namespace machine::property;
+
+
+namespace
+{
+    constexpr std::size_t COUNT = 100;
+
+    Permission::Kind permissionOf(std::size_t i) { return Permission::fromRaw(static_cast<std::uint8_t>(i % 4)); }
+
+    Resolution::Kind resolutionOf(std::size_t i) { return Resolution::fromRaw(static_cast<std::uint8_t>(i % 3)); }
+
+    bool isText(std::size_t i) { return i % 5 == 0; }
+
+    /** @brief Unit kind 1 for indices below 40, unit kind 2 above. */
+    Address addressOf(std::size_t i)
+    {
+        return (i < 40) ? Address(1, 0, 1, 0, static_cast<std::uint8_t>(i))
+                        : Address(2, static_cast<std::uint8_t>(i / 64), 1, 0, static_cast<std::uint8_t>(i));
+    }
+
+    std::optional<PropertyTable> makeTable()
+    {
+        PropertyTable::Builder builder;
+        for (std::size_t i = 0; i < COUNT; i++)
+        {
+            std::byte min{0}, max{100}, init{0};
+            auto spec = isText(i) ? Spec::create(permissionOf(i), nullptr, 0, nullptr, 0, nullptr, 0)
+                                  : Spec::create(permissionOf(i), resolutionOf(i), &init, 1, &min, 1, &max, 1);
+            builder.add(addressOf(i), std::move(Property::create(static_cast<std::uint8_t>(i), std::move(*spec)).value()));
+        }
+        return builder.build();
+    }
+
+    /** @brief The same query by reading every spec. */
+    std::vector<std::size_t> scan(PropertyTable const &table, PropertyIndex::Filter const &filter)
+    {
+        std::vector<std::size_t> found;
+        for (std::size_t i = 0; i < table.size(); i++)
+        {
+            Address::Key const key = table.addressAt(i).key();
+            if ((filter.permissions & PropertyIndex::maskOf(table.permissionAt(i))) &&
+                (filter.formats & PropertyIndex::maskOf(table.formatAt(i))) &&
+                (filter.resolutions & PropertyIndex::maskOf(table.resolutionAt(i))) &&
+                (key >= filter.keys.first) && (key < filter.keys.last))
+            {
+                found.push_back(i);
+            }
+        }
+        return found;
+    }
+
+    std::vector<std::size_t> selectAll(PropertyIndex const &index, PropertyIndex::Filter const &filter)
+    {
+        std::vector<std::size_t> found;
+        std::array<std::size_t, 7> page; // Note: Small on purpose, so queries take several calls.
+        std::size_t from = 0;
+        std::size_t n;
+        while ((n = index.select(filter, page, from)) > 0)
+        {
+            found.insert(found.end(), page.begin(), page.begin() + n);
+            from = page[n - 1] + 1;
+        }
+        return found;
+    }
+}
+
+TEST_CASE("PropertyIndex selects the same properties as a scan", "[PropertyIndex]")
+{
+    auto table = makeTable();
+    TEST_ASSERT_TRUE(table.has_value());
+    PropertyIndex const index(*table);
+
+    std::array<PropertyIndex::Filter, 5> const filters{{
+        {},
+        {.permissions = PropertyIndex::READABLE, .formats = PropertyIndex::maskOf(Format::Kind::Numeric)},
+        {.permissions = PropertyIndex::WRITABLE, .formats = PropertyIndex::maskOf(Format::Kind::String),
+         .keys = Address(2, 0, 0, 0, 0).unitKindRange()},
+        {.resolutions = PropertyIndex::maskOf(Resolution::Kind::X5), .keys = Address(2, 1, 0, 0, 0).unitRange()},
+        {.permissions = PropertyIndex::maskOf(Permission::Kind::None), .keys = Address(1, 0, 0, 0, 0).unitKindRange()},
+    }};
+
+    for (auto const &filter : filters)
+    {
+        auto const expected = scan(*table, filter);
+        TEST_ASSERT_TRUE(selectAll(index, filter) == expected);
+        TEST_ASSERT_EQUAL(expected.size(), index.count(filter));
+    }
+    TEST_ASSERT_EQUAL(COUNT, index.count({}));
+}
+
+TEST_CASE("PropertyIndex handles empty results and ranges", "[PropertyIndex]")
+{
+    auto table = makeTable();
+    PropertyIndex const index(*table);
+    std::array<std::size_t, 4> out;
+
+    // Note: No BitSet in the table, and no unit of kind 9.
+    TEST_ASSERT_EQUAL(0, index.select({.formats = PropertyIndex::maskOf(Format::Kind::BitSet)}, out));
+    TEST_ASSERT_EQUAL(0, index.count({.keys = Address(9, 0, 0, 0, 0).unitKindRange()}));
+    TEST_ASSERT_EQUAL(0, index.count({.formats = 0}));
+    TEST_ASSERT_EQUAL(0, index.select({}, out, COUNT));
+
+    PropertyTable const empty;
+    PropertyIndex const none(empty);
+    TEST_ASSERT_EQUAL(0, none.select({}, out));
+    TEST_ASSERT_EQUAL(0, none.count({}));
+}
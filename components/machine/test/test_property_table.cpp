@@ -0,0 +1,181 @@
+#include <unity.h>
+#include <unity_test_runner.h>
+#include <property_table.hpp>
+#include "property_fixture.hpp"
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <utility>
+
+using namespace machine;
+using namespace machine::property;
+
+
+namespace
+{
+    /** @brief A number that starts at its own code. */
+    Property makeProperty(std::uint8_t code) { return test::makeNumber(code, code); }
+}
+
+TEST_CASE("PropertyTable sorted lookup and ranges", "[PropertyTable]")
+{
+    PropertyTable::Builder builder;
+
+    // Note: Added out of order on purpose.
+    builder.add(Address(1, 0, 7, 0, 2), makeProperty(2));
+    builder.add(Address(0, 0, 3, 1, 9), makeProperty(9));
+    builder.add(Address(1, 0, 7, 0, 1), makeProperty(1));
+    builder.add(Address(0, 0, 3, 0, 5), makeProperty(5));
+    builder.add(Address(1, 1, 7, 0, 1), makeProperty(11));
+
+    auto table = builder.build();
+    TEST_ASSERT_TRUE(table.has_value());
+    TEST_ASSERT_EQUAL(5, table->size());
+
+    for (std::size_t i = 1; i < table->size(); i++)
+    {
+        TEST_ASSERT_TRUE(table->addressAt(i - 1) < table->addressAt(i));
+    }
+
+    auto const p = table->find(Address(1, 0, 7, 0, 2));
+    TEST_ASSERT_TRUE(p);
+    TEST_ASSERT_EQUAL_UINT8(2, p->code());
+    TEST_ASSERT_FALSE(table->find(Address(1, 0, 7, 0, 3)));
+
+    auto unit = table->unit(Address(1, 0, 0, 0, 0));
+    TEST_ASSERT_EQUAL(2, unit.size());
+    TEST_ASSERT_EQUAL_UINT8(1, unit[0].code());
+    TEST_ASSERT_EQUAL_UINT8(2, unit[1].code());
+
+    auto component = table->component(Address(0, 0, 3, 1, 0));
+    TEST_ASSERT_EQUAL(1, component.size());
+    TEST_ASSERT_EQUAL_UINT8(9, component[0].code());
+
+    TEST_ASSERT_EQUAL(0, table->unit(Address(2, 0, 0, 0, 0)).size());
+
+    // Note: Both layouts' ranges work with the standard algorithms.
+    static_assert(std::ranges::forward_range<PropertyTable::Range>);
+    TEST_ASSERT_EQUAL(2, std::distance(unit.begin(), unit.end()));
+    TEST_ASSERT_EQUAL(5, std::ranges::distance(table->properties()));
+    auto const it = std::ranges::find_if(table->properties(), [](auto const &p) { return p.code() == 9; });
+    TEST_ASSERT_TRUE(it != table->properties().end());
+    TEST_ASSERT_EQUAL_UINT8(9, (*it).code());
+    TEST_ASSERT_EQUAL(1, std::ranges::count_if(unit, [](auto const &p) { return p.code() == 2; }));
+}
+
+TEST_CASE("PropertyTable rejects duplicate addresses", "[PropertyTable]")
+{
+    PropertyTable::Builder builder;
+    builder.add(Address(0, 0, 1, 0, 1), makeProperty(1));
+    builder.add(Address(0, 0, 1, 0, 1), makeProperty(1));
+
+    TEST_ASSERT_FALSE(builder.build().has_value());
+}
+
+TEST_CASE("PropertyTable tracks changed values", "[PropertyTable]")
+{
+    PropertyTable::Builder builder;
+
+    for (std::uint8_t code = 0; code < 40; code++)
+    {
+        builder.add(Address(0, 0, 1, 0, code), makeProperty(code));
+    }
+
+    auto table = builder.build();
+    TEST_ASSERT_TRUE(table.has_value());
+    TEST_ASSERT_EQUAL(0U, table->dirtyCount());
+
+    std::byte const v{0x55};
+    std::byte const same = table->at(35).value().view()[0];
+    TEST_ASSERT_EQUAL(static_cast<int>(value::SetResult::NoChange),
+                      static_cast<int>(table->set(35, &same, 1)));
+    TEST_ASSERT_FALSE(table->isDirty(35));
+
+    TEST_ASSERT_EQUAL(static_cast<int>(value::SetResult::Success),
+                      static_cast<int>(table->set(Address(0, 0, 1, 0, 35), &v, 1)));
+    TEST_ASSERT_EQUAL(static_cast<int>(value::SetResult::Success), static_cast<int>(table->set(3, &v, 1)));
+    TEST_ASSERT_EQUAL(static_cast<int>(value::SetResult::Success), static_cast<int>(table->set(31, &v, 1)));
+    TEST_ASSERT_EQUAL(static_cast<int>(value::SetResult::IllegalArgument),
+                      static_cast<int>(table->set(Address(0, 0, 2, 0, 0), &v, 1)));
+    TEST_ASSERT_EQUAL(3U, table->dirtyCount());
+    TEST_ASSERT_TRUE(table->isDirty(35));
+
+    // Note: Smaller than the changed set, the rest stays dirty.
+    std::array<std::size_t, 2U> out {};
+    TEST_ASSERT_EQUAL(2U, table->takeDirty(out));
+    TEST_ASSERT_EQUAL(3U, out[0]);
+    TEST_ASSERT_EQUAL(31U, out[1]);
+    TEST_ASSERT_EQUAL(1U, table->takeDirty(out));
+    TEST_ASSERT_EQUAL(35U, out[0]);
+    TEST_ASSERT_EQUAL(0U, table->takeDirty(out));
+
+    table->markAllDirty();
+    TEST_ASSERT_EQUAL(40U, table->dirtyCount());
+}
+
+TEST_CASE("PropertyTable column accessors match the properties", "[PropertyTable]")
+{
+    PropertyTable::Builder builder;
+    builder.add(Address(0, 0, 1, 0, 1), makeProperty(1));
+    builder.add(Address(0, 0, 1, 0, 2), makeProperty(2));
+
+    std::byte const mask{0x0F};
+    auto bits = Spec::create(Permission::Kind::ReadOnly, nullptr, 0, nullptr, 0, &mask, 1);
+    builder.add(Address(0, 0, 1, 0, 3), std::move(Property::create(3, std::move(*bits)).value()));
+
+    auto table = builder.build();
+    TEST_ASSERT_TRUE(table.has_value());
+
+    std::size_t i = 0;
+    for (auto const &p : table->properties())
+    {
+        TEST_ASSERT_EQUAL_UINT8(p.code(), table->codeAt(i));
+        TEST_ASSERT_EQUAL(static_cast<int>(p.spec().format()), static_cast<int>(table->formatAt(i)));
+        TEST_ASSERT_EQUAL(static_cast<int>(p.spec().permission()), static_cast<int>(table->permissionAt(i)));
+        i++;
+    }
+    TEST_ASSERT_EQUAL(3, i);
+    TEST_ASSERT_EQUAL(static_cast<int>(Format::Kind::BitSet), static_cast<int>(table->formatAt(2)));
+    TEST_ASSERT_EQUAL(static_cast<int>(Permission::Kind::ReadOnly), static_cast<int>(table->permissionAt(2)));
+
+    std::byte const inside{100}, outside{101}, outsideMask{0x10};
+    TEST_ASSERT_TRUE(table->isWithinRange(0, std::span(&inside, 1)));
+    TEST_ASSERT_FALSE(table->isWithinRange(0, std::span(&outside, 1)));
+    TEST_ASSERT_TRUE(table->isWithinRange(2, std::span(&mask, 1)));
+    TEST_ASSERT_FALSE(table->isWithinRange(2, std::span(&outsideMask, 1)));
+
+    // Note: Values written through the table are seen through at().
+    std::byte const v{42};
+    TEST_ASSERT_EQUAL(static_cast<int>(value::SetResult::Success), static_cast<int>(table->set(1, &v, 1)));
+    TEST_ASSERT_EQUAL_UINT8(42, std::to_integer<std::uint8_t>(table->at(1).value().view()[0]));
+    TEST_ASSERT_EQUAL_STRING(table->at(1).str().c_str(), PropertyRef(table->at(1)).str().c_str());
+}
+
+#if CONFIG_MACHINE_PROPERTY_TABLE_SOA
+TEST_CASE("PropertyTable column layout shares specs through SpecPool", "[PropertyTable]")
+{
+    std::size_t const before = SpecPool::size();
+    {
+        PropertyTable::Builder builder;
+        builder.add(Address(0, 0, 8, 0, 1), test::makeNumber(1, 5));
+        builder.add(Address(0, 0, 8, 0, 2), test::makeNumber(2, 5));
+        builder.add(Address(0, 0, 8, 0, 3), test::makeNumber(3, 6));
+
+        auto table = builder.build();
+        TEST_ASSERT_TRUE(table.has_value());
+        TEST_ASSERT_EQUAL(before + 2U, SpecPool::size());
+        TEST_ASSERT_EQUAL_PTR(&table->at(0).spec(), &table->at(1).spec());
+        TEST_ASSERT_EQUAL_UINT8(3, table->at(2).code());
+        TEST_ASSERT_EQUAL(6, table->at(2).spec().initVal().view()[0]);
+
+        // Note: A moved table keeps the references; the moved-from one holds none.
+        PropertyTable moved = std::move(*table);
+        *table = std::move(moved);
+        TEST_ASSERT_EQUAL(before + 2U, SpecPool::size());
+    }
+    TEST_ASSERT_EQUAL(before, SpecPool::size());
+}
+#endif
@@ -0,0 +1,76 @@
+#include <unity.h>
+#include <unity_test_runner.h>
+#include <resolution.hpp>
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+using namespace machine::property;
+
+
+// Note: CONFIG_UNITY_ENABLE_64BIT is off, so 64-bit results are compared with TEST_ASSERT_TRUE.
+namespace
+{
+    using Kind = Resolution::Kind;
+
+    static_assert(Resolution::toMillis(51, Kind::X0_5) == 25500);
+    static_assert(Resolution::toMillis(3, Kind::X50) == 150000);
+    static_assert(Resolution::toScaled(51, Kind::X0_5) == Resolution::Scaled{ 255, -1 });
+    static_assert(Resolution::fromMillis(25500, Kind::X0_5) == 51);
+    static_assert(Resolution::scaleFactorOf(Kind::X0_05) == 0.05);
+}
+
+TEST_CASE("Resolution scale factors match shift and coefficient", "[Resolution]")
+{
+    constexpr std::array<std::int64_t, 8U> expected = { 1000, 5000, 10000, 50000, 10, 50, 100, 500 };
+
+    for (std::uint8_t i = 0U; i < expected.size(); i++)
+    {
+        auto const kind = static_cast<Kind>(i);
+        TEST_ASSERT_TRUE(expected[i] == Resolution::toMillis(1, kind));
+        TEST_ASSERT_TRUE(static_cast<double>(expected[i]) / 1000.0 == Resolution::scaleFactorOf(kind));
+    }
+}
+
+TEST_CASE("Resolution converts to and from millis", "[Resolution]")
+{
+    TEST_ASSERT_TRUE(-70 == Resolution::toMillis(-7, Kind::X0_01));
+    TEST_ASSERT_TRUE(static_cast<std::int64_t>(std::numeric_limits<std::int32_t>::min()) * 50000
+                     == Resolution::toMillis(std::numeric_limits<std::int32_t>::min(), Kind::X50));
+
+    TEST_ASSERT_EQUAL_INT32(-7, Resolution::fromMillis(-70, Kind::X0_01).value());
+    TEST_ASSERT_EQUAL_INT32(5, Resolution::fromMillis(2600, Kind::X0_5).value());   // Note: 5.2 → 5
+    TEST_ASSERT_EQUAL_INT32(6, Resolution::fromMillis(2750, Kind::X0_5).value());   // Note: 5.5 → 6
+    TEST_ASSERT_EQUAL_INT32(-6, Resolution::fromMillis(-2750, Kind::X0_5).value()); // Note: -5.5 → -6
+    TEST_ASSERT_EQUAL_INT32(0, Resolution::fromMillis(4, Kind::X0_01).value());     // Note: 0.4 → 0
+}
+
+TEST_CASE("Resolution rejects unrepresentable values", "[Resolution]")
+{
+    TEST_ASSERT_FALSE(Resolution::fromMillis(std::numeric_limits<std::int64_t>::max(), Kind::X0_01).has_value());
+    TEST_ASSERT_FALSE(Resolution::fromScaled({ 1, 19 }, Kind::X1).has_value());
+    TEST_ASSERT_TRUE(Resolution::fromScaled({ 1, -19 }, Kind::X1) == std::nullopt);
+
+    auto const lowest = std::numeric_limits<std::int32_t>::min();
+    TEST_ASSERT_EQUAL_INT32(lowest, Resolution::fromScaled({ lowest, 0 }, Kind::X1).value());
+    TEST_ASSERT_FALSE(Resolution::fromScaled({ static_cast<std::int64_t>(lowest) - 1, 0 }, Kind::X1).has_value());
+}
+
+TEST_CASE("Resolution converts batches", "[Resolution]")
+{
+    std::array<std::int32_t, 4U> const raw = { 0, 1, -2, 51 };
+    std::array<std::int64_t, 4U> millis {};
+
+    TEST_ASSERT_EQUAL(4U, Resolution::toMillis(raw, Kind::X0_5, millis));
+    TEST_ASSERT_TRUE(25500 == millis[3]);
+    TEST_ASSERT_TRUE(-1000 == millis[2]);
+
+    std::array<std::int32_t, 4U> back {};
+    TEST_ASSERT_EQUAL(4U, Resolution::fromMillis(millis, Kind::X0_5, back));
+    TEST_ASSERT_EQUAL_INT32_ARRAY(raw.data(), back.data(), raw.size());
+
+    std::array<std::int64_t, 3U> const mixed = { 10, std::numeric_limits<std::int64_t>::max(), 20 };
+    TEST_ASSERT_EQUAL(1U, Resolution::fromMillis(mixed, Kind::X0_01, back));
+    TEST_ASSERT_EQUAL_INT32(1, back[0]);
+}
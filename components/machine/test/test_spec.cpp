@@ -0,0 +1,124 @@
+#include <unity.h>
+#include <unity_test_runner.h>
+#include <intern_pool.hpp>
+#include <spec.hpp>
+#include <spec_format.hpp>
+#include <format_util.hpp>
+
+#include <array>
+#include <format>
+
+using namespace machine::property;
+
+
+TEST_CASE("Spec pre-decoded numeric bounds", "[Spec]")
+{
+    std::byte min{12}, max{70}, init{33};
+    auto spec = Spec::create(Permission::Kind::ReadWrite, &init, 1, &min, 1, &max, 1);
+    TEST_ASSERT_TRUE(spec.has_value());
+
+    TEST_ASSERT_EQUAL_INT32(12, spec->lowerBound());
+    TEST_ASSERT_EQUAL_INT32(70, spec->upperBound());
+    TEST_ASSERT_TRUE(spec->isWithinRange(std::int32_t{12}));
+    TEST_ASSERT_TRUE(spec->isWithinRange(std::int32_t{70}));
+    TEST_ASSERT_FALSE(spec->isWithinRange(std::int32_t{71}));
+    TEST_ASSERT_TRUE(spec->isWithinRange(spec->initVal()));
+}
+
+TEST_CASE("Spec numeric bounds are signed", "[Spec]")
+{
+    std::byte min{0xF6}, max{0x0A}, init{0xFF}; // Note: -10, 10, -1
+    auto spec = Spec::create(Permission::Kind::ReadWrite, &init, 1, &min, 1, &max, 1);
+    TEST_ASSERT_TRUE(spec.has_value());
+
+    TEST_ASSERT_EQUAL_INT32(-10, spec->lowerBound());
+    TEST_ASSERT_EQUAL_INT32(10, spec->upperBound());
+    TEST_ASSERT_TRUE(spec->isWithinRange(spec->initVal()));
+
+    std::byte const below[] = {std::byte{0xF5}};
+    std::byte const wide[] = {std::byte{0xFB}, std::byte{0xFF}}; // Note: -5 in 2 bytes
+    std::byte const large[] = {std::byte{0xFB}, std::byte{0x00}}; // Note: 251
+    TEST_ASSERT_FALSE(spec->isWithinRange(std::span<std::byte const>(below)));
+    TEST_ASSERT_TRUE(spec->isWithinRange(std::span<std::byte const>(wide)));
+    TEST_ASSERT_FALSE(spec->isWithinRange(std::span<std::byte const>(large)));
+}
+
+TEST_CASE("Spec bitset mask keeps all 32 bits", "[Spec]")
+{
+    std::array<std::byte, 4> const mask{std::byte{0x00}, std::byte{0x00}, std::byte{0x00}, std::byte{0x80}};
+    auto spec = Spec::create(Permission::Kind::ReadOnly, nullptr, 0, nullptr, 0, mask.data(), 4);
+    TEST_ASSERT_TRUE(spec.has_value());
+
+    std::byte const top[] = {std::byte{0x00}, std::byte{0x00}, std::byte{0x00}, std::byte{0x80}};
+    std::byte const byte0[] = {std::byte{0x80}}; // Note: Not sign-extended into bit 31.
+    TEST_ASSERT_TRUE(spec->isWithinRange(std::span<std::byte const>(top)));
+    TEST_ASSERT_FALSE(spec->isWithinRange(std::span<std::byte const>(byte0)));
+}
+
+TEST_CASE("Spec bitset mask", "[Spec]")
+{
+    std::byte mask{0x0C};
+    auto spec = Spec::create(Permission::Kind::ReadOnly, nullptr, 0, nullptr, 0, &mask, 1);
+    TEST_ASSERT_TRUE(spec.has_value());
+
+    std::byte inside[] = {std::byte{0x04}};
+    std::byte outside[] = {std::byte{0x01}};
+    TEST_ASSERT_TRUE(spec->isWithinRange(std::span<std::byte const>(inside)));
+    TEST_ASSERT_FALSE(spec->isWithinRange(std::span<std::byte const>(outside)));
+}
+
+TEST_CASE("Spec formatter matches str()", "[Spec]")
+{
+    std::byte min{0}, max{0x10}, init{0x0A};
+    auto spec = Spec::create(Permission::Kind::ReadWrite, Resolution::Kind::X0_5, &init, 1, &min, 1, &max, 1);
+    TEST_ASSERT_TRUE(spec.has_value());
+
+    std::array<char, 256> buf;
+    std::string_view const text = util::formatTo(buf, "{}", *spec);
+    TEST_ASSERT_EQUAL_STRING(
+        "{ format: numeric(0), permission: read-write(3), resolution: x0.5(7)"
+        ", initial_value: [ 0x0A ], minimum_value: [ 0x00 ], maximum_value: [ 0x10 ] }",
+        text.data());
+    TEST_ASSERT_EQUAL_STRING(spec->str().c_str(), text.data());
+
+    std::array<char, 10> small;
+    TEST_ASSERT_EQUAL_STRING("{ format:", util::formatTo(small, "{}", *spec).data());
+}
+
+TEST_CASE("Spec shares identical values", "[Spec]")
+{
+    char const label[] = "percent";
+    auto const *text = reinterpret_cast<std::byte const *>(label);
+    std::byte min{0}, max{100};
+    std::size_t const before = InternPool::size();
+
+    auto a = Spec::create(Permission::Kind::ReadOnly, text, sizeof(label) - 1U, nullptr, 0, nullptr, 0);
+    auto b = Spec::create(Permission::Kind::ReadWrite, text, sizeof(label) - 1U, nullptr, 0, nullptr, 0);
+    auto c = Spec::create(Permission::Kind::ReadWrite, &max, 1, &min, 1, &max, 1);
+    TEST_ASSERT_TRUE(a.has_value() && b.has_value() && c.has_value());
+
+    TEST_ASSERT_TRUE(&a->initVal() == &b->initVal());
+    TEST_ASSERT_TRUE(&c->initVal() == &c->maxVal());
+    TEST_ASSERT_EQUAL_UINT32(before + 3U, InternPool::size());
+
+    Spec d = b->clone();
+    TEST_ASSERT_TRUE(&d.initVal() == &a->initVal());
+    TEST_ASSERT_EQUAL_STRING(a->initVal().str().c_str(), d.initVal().str().c_str());
+
+    auto e = Spec::create(Permission::Kind::ReadOnly, Resolution::Kind::X1, d.initVal(), d.minVal(), d.maxVal());
+    TEST_ASSERT_TRUE(e.has_value());
+    TEST_ASSERT_TRUE(&e->initVal() == &a->initVal());
+
+    a.reset();
+    b.reset();
+    e.reset();
+    TEST_ASSERT_EQUAL_UINT32(before + 3U, InternPool::size());
+
+    Spec moved(std::move(d));
+    TEST_ASSERT_EQUAL_UINT8(sizeof(label) - 1U, moved.initVal().size());
+    TEST_ASSERT_EQUAL_UINT8(0U, d.initVal().size());
+
+    c.reset();
+    { Spec gone(std::move(moved)); }
+    TEST_ASSERT_EQUAL_UINT32(before, InternPool::size());
+}
@@ -0,0 +1,68 @@
+#include <unity.h>
+#include <unity_test_runner.h>
+#include <property_table.hpp>
+#include <static_spec.hpp>
+
+#include <array>
+
+using namespace machine;
+using namespace machine::property;
+
+
+namespace
+{
+    constexpr StaticSpec TEMPERATURE =
+        StaticSpec::numeric<std::int16_t>(Permission::Kind::ReadOnly, Resolution::Kind::X0_5, 50, 0, 200);
+
+    static_assert(TEMPERATURE.format() == Format::Kind::Numeric);
+    static_assert(TEMPERATURE.lowerBound() == 0 && TEMPERATURE.upperBound() == 200);
+    static_assert(TEMPERATURE.isWithinRange(200) && !TEMPERATURE.isWithinRange(201));
+
+    constexpr StaticSpec FLAGS = StaticSpec::bitset<std::uint8_t>(Permission::Kind::ReadWrite, 0x01, 0x0F);
+    static_assert(FLAGS.format() == Format::Kind::BitSet);
+    static_assert(FLAGS.isWithinRange(0x0F) && !FLAGS.isWithinRange(0x10));
+
+    constexpr StaticSpec POWER = StaticSpec::boolean(Permission::Kind::ReadWrite, true);
+    static_assert(POWER.format() == Format::Kind::Boolean);
+
+    constexpr StaticSpec NAME = StaticSpec::string(Permission::Kind::ReadOnly, "Hello, World!");
+    static_assert(NAME.format() == Format::Kind::String);
+
+    constexpr std::array CATALOG =
+    {
+        PropertyDescriptor{ Address(0, 0, 1, 0, 2), NAME },
+        PropertyDescriptor{ Address(0, 0, 1, 0, 1), TEMPERATURE },
+        PropertyDescriptor{ Address(0, 1, 1, 0, 1), POWER },
+    };
+}
+
+TEST_CASE("StaticSpec matches runtime Spec", "[StaticSpec]")
+{
+    for (StaticSpec const *s : {&TEMPERATURE, &FLAGS, &POWER, &NAME})
+    {
+        auto spec = Spec::create(*s);
+        TEST_ASSERT_TRUE(spec.has_value());
+        TEST_ASSERT_EQUAL(static_cast<int>(s->format()), static_cast<int>(spec->format()));
+        TEST_ASSERT_EQUAL(static_cast<int>(s->permission()), static_cast<int>(spec->permission()));
+        TEST_ASSERT_EQUAL(static_cast<int>(s->resolution()), static_cast<int>(spec->resolution()));
+        TEST_ASSERT_EQUAL_INT32(s->lowerBound(), spec->lowerBound());
+        TEST_ASSERT_EQUAL_INT32(s->upperBound(), spec->upperBound());
+        TEST_ASSERT_TRUE(s->isWithinRange(spec->initVal()));
+        TEST_ASSERT_TRUE(spec->isWithinRange(s->initBytes()));
+    }
+}
+
+TEST_CASE("PropertyTable from constexpr catalog", "[StaticSpec]")
+{
+    PropertyTable::Builder builder;
+    TEST_ASSERT_TRUE(builder.add(CATALOG));
+
+    auto table = builder.build();
+    TEST_ASSERT_TRUE(table.has_value());
+    TEST_ASSERT_EQUAL(CATALOG.size(), table->size());
+
+    auto const name = table->find(Address(0, 0, 1, 0, 2));
+    TEST_ASSERT_TRUE(name);
+    TEST_ASSERT_EQUAL_UINT8(13, name->value().size());
+    TEST_ASSERT_EQUAL(2, table->unit(Address(0, 0, 0, 0, 0)).size());
+}
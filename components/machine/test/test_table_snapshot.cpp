@@ -0,0 +1,96 @@
+#include <unity.h>
+#include <unity_test_runner.h>
+#include <table_snapshot.hpp>
+#include "property_fixture.hpp"
+
+#include <array>
+#include <utility>
+
+using namespace machine;
+using namespace machine::property;
+
+
+namespace
+{
+    /** @brief A number that starts at its own code. */
+    Property makeProperty(std::uint8_t code) { return test::makeNumber(code, code); }
+
+    PropertyTable makeTable()
+    {
+        PropertyTable::Builder builder;
+
+        for (std::uint8_t code = 0; code < 8; code++)
+        {
+            builder.add(Address(0, 0, 1, 0, code), makeProperty(code));
+        }
+        return std::move(builder.build().value());
+    }
+
+    std::uint8_t firstByte(TableSnapshot::View const &view, std::size_t index)
+    {
+        return std::to_integer<std::uint8_t>(view.value(index)[0]);
+    }
+}
+
+TEST_CASE("TableSnapshot publishes changed values atomically", "[TableSnapshot]")
+{
+    PropertyTable table = makeTable();
+    TableSnapshot snapshot(table);
+
+    auto const before = snapshot.acquire();
+    TEST_ASSERT_EQUAL(8U, before.size());
+    TEST_ASSERT_EQUAL_UINT32(1U, before.generation());
+    TEST_ASSERT_EQUAL_UINT8(5, firstByte(before, 5));
+
+    std::byte const v{42};
+    TEST_ASSERT_EQUAL(static_cast<int>(value::SetResult::Success), static_cast<int>(table.set(2, &v, 1)));
+    TEST_ASSERT_EQUAL(static_cast<int>(value::SetResult::Success), static_cast<int>(table.set(5, &v, 1)));
+
+    std::array<std::size_t, 8> changed{};
+    std::size_t const n = table.takeDirty(changed);
+    TEST_ASSERT_TRUE(snapshot.publish(table, std::span<std::size_t const>(changed.data(), n)));
+
+    // Note: A held view keeps seeing the old publication.
+    TEST_ASSERT_EQUAL_UINT8(5, firstByte(before, 5));
+
+    auto const after = snapshot.acquire();
+    TEST_ASSERT_EQUAL_UINT32(2U, after.generation());
+    TEST_ASSERT_EQUAL_UINT8(42, firstByte(after, 2));
+    TEST_ASSERT_EQUAL_UINT8(42, firstByte(after, 5));
+    TEST_ASSERT_EQUAL_UINT8(7, firstByte(after, 7));
+    TEST_ASSERT_EQUAL(1U, after.value(7).size());
+}
+
+TEST_CASE("TableSnapshot keeps changes while all copies are held", "[TableSnapshot]")
+{
+    PropertyTable table = makeTable();
+    TableSnapshot snapshot(table);
+    std::array<std::size_t, 1> const changed{3};
+    std::byte v{10};
+
+    auto first = snapshot.acquire();
+    TEST_ASSERT_EQUAL(static_cast<int>(value::SetResult::Success), static_cast<int>(table.set(3, &v, 1)));
+    TEST_ASSERT_TRUE(snapshot.publish(table, changed));
+
+    auto const second = snapshot.acquire();
+    v = std::byte{20};
+    TEST_ASSERT_EQUAL(static_cast<int>(value::SetResult::Success), static_cast<int>(table.set(3, &v, 1)));
+    TEST_ASSERT_TRUE(snapshot.publish(table, changed));
+
+    auto const third = snapshot.acquire();
+    v = std::byte{30};
+    TEST_ASSERT_EQUAL(static_cast<int>(value::SetResult::Success), static_cast<int>(table.set(3, &v, 1)));
+    TEST_ASSERT_FALSE(snapshot.publish(table, changed));
+    TEST_ASSERT_EQUAL_UINT8(3, firstByte(first, 3));
+    TEST_ASSERT_EQUAL_UINT8(10, firstByte(second, 3));
+    TEST_ASSERT_EQUAL_UINT8(20, firstByte(third, 3));
+
+    {
+        auto const released = std::move(first);
+    }
+    TEST_ASSERT_TRUE(snapshot.publish(table, {}));
+
+    auto const latest = snapshot.acquire();
+    TEST_ASSERT_EQUAL_UINT8(30, firstByte(latest, 3));
+    TEST_ASSERT_EQUAL_UINT8(0, firstByte(latest, 0));
+}
@@ -0,0 +1,81 @@
+#include <unity.h>
+#include <unity_test_runner.h>
+#include <validator.hpp>
+
+#include <array>
+#include <optional>
+
+using namespace machine::property;
+
+
+TEST_CASE("Validator matches isWithinRange", "[Validator]")
+{
+    std::byte min{12}, max{70}, init{33}, mask{0x0F};
+    auto numeric = Spec::create(Permission::Kind::ReadWrite, &init, 1, &min, 1, &max, 1);
+    auto bitset = Spec::create(Permission::Kind::ReadWrite, &init, 1, nullptr, 0, &mask, 1);
+    auto boolean = Spec::create(Permission::Kind::ReadWrite,
+                                &detail::BOOL_FALSE, 1, &detail::BOOL_FALSE, 1, &detail::BOOL_TRUE, 1);
+    TEST_ASSERT_TRUE(numeric.has_value() && bitset.has_value() && boolean.has_value());
+
+    // Note: More than one chunk, mixed formats, valid and invalid values.
+    constexpr std::size_t COUNT = Validator::CHUNK_SIZE * 2U + 3U;
+    std::array<std::optional<Value>, COUNT> storage;
+    std::array<Value const *, COUNT> values;
+    std::array<Spec const *, COUNT> specs;
+
+    Spec const *const kinds[] = {&*numeric, &*bitset, &*boolean};
+
+    for (std::size_t i = 0; i < COUNT; i++)
+    {
+        std::byte bytes[2] = {std::byte(i * 7U), std::byte(i % 3U)};
+        storage[i] = Value::create(bytes, static_cast<std::uint8_t>(1U + (i % 5U == 0U)));
+        values[i] = &*storage[i];
+        specs[i] = kinds[i % 3U];
+    }
+    values[4] = nullptr;
+
+    std::array<bool, COUNT> results;
+    std::size_t const valid = Validator::validate(specs, values, results);
+
+    std::size_t expected = 0;
+    for (std::size_t i = 0; i < COUNT; i++)
+    {
+        bool const one = (values[i] != nullptr) && specs[i]->isWithinRange(*values[i]);
+        TEST_ASSERT_EQUAL(one, results[i]);
+        expected += one;
+    }
+    TEST_ASSERT_EQUAL(expected, valid);
+    TEST_ASSERT_GREATER_THAN(0, valid);
+
+    std::size_t const same = Validator::validate(*numeric, values, results);
+    expected = 0;
+    for (std::size_t i = 0; i < COUNT; i++)
+    {
+        bool const one = (values[i] != nullptr) && numeric->isWithinRange(*values[i]);
+        TEST_ASSERT_EQUAL(one, results[i]);
+        expected += one;
+    }
+    TEST_ASSERT_EQUAL(expected, same);
+}
+
+TEST_CASE("Validator decodes numeric values signed", "[Validator]")
+{
+    std::byte min{0xF6}, max{0x0A}, init{0x00}; // Note: -10 to 10
+    auto numeric = Spec::create(Permission::Kind::ReadWrite, &init, 1, &min, 1, &max, 1);
+    TEST_ASSERT_TRUE(numeric.has_value());
+
+    std::byte const bytes[] = {std::byte{0xFF}, std::byte{0x80}, std::byte{0x0A}};
+    std::array<std::optional<Value>, 3> storage;
+    std::array<Value const *, 3> values;
+    for (std::size_t i = 0; i < values.size(); i++)
+    {
+        storage[i] = Value::create(&bytes[i], 1);
+        values[i] = &*storage[i];
+    }
+
+    std::array<bool, 3> results;
+    TEST_ASSERT_EQUAL(2, Validator::validate(*numeric, values, results));
+    TEST_ASSERT_TRUE(results[0]);  // Note: -1
+    TEST_ASSERT_FALSE(results[1]); // Note: -128
+    TEST_ASSERT_TRUE(results[2]);
+}
@@ -0,0 +1,58 @@
+/* Self */
+#include <unit.hpp>
+
+/* C++ Standard Library */
+#include <array>
+#include <format>
+#include <iterator>
+
+/* Custom Library */
+#include <unit_format.hpp>
+
+/* ^\__________________________________________ */
+/* Namespaces.                                  */
+using namespace machine;
+
+
+namespace
+{
+    /** @brief Names of `Unit::Kind`, by raw value. */
+    constexpr std::array<std::string_view, 6U> UNIT_KIND_NAMES {
+        "board", "expansion-board", "thermal", "storage", "power", "light"
+    };
+}
+
+
+/* ^\__________________________________________ */
+/* #region Operators.                           */
+
+namespace machine
+{
+    std::ostream &operator<<( std::ostream &os, Unit::Kind const &v ) noexcept
+    {
+        std::format_to( std::ostreambuf_iterator<char>( os ), "{}", v );
+        return os;
+    }
+
+    std::ostream &operator<<( std::ostream &os, Unit const &v ) noexcept
+    {
+        std::format_to( std::ostreambuf_iterator<char>( os ), "{}", v );
+        return os;
+    }
+}
+
+/* #endregion */// Operators.
+
+
+/* ^\__________________________________________ */
+/* #region Public methods.                      */
+
+std::string_view Unit::nameOf( Kind const &v ) noexcept
+{
+    auto idx = static_cast<std::uint8_t>( v );
+    auto const &names = UNIT_KIND_NAMES;
+
+    return ( idx < names.size() ) ? names[idx] : "Unknown";
+}
+
+/* #endregion */// Public methods.
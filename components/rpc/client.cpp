@@ -0,0 +1,382 @@
+/* Self */
+#include <client.hpp>
+
+/* C++ Standard Library */
+#include <cstring>
+
+/* ^\__________________________________________ */
+/* Namespaces.                                  */
+using namespace rpc;
+using namespace machine;
+
+
+/* ^\__________________________________________ */
+/* #region Private types, functions.            */
+
+namespace
+{
+    /** @brief Bytes read from the stream buffer at once. */
+    constexpr std::size_t RX_CHUNK_SIZE = 64U;
+
+    void resumeEntry( void *context ) noexcept
+    {
+        std::coroutine_handle<>::from_address( context ).resume();
+    }
+
+    std::size_t bodySizeOf( std::span<std::byte const> header ) noexcept
+    {
+        return std::to_integer<std::size_t>( header[2] ) | ( std::to_integer<std::size_t>( header[3] ) << 8U );
+    }
+
+} // namespace
+
+/* #endregion */// Private types, functions.
+
+
+/* ^\__________________________________________ */
+/* #region Constructors.                        */
+
+Client::Client( Config const &config ) noexcept
+    : config_( config )
+{ /* Do nothing */ }
+
+Client::~Client() noexcept
+{
+    if ( rx_ ) { vStreamBufferDelete( rx_ ); rx_ = nullptr; }
+}
+
+/* #endregion */// Constructors
+
+
+/* ^\__________________________________________ */
+/* #region Public methods.                      */
+
+bool Client::start() noexcept
+{
+    if ( !config_.executor || !config_.send ) { return false; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on missing config!! ]
+
+    rx_ = xStreamBufferCreate( CONFIG_RPC_RX_BUFFER_SIZE, 1U );
+
+    return rx_ != nullptr;
+}
+
+bool Client::Request::await_suspend( std::coroutine_handle<> awaiter ) noexcept
+{
+    if ( cancel_ && cancel_->isCancelled() )
+    {
+        status_ = Status::Cancelled;
+        client_.cancelled_.fetch_add( 1U, std::memory_order_relaxed );
+        return false;
+    }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early resume on cancelled token!! ]
+
+    awaiter_ = awaiter;
+    client_.begin( *this );
+
+    return true;
+}
+
+std::size_t Client::onReceive( std::span<std::byte const> bytes, TickType_t wait ) noexcept
+{
+    std::size_t const accepted = xStreamBufferSend( rx_, bytes.data(), bytes.size(), wait );
+
+    // Note: `drain()` clears the flag before it reads, so these bytes are either
+    //       read by a drain that is already queued, or by the one posted here.
+    if ( ( accepted > 0U ) && !drainPosted_.exchange( true ) )
+    {
+        config_.executor->post( Executor::Job{ &Client::drainEntry, this }, portMAX_DELAY );
+    }
+
+    return accepted;
+}
+
+Client::Status Client::statusOf( std::uint8_t wire ) noexcept
+{
+    switch ( wire )
+    {
+
+    case 0x00U: return Status::Ok;
+    case 0x01U: return Status::NotFound;
+    default:    return Status::Rejected;
+
+    } // switch ( wire )
+}
+
+Client::Stats Client::stats() const noexcept
+{
+    return Stats{ sent_.load( std::memory_order_relaxed )
+                , timeouts_.load( std::memory_order_relaxed )
+                , cancelled_.load( std::memory_order_relaxed )
+                , stale_.load( std::memory_order_relaxed )
+                , maxInFlight_.load( std::memory_order_relaxed ) };
+}
+
+/* #endregion */// Public methods.
+
+
+/* ^\__________________________________________ */
+/* #region Private methods.                     */
+
+void Client::drainEntry( void *context ) noexcept
+{
+    static_cast<Client *>( context )->drain();
+}
+
+void Client::timeoutEntry( void *context ) noexcept
+{
+    Request &r = *static_cast<Request *>( context );
+
+    r.client_.timeouts_.fetch_add( 1U, std::memory_order_relaxed );
+    r.client_.finish( r, Status::Timeout );
+}
+
+void Client::cancelEntry( void *context ) noexcept
+{
+    Request &r = *static_cast<Request *>( context );
+
+    r.client_.cancelled_.fetch_add( 1U, std::memory_order_relaxed );
+    r.client_.finish( r, Status::Cancelled );
+}
+
+void Client::begin( Request &request ) noexcept
+{
+    if ( request.timeout_ != portMAX_DELAY )
+    {
+        request.timer_.fire = &Client::timeoutEntry;
+        request.timer_.context = &request;
+        config_.executor->arm( request.timer_, request.timeout_ );
+    }
+
+    if ( request.cancel_ )
+    {
+        request.listener_.notify = &Client::cancelEntry;
+        request.listener_.context = &request;
+        request.cancel_->subscribe( request.listener_ );
+    }
+
+    request.stage_ = Stage::Waiting;
+    request.next_ = nullptr;
+
+    if ( waitingTail_ ) { waitingTail_->next_ = &request; }
+    else                { waitingHead_ = &request; }
+    waitingTail_ = &request;
+
+    pump();
+}
+
+bool Client::issue( Request &request ) noexcept
+{
+    request.tag_ = takeTag();
+
+    std::size_t size = 0U;
+    if ( request.value_ )
+    {
+        std::span<std::byte> const out( tx_.data() + REQUEST_HEADER_SIZE, UINT8_MAX );
+        size = request.value_->copyTo( out ).value_or( 0U );
+    }
+    else
+    {
+        size = request.data_.size();
+        std::memcpy( tx_.data() + REQUEST_HEADER_SIZE, request.data_.data(), size );
+    }
+
+    tx_[0] = std::byte{ request.tag_ };
+    tx_[1] = std::byte{ static_cast<std::uint8_t>( request.op_ ) };
+    tx_[2] = std::byte{ request.address_.unitKind() };
+    tx_[3] = std::byte{ request.address_.unitIndex() };
+    tx_[4] = std::byte{ request.address_.componentCode() };
+    tx_[5] = std::byte{ request.address_.componentIndex() };
+    tx_[6] = std::byte{ request.address_.propertyCode() };
+    tx_[7] = std::byte{ static_cast<std::uint8_t>( size ) };
+    tx_[8] = std::byte{ static_cast<std::uint8_t>( size >> 8U ) };
+
+    // Note: In flight before sending, so a response can never outrun it.
+    request.stage_ = Stage::InFlight;
+    request.next_ = inFlight_;
+    inFlight_ = &request;
+    inFlightCount_++;
+
+    if ( inFlightCount_ > maxInFlight_.load( std::memory_order_relaxed ) )
+    {
+        maxInFlight_.store( static_cast<std::uint32_t>( inFlightCount_ ), std::memory_order_relaxed );
+    }
+
+    if ( !config_.send( std::span<std::byte const>( tx_.data(), REQUEST_HEADER_SIZE + size ), config_.context ) )
+    {
+        return false;
+    }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on send failure!! ]
+
+    sent_.fetch_add( 1U, std::memory_order_relaxed );
+    return true;
+}
+
+void Client::complete( Request &request, Status status ) noexcept
+{
+    if ( request.stage_ == Stage::Waiting )
+    {
+        Request *prev = nullptr;
+        for ( Request *r = waitingHead_; r; prev = r, r = r->next_ )
+        {
+            if ( r != &request ) { continue; }
+
+            ( prev ? prev->next_ : waitingHead_ ) = r->next_;
+            if ( waitingTail_ == r ) { waitingTail_ = prev; }
+            break;
+        }
+    }
+    else if ( request.stage_ == Stage::InFlight )
+    {
+        for ( Request **p = &inFlight_; *p; p = &( *p )->next_ )
+        {
+            if ( *p == &request ) { *p = request.next_; break; }
+        }
+        inFlightCount_--;
+    }
+    // [===> Follows: Unlinked; a late response finds no request]
+
+    if ( request.cancel_ ) { request.cancel_->unsubscribe( request.listener_ ); }
+
+    request.next_ = nullptr;
+    request.stage_ = Stage::Done;
+    request.status_ = status;
+
+    // Note: Resumed from the executor loop, not from inside whatever called
+    //       finish(), e.g. another coroutine that cancelled the token.
+    request.timer_.fire = &resumeEntry;
+    request.timer_.context = request.awaiter_.address();
+    config_.executor->arm( request.timer_, 0U );
+}
+
+void Client::finish( Request &request, Status status ) noexcept
+{
+    complete( request, status );
+    pump();
+}
+
+void Client::pump() noexcept
+{
+    while ( waitingHead_ && ( inFlightCount_ < MAX_IN_FLIGHT ) )
+    {
+        Request &r = *waitingHead_;
+
+        waitingHead_ = r.next_;
+        if ( !waitingHead_ ) { waitingTail_ = nullptr; }
+
+        // Note: Completed here rather than through finish(), so a link that is
+        //       down fails every waiting request in this loop, without recursion.
+        if ( !issue( r ) ) { complete( r, Status::SendFailed ); }
+    }
+}
+
+void Client::drain() noexcept
+{
+    drainPosted_.store( false );
+
+    std::array<std::byte, RX_CHUNK_SIZE> chunk;
+    std::size_t n;
+
+    while ( ( n = xStreamBufferReceive( rx_, chunk.data(), chunk.size(), 0U ) ) > 0U )
+    {
+        std::span<std::byte const> input( chunk.data(), n );
+
+        while ( !input.empty() )
+        {
+            if ( skip_ > 0U )
+            {
+                std::size_t const dropped = std::min( skip_, input.size() );
+                skip_ -= dropped;
+                input = input.subspan( dropped );
+                continue;
+            }
+            // [===> Follows: No body of an oversized response is pending]
+
+            bool const hasHeader = ( frameSize_ >= RESPONSE_HEADER_SIZE );
+            std::size_t const need = hasHeader
+                                   ? RESPONSE_HEADER_SIZE + bodySizeOf( frame_ ) - frameSize_
+                                   : RESPONSE_HEADER_SIZE - frameSize_;
+            std::size_t const take = std::min( need, input.size() );
+
+            std::memcpy( frame_.data() + frameSize_, input.data(), take );
+            frameSize_ += static_cast<std::uint16_t>( take );
+            input = input.subspan( take );
+
+            if ( frameSize_ < RESPONSE_HEADER_SIZE ) { continue; }
+
+            if ( bodySizeOf( frame_ ) > MAX_BODY_SIZE )
+            {
+                // Note: Its body is still in the stream; dropped before the next header is parsed.
+                stale_.fetch_add( 1U, std::memory_order_relaxed );
+                skip_ = bodySizeOf( frame_ );
+                frameSize_ = 0U;
+                continue;
+            }
+            // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Continue on oversized body!! ]
+
+            if ( frameSize_ < RESPONSE_HEADER_SIZE + bodySizeOf( frame_ ) ) { continue; }
+            // [===> Follows: One complete response in `frame_`]
+
+            deliver( std::to_integer<std::uint8_t>( frame_[0] )
+                   , std::to_integer<std::uint8_t>( frame_[1] )
+                   , std::span<std::byte const>( frame_.data() + RESPONSE_HEADER_SIZE, frameSize_ - RESPONSE_HEADER_SIZE ) );
+            frameSize_ = 0U;
+        }
+    }
+}
+
+void Client::deliver( std::uint8_t tag, std::uint8_t status, std::span<std::byte const> body ) noexcept
+{
+    Request *request = inFlight_;
+    while ( request && ( request->tag_ != tag ) )
+    {
+        request = request->next_;
+    }
+
+    if ( !request )
+    {
+        stale_.fetch_add( 1U, std::memory_order_relaxed );
+        return;
+    }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on unknown or expired tag!! ]
+
+    Status result = statusOf( status );
+    if ( ( result == Status::Ok ) && ( request->op_ == Op::Read ) )
+    {
+        if ( body.size() <= UINT8_MAX )
+        {
+            request->result_ = property::Value::create( body.data(), static_cast<std::uint8_t>( body.size() ) );
+        }
+        if ( !request->result_ ) { result = Status::NoMemory; }
+    }
+    else if ( ( result == Status::Ok ) && ( request->op_ == Op::Transact ) )
+    {
+        if ( body.size() <= request->out_.size() )
+        {
+            std::memcpy( request->out_.data(), body.data(), body.size() );
+            request->outSize_ = body.size();
+        }
+        else { result = Status::NoMemory; }
+    }
+
+    finish( *request, result );
+}
+
+std::uint8_t Client::takeTag() noexcept
+{
+    while ( true )
+    {
+        std::uint8_t const tag = nextTag_++;
+
+        Request const *r = inFlight_;
+        while ( r && ( r->tag_ != tag ) )
+        {
+            r = r->next_;
+        }
+
+        if ( !r ) { return tag; }
+        // Note: Terminates, since at most `MAX_IN_FLIGHT` of 256 tags are in use.
+    }
+}
+
+/* #endregion */// Private methods.
@@ -0,0 +1,279 @@
+/* Self */
+#include <coalescer.hpp>
+
+/* C++ Standard Library */
+#include <cstring>
+
+/* ^\__________________________________________ */
+/* Namespaces.                                  */
+using namespace rpc;
+using namespace machine;
+using namespace machine::property;
+
+
+/* ^\__________________________________________ */
+/* #region Private types, functions.            */
+
+namespace
+{
+    void resumeEntry( void *context ) noexcept
+    {
+        std::coroutine_handle<>::from_address( context ).resume();
+    }
+
+    bool isSameComponent( Address a, Address b ) noexcept
+    {
+        return a.componentRange().first == b.componentRange().first;
+    }
+
+} // namespace
+
+/* #endregion */// Private types, functions.
+
+
+/* ^\__________________________________________ */
+/* #region Constructors.                        */
+
+Coalescer::Coalescer( Config const &config ) noexcept
+    : config_( config )
+{
+    for ( Batch &batch : batches_ )
+    {
+        batch.owner = this;
+        batch.window.fire = &Coalescer::windowEntry;
+        batch.window.context = &batch;
+    }
+}
+
+/* #endregion */// Constructors
+
+
+/* ^\__________________________________________ */
+/* #region Public methods.                      */
+
+bool Coalescer::Request::await_suspend( std::coroutine_handle<> awaiter ) noexcept
+{
+    status_ = coalescer_.check( *this );
+
+    if ( status_ != Status::Ok )
+    {
+        coalescer_.filtered_.fetch_add( 1U, std::memory_order_relaxed );
+        return false;
+    }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early resume on filtered request!! ]
+
+    awaiter_ = awaiter;
+    coalescer_.join( *this );
+
+    return true;
+}
+
+Coalescer::Stats Coalescer::stats() const noexcept
+{
+    return Stats{ transactions_.load( std::memory_order_relaxed )
+                , items_.load( std::memory_order_relaxed )
+                , filtered_.load( std::memory_order_relaxed ) };
+}
+
+/* #endregion */// Public methods.
+
+
+/* ^\__________________________________________ */
+/* #region Private methods.                     */
+
+void Coalescer::windowEntry( void *context ) noexcept
+{
+    Batch &batch = *static_cast<Batch *>( context );
+
+    batch.owner->flush( batch );
+}
+
+Task<> Coalescer::send( Coalescer *self, Batch *batch ) noexcept
+{
+    TickType_t timeout = portMAX_DELAY;
+    for ( Request const *r = batch->head; r; r = r->next_ )
+    {
+        timeout = std::min( timeout, r->timeout_ );
+    }
+
+    auto const result = co_await self->config_.client->transact(
+        batch->component
+      , std::span<std::byte const>( batch->request.data(), batch->requestSize )
+      , batch->response
+      , timeout );
+
+    self->fanOut( *batch, result );
+}
+
+Coalescer::Status Coalescer::check( Request &request ) const noexcept
+{
+    auto const index = config_.table->indexOf( request.address_ );
+    if ( !index ) { return Status::NotFound; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on unknown address!! ]
+
+    Permission::Kind const permission = config_.table->permissionAt( *index );
+
+    if ( request.op_ == Op::Read )
+    {
+        if ( !Permission::isReadable( permission ) ) { return Status::NotPermitted; }
+
+        request.responseSize_ = property::detail::maxSizeOf( config_.table->formatAt( *index ) );
+    }
+    else if ( !Permission::isWritable( permission ) ) { return Status::NotPermitted; }
+
+    return Status::Ok;
+}
+
+void Coalescer::join( Request &request ) noexcept
+{
+    std::size_t const requestSize = REQUEST_ENTRY_SIZE + request.data_.size();
+    std::size_t const responseSize = RESPONSE_ENTRY_SIZE + request.responseSize_;
+
+    Batch *batch = nullptr;
+    for ( Batch &b : batches_ )
+    {
+        if ( ( b.stage == Batch::Stage::Gathering ) && isSameComponent( b.component, request.address_ ) )
+        {
+            batch = &b;
+            break;
+        }
+    }
+
+    if ( batch && ( ( batch->requestSize + requestSize > Client::MAX_BODY_SIZE )
+                 || ( batch->responseSize + responseSize > Client::MAX_BODY_SIZE ) ) )
+    {
+        flush( *batch );
+        batch = nullptr;
+    }
+    // [===> Follows: `batch` has room, or a new one is needed]
+
+    if ( !batch )
+    {
+        for ( Batch &b : batches_ )
+        {
+            if ( b.stage == Batch::Stage::Free ) { batch = &b; break; }
+        }
+
+        if ( !batch )
+        {
+            request.next_ = nullptr;
+            if ( waitingTail_ ) { waitingTail_->next_ = &request; }
+            else                { waitingHead_ = &request; }
+            waitingTail_ = &request;
+            return;
+        }
+        // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on no free batch!! ]
+
+        batch->stage = Batch::Stage::Gathering;
+        batch->component = request.address_;
+        config_.executor->arm( batch->window, config_.window );
+    }
+
+    std::byte *const entry = batch->request.data() + batch->requestSize;
+    entry[0] = std::byte{ static_cast<std::uint8_t>( request.op_ ) };
+    entry[1] = std::byte{ request.address_.propertyCode() };
+    entry[2] = std::byte{ static_cast<std::uint8_t>( request.data_.size() ) };
+    std::memcpy( entry + REQUEST_ENTRY_SIZE, request.data_.data(), request.data_.size() );
+
+    request.next_ = nullptr;
+    if ( batch->tail ) { batch->tail->next_ = &request; }
+    else               { batch->head = &request; }
+    batch->tail = &request;
+
+    batch->count++;
+    batch->requestSize += requestSize;
+    batch->responseSize += responseSize;
+
+    if ( batch->count == MAX_ITEMS ) { flush( *batch ); }
+}
+
+void Coalescer::flush( Batch &batch ) noexcept
+{
+    config_.executor->disarm( batch.window );
+    batch.stage = Batch::Stage::Sending;
+
+    transactions_.fetch_add( 1U, std::memory_order_relaxed );
+    items_.fetch_add( static_cast<std::uint32_t>( batch.count ), std::memory_order_relaxed );
+
+    if ( !config_.executor->spawn( send( this, &batch ) ) )
+    {
+        fanOut( batch, Client::TransactResult{ Status::NoMemory, 0U } );
+    }
+    // Note: Spawned tasks start from the job queue, after the caller suspended.
+}
+
+void Coalescer::fanOut( Batch &batch, Client::TransactResult result ) noexcept
+{
+    std::span<std::byte const> const body( batch.response.data(), result.size );
+    std::size_t pos = 0U;
+
+    for ( Request *r = batch.head; r; )
+    {
+        Request *const next = r->next_;
+        Status status = result.status;
+
+        if ( status == Status::Ok )
+        {
+            std::size_t const size = ( pos + RESPONSE_ENTRY_SIZE <= body.size() )
+                                   ? std::to_integer<std::size_t>( body[pos + 1U] )
+                                   : SIZE_MAX;
+
+            if ( ( size == SIZE_MAX ) || ( pos + RESPONSE_ENTRY_SIZE + size > body.size() ) )
+            {
+                status = Status::Rejected; // Note: Response shorter than the request.
+                pos = body.size();
+            }
+            else
+            {
+                status = Client::statusOf( std::to_integer<std::uint8_t>( body[pos] ) );
+
+                if ( ( status == Status::Ok ) && ( r->op_ == Op::Read ) )
+                {
+                    r->result_ = Value::create( body.data() + pos + RESPONSE_ENTRY_SIZE
+                                              , static_cast<std::uint8_t>( size ) );
+                    if ( !r->result_ ) { status = Status::NoMemory; }
+                }
+                pos += RESPONSE_ENTRY_SIZE + size;
+            }
+        }
+
+        complete( *r, status );
+        r = next;
+    }
+
+    release( batch );
+}
+
+void Coalescer::complete( Request &request, Status status ) noexcept
+{
+    request.next_ = nullptr;
+    request.status_ = status;
+
+    // Note: Resumed from the executor loop, after the batch is released.
+    request.resume_.fire = &resumeEntry;
+    request.resume_.context = request.awaiter_.address();
+    config_.executor->arm( request.resume_, 0U );
+}
+
+void Coalescer::release( Batch &batch ) noexcept
+{
+    batch.stage = Batch::Stage::Free;
+    batch.head = nullptr;
+    batch.tail = nullptr;
+    batch.count = 0U;
+    batch.requestSize = 0U;
+    batch.responseSize = 0U;
+
+    Request *r = waitingHead_;
+    waitingHead_ = nullptr;
+    waitingTail_ = nullptr;
+
+    while ( r )
+    {
+        Request *const next = r->next_;
+        join( *r ); // Note: Queues it again if no batch is free.
+        r = next;
+    }
+}
+
+/* #endregion */// Private methods.
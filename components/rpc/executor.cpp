@@ -0,0 +1,220 @@
+/* Self */
+#include <executor.hpp>
+
+/* C++ Standard Library */
+#include <type_traits>
+#include <utility>
+
+/* ^\__________________________________________ */
+/* Namespaces.                                  */
+using namespace rpc;
+
+
+/* ^\__________________________________________ */
+/* #region Private types, functions.            */
+
+namespace
+{
+    /** @brief Top-level coroutine that owns a spawned task and frees itself when done. */
+    struct Detached
+    {
+        struct promise_type : detail::PromiseBase
+        {
+            Detached get_return_object() noexcept
+            {
+                return Detached{ std::coroutine_handle<promise_type>::from_promise( *this ) };
+            }
+
+            static Detached get_return_object_on_allocation_failure() noexcept { return Detached{}; }
+
+            std::suspend_never final_suspend() const noexcept { return {}; }
+
+            void return_void() const noexcept { /* Do nothing */ }
+        };
+
+        std::coroutine_handle<promise_type> handle {};
+    };
+
+    Detached detach( Task<> task ) noexcept
+    {
+        co_await task;
+    }
+
+    void resumeJob( void *context ) noexcept
+    {
+        std::coroutine_handle<>::from_address( context ).resume();
+    }
+
+    void cancelJob( void *context ) noexcept
+    {
+        static_cast<CancelToken *>( context )->cancel();
+    }
+
+    /** @brief Returns `true` if `deadline` is at or before `now`, across tick wrap-around. */
+    bool isDue( TickType_t deadline, TickType_t now ) noexcept
+    {
+        return static_cast<std::make_signed_t<TickType_t>>( deadline - now ) <= 0;
+    }
+
+} // namespace
+
+/* #endregion */// Private types, functions.
+
+
+/* ^\__________________________________________ */
+/* #region Constructors.                        */
+
+Executor::~Executor() noexcept
+{
+    if ( task_ ) { vTaskDelete( task_ ); task_ = nullptr; }
+
+    if ( queue_ ) { vQueueDelete( queue_ ); queue_ = nullptr; }
+}
+
+/* #endregion */// Constructors
+
+
+/* ^\__________________________________________ */
+/* #region Public methods.                      */
+
+bool Executor::start() noexcept
+{
+    queue_ = xQueueCreate( CONFIG_RPC_EXECUTOR_QUEUE_LENGTH, sizeof( Job ) );
+    if ( !queue_ ) { return false; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on allocation failure!! ]
+
+    BaseType_t const core = ( CONFIG_RPC_EXECUTOR_CORE < 0 ) ? tskNO_AFFINITY : CONFIG_RPC_EXECUTOR_CORE;
+
+    return xTaskCreatePinnedToCore( &Executor::entry
+                                  , "rpc"
+                                  , CONFIG_RPC_EXECUTOR_STACK_SIZE
+                                  , this
+                                  , CONFIG_RPC_EXECUTOR_PRIORITY
+                                  , &task_
+                                  , core ) == pdPASS;
+}
+
+bool Executor::spawn( Task<> &&task ) noexcept
+{
+    if ( !task.valid() ) { return false; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on allocation failure!! ]
+
+    Detached const d = detach( std::move( task ) );
+    if ( !d.handle ) { return false; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on allocation failure!! ]
+
+    if ( !post( d.handle ) )
+    {
+        d.handle.destroy(); // Note: Also frees the task it owns.
+        return false;
+    }
+
+    return true;
+}
+
+bool Executor::post( Job job, TickType_t wait ) noexcept
+{
+    return xQueueSend( queue_, &job, wait ) == pdTRUE;
+}
+
+bool Executor::post( std::coroutine_handle<> handle, TickType_t wait ) noexcept
+{
+    return post( Job{ &resumeJob, handle.address() }, wait );
+}
+
+bool Executor::cancel( CancelToken &token, TickType_t wait ) noexcept
+{
+    return post( Job{ &cancelJob, &token }, wait );
+}
+
+void Executor::arm( Timer &timer, TickType_t ticks ) noexcept
+{
+    disarm( timer );
+
+    timer.deadline = xTaskGetTickCount() + ticks;
+    timer.armed = true;
+
+    Timer **p = &timers_;
+    while ( *p && isDue( ( *p )->deadline, timer.deadline ) )
+    {
+        p = &( *p )->next;
+    }
+    // [===> Follows: Inserted after all timers due no later, so equal deadlines fire in arming order]
+
+    timer.next = *p;
+    *p = &timer;
+}
+
+void Executor::disarm( Timer &timer ) noexcept
+{
+    if ( !timer.armed ) { return; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on not armed!! ]
+
+    for ( Timer **p = &timers_; *p; p = &( *p )->next )
+    {
+        if ( *p == &timer )
+        {
+            *p = timer.next;
+            break;
+        }
+    }
+
+    timer.next = nullptr;
+    timer.armed = false;
+}
+
+void Executor::Sleep::await_suspend( std::coroutine_handle<> awaiter ) noexcept
+{
+    timer_.fire = &resumeJob;
+    timer_.context = awaiter.address();
+    executor_.arm( timer_, ticks_ );
+}
+
+/* #endregion */// Public methods.
+
+
+/* ^\__________________________________________ */
+/* #region Private methods.                     */
+
+void Executor::entry( void *param ) noexcept
+{
+    static_cast<Executor *>( param )->loop();
+}
+
+void Executor::loop() noexcept
+{
+    while ( true )
+    {
+        fireDue();
+
+        TickType_t wait = portMAX_DELAY;
+        if ( timers_ )
+        {
+            TickType_t const now = xTaskGetTickCount();
+            wait = isDue( timers_->deadline, now ) ? 0U : ( timers_->deadline - now );
+        }
+
+        Job job;
+        if ( xQueueReceive( queue_, &job, wait ) == pdTRUE )
+        {
+            job.run( job.context );
+        }
+    }
+}
+
+void Executor::fireDue() noexcept
+{
+    TickType_t const now = xTaskGetTickCount();
+
+    while ( timers_ && isDue( timers_->deadline, now ) )
+    {
+        Timer *const t = timers_;
+        timers_ = t->next;
+        t->next = nullptr;
+        t->armed = false;
+
+        t->fire( t->context ); // Note: May arm timers, including `t`.
+    }
+}
+
+/* #endregion */// Private methods.
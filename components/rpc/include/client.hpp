@@ -0,0 +1,471 @@
+#pragma once
+
+/* C++ Standard Library */
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+/* Custom Library */
+#include <address.hpp>
+#include <executor.hpp>
+#include <value.hpp>
+
+/* ESP-IDF */
+#include <freertos/FreeRTOS.h>
+#include <freertos/stream_buffer.h>
+#include <sdkconfig.h>
+
+namespace rpc
+{
+
+    /** @brief Asynchronous read and write requests to the machine. */
+    /**
+     * @details
+     * Requests are awaited from coroutines run by an `Executor`:
+     *
+     * \code{.cpp}
+     * rpc::Task<> poll( rpc::Client &machine ) noexcept
+     * {
+     *     auto const r = co_await machine.read( address, pdMS_TO_TICKS( 50 ) );
+     *     if ( r.status == rpc::Client::Status::Ok ) { use( *r.value ); }
+     *
+     *     std::byte const on { 1 };
+     *     co_await machine.write( other, std::span( &on, 1U ), pdMS_TO_TICKS( 50 ) );
+     * }
+     * \endcode
+     *
+     * @par Pipelining:
+     * Up to `MAX_IN_FLIGHT` requests are sent without waiting for earlier
+     * responses; each carries a tag that its response echoes, so responses
+     * may arrive in any order. Further requests wait in FIFO order for a
+     * free tag. Every awaiting coroutine costs its frame, not a task stack,
+     * so running one coroutine per request is the way to keep the link busy.
+     *
+     * @par Timeouts and cancellation:
+     * The timeout covers both waiting for a free tag and waiting for the
+     * response, and is handled by an executor timer. A `CancelToken` ends
+     * all requests it was passed to. Either way the request returns
+     * `Status::Timeout` or `Status::Cancelled`, and a late response is
+     * dropped and counted in `Stats::stale`.
+     *
+     * @par Wire format:
+     * Sizes are 16-bit little-endian, all other fields are bytes.
+     * A request is
+     *
+     * \code{.unparsed}
+     * offset  size  field
+     * ------  ----  -----------------------------------------------
+     *      0     1  tag, echoed by the response
+     *      1     1  operation: 0x01 read, 0x02 write, 0x03 transaction
+     *      2     5  address: unit kind, unit index, component code,
+     *               component index, property code (0 for a transaction)
+     *      7     2  body size (0 for read)
+     *      9     n  body: the value for write, see `Coalescer` for a transaction
+     * \endcode
+     *
+     * and a response is
+     *
+     * \code{.unparsed}
+     * offset  size  field
+     * ------  ----  -----------------------------------------------
+     *      0     1  tag of the request
+     *      1     1  status: 0x00 ok, 0x01 not found, 0x02 rejected
+     *      2     2  body size (0 for write)
+     *      4     n  body: the value for read, see `Coalescer` for a transaction
+     * \endcode
+     *
+     * Bodies are at most `MAX_BODY_SIZE` bytes; a response announcing more
+     * is dropped, body included, and counted in `Stats::stale`.
+     *
+     * @par Threading:
+     * Requests must be awaited on the executor task. `onReceive()` is
+     * called by the transport from its own task and hands the bytes over
+     * through a stream buffer, so no request state is shared between tasks.
+     *
+     * @note ja: コルーチンで待機する、マシンへのパイプライン化された読み書き要求。
+     */
+    class Client
+    {
+    /* ^\__________________________________________ */
+    /* #region Static members, Inner types.         */
+
+    public:
+
+        /** @brief Maximum number of requests sent but not answered. */
+        static constexpr std::size_t MAX_IN_FLIGHT = CONFIG_RPC_MAX_IN_FLIGHT;
+
+        /** @brief Size of the fixed request header in bytes. */
+        static constexpr std::size_t REQUEST_HEADER_SIZE = 9U;
+
+        /** @brief Size of the fixed response header in bytes. */
+        static constexpr std::size_t RESPONSE_HEADER_SIZE = 4U;
+
+        /** @brief Largest request or response body in bytes. */
+        static constexpr std::size_t MAX_BODY_SIZE = CONFIG_RPC_MAX_BODY_SIZE;
+
+        static_assert( MAX_BODY_SIZE >= UINT8_MAX, "A body must hold the largest value" );
+
+        /** @brief Outcome of a request. */
+        enum class Status : std::uint8_t
+        {
+            Ok = 0,      //!< Done; a read returns the value.
+            NotFound,    //!< The machine has no property at the address.
+            Rejected,    //!< The machine refused the request, e.g. read-only or out of range.
+            Timeout,     //!< No response in time.
+            Cancelled,   //!< The `CancelToken` was cancelled.
+            SendFailed,  //!< The transport did not accept the request.
+            NoMemory,    //!< The read value could not be allocated, or a body did not fit.
+            NotPermitted,//!< Filtered out locally by `Permission::Kind`; nothing was sent.
+        };
+
+        /** @brief Result of `transact()`. */
+        struct TransactResult
+        {
+            Status status;     //!< Outcome of the whole transaction.
+            std::size_t size;  //!< Response body bytes written to the caller's buffer.
+        };
+
+        /** @brief Result of `read()`. */
+        struct ReadResult
+        {
+            Status status;                                      //!< Outcome.
+            std::optional<machine::property::Value> value;      //!< Set if `status` is `Ok`.
+        };
+
+        /** @brief Sends one encoded request; called on the executor task. */
+        /**
+         * @return `true` if the whole frame was accepted.
+         */
+        using SendFn = bool (*)( std::span<std::byte const> frame, void *context ) noexcept;
+
+        /** @brief What the client works with. */
+        struct Config
+        {
+            Executor *executor;  //!< Runs the awaiting coroutines; must outlive the client.
+            SendFn send;         //!< Transport output.
+            void *context;       //!< Passed to `send`.
+        };
+
+        /** @brief Counters, written by the executor task only. */
+        struct Stats
+        {
+            std::uint32_t sent;         //!< Requests sent.
+            std::uint32_t timeouts;     //!< Requests that timed out.
+            std::uint32_t cancelled;    //!< Requests that were cancelled.
+            std::uint32_t stale;        //!< Responses without a matching request.
+            std::uint32_t maxInFlight;  //!< Most requests in flight at once.
+        };
+
+    private:
+
+        enum class Op : std::uint8_t
+        {
+            Read = 0x01,
+            Write = 0x02,
+            Transact = 0x03,
+        };
+
+        /** @brief Where a request is. */
+        enum class Stage : std::uint8_t
+        {
+            Idle,      //!< Not awaited yet.
+            Waiting,   //!< Waiting for a free tag.
+            InFlight,  //!< Sent; waiting for the response.
+            Done,      //!< Finished; resumption is scheduled.
+        };
+
+        /** @brief State shared by read and write awaiters; lives in the awaiting frame. */
+        class Request
+        {
+        public:
+
+            Request( Request const & ) noexcept = delete;            //!< Copy constructor (deleted).
+            Request &operator=( Request const & ) noexcept = delete;  //!< Copy operator (deleted).
+
+            bool await_ready() const noexcept { return false; }
+
+            bool await_suspend( std::coroutine_handle<> awaiter ) noexcept;
+
+        protected:
+
+            friend class Client;
+
+            explicit Request( Client &client, Op op, machine::Address address
+                            , std::span<std::byte const> data, machine::property::Value const *value
+                            , TickType_t timeout, CancelToken *cancel ) noexcept
+                : client_( client ), op_( op ), address_( address )
+                , data_( data ), value_( value ), timeout_( timeout ), cancel_( cancel )
+            { /* Do nothing */ }
+
+            Client &client_;
+            Op op_;
+            Stage stage_ = Stage::Idle;
+            Status status_ = Status::Ok;
+            std::uint8_t tag_ = 0U;
+            machine::Address address_;
+            std::span<std::byte const> data_;                 //!< Write payload, unless `value_` is set.
+            machine::property::Value const *value_;           //!< Write payload.
+            TickType_t timeout_;
+            CancelToken *cancel_;
+            std::coroutine_handle<> awaiter_ {};
+            Executor::Timer timer_ {};                        //!< Timeout, then resumption.
+            CancelToken::Listener listener_ {};
+            Request *next_ = nullptr;                         //!< In the waiting or in-flight list.
+            std::optional<machine::property::Value> result_;  //!< Read value.
+            std::span<std::byte> out_ {};                     //!< Transaction response body.
+            std::size_t outSize_ = 0U;                        //!< Bytes written to `out_`.
+        };
+
+    public:
+
+        /** @brief Awaiter of `read()`. */
+        class ReadRequest : public Request
+        {
+        public:
+
+            ReadResult await_resume() noexcept { return ReadResult{ status_, std::move( result_ ) }; }
+
+        private:
+
+            friend class Client;
+
+            using Request::Request;
+        };
+
+        /** @brief Awaiter of `transact()`. */
+        class TransactRequest : public Request
+        {
+        public:
+
+            TransactResult await_resume() const noexcept { return TransactResult{ status_, outSize_ }; }
+
+        private:
+
+            friend class Client;
+
+            explicit TransactRequest( Client &client, machine::Address component
+                                    , std::span<std::byte const> body, std::span<std::byte> out
+                                    , TickType_t timeout, CancelToken *cancel ) noexcept
+                : Request( client, Op::Transact, component, body, nullptr, timeout, cancel )
+            {
+                out_ = out;
+            }
+        };
+
+        /** @brief Awaiter of `write()`. */
+        class WriteRequest : public Request
+        {
+        public:
+
+            Status await_resume() const noexcept { return status_; }
+
+        private:
+
+            friend class Client;
+
+            using Request::Request;
+        };
+
+    /* #endregion */// Static members, Inner types
+
+    /* ^\__________________________________________ */
+    /* #region Constructors.                        */
+
+    public:
+
+        explicit Client( Config const &config ) noexcept;
+        ~Client() noexcept;                          //!< Destructor.
+        Client( Client const & ) noexcept = delete;  //!< Copy constructor (deleted).
+        Client( Client && ) noexcept = delete;       //!< Move constructor (deleted).
+
+    /* #endregion */// Constructors
+
+    /* ^\__________________________________________ */
+    /* #region Operators.                           */
+
+    public:
+
+        Client &operator=( Client const & ) noexcept = delete; //!< Copy operator (deleted).
+        Client &operator=( Client && ) noexcept = delete;      //!< Move operator (deleted).
+
+    /* #endregion */// Operators
+
+    /* ^\__________________________________________ */
+    /* #region Instance members.                    */
+
+    public:
+
+        /* #region Public methods */
+
+        /** @brief Creates the receive stream buffer. */
+        /**
+         * @return `true` on success; `false` on allocation failure.
+         */
+        [[nodiscard]]
+        bool start() noexcept;
+
+        /** @brief Reads the value of a property. */
+        /**
+         * @param address [in] The property.
+         * @param timeout [in] Ticks until `Status::Timeout`; `portMAX_DELAY` waits forever.
+         * @param cancel  [in] Optional token that ends the request.
+         */
+        [[nodiscard]]
+        ReadRequest read( machine::Address address
+                        , TickType_t timeout
+                        , CancelToken *cancel = nullptr ) noexcept
+        {
+            return ReadRequest( *this, Op::Read, address, {}, nullptr, timeout, cancel );
+        }
+
+        /** @brief Writes raw bytes to a property. */
+        /**
+         * @param address [in] The property.
+         * @param data    [in] The new value, up to 255 bytes; must stay valid
+         *                     while the request is awaited.
+         * @param timeout [in] Ticks until `Status::Timeout`; `portMAX_DELAY` waits forever.
+         * @param cancel  [in] Optional token that ends the request.
+         */
+        [[nodiscard]]
+        WriteRequest write( machine::Address address
+                          , std::span<std::byte const> data
+                          , TickType_t timeout
+                          , CancelToken *cancel = nullptr ) noexcept
+        {
+            return WriteRequest( *this, Op::Write, address
+                               , data.first( std::min<std::size_t>( data.size(), UINT8_MAX ) ), nullptr
+                               , timeout, cancel );
+        }
+
+        /** @brief Writes a value to a property. */
+        /**
+         * @details
+         * The value is copied when the request is sent, so it must stay
+         * valid while the request is awaited.
+         */
+        [[nodiscard]]
+        WriteRequest write( machine::Address address
+                          , machine::property::Value const &value
+                          , TickType_t timeout
+                          , CancelToken *cancel = nullptr ) noexcept
+        {
+            return WriteRequest( *this, Op::Write, address, {}, &value, timeout, cancel );
+        }
+
+        /** @brief Sends a multi-property transaction to one component. */
+        /**
+         * @details
+         * Used by `Coalescer`, which also defines the bodies.
+         *
+         * @param component [in] Any address within the component.
+         * @param body      [in] Request body, up to `MAX_BODY_SIZE` bytes; must
+         *                       stay valid while the request is awaited.
+         * @param out       [out] Receives the response body.
+         * @param timeout   [in] Ticks until `Status::Timeout`; `portMAX_DELAY` waits forever.
+         * @param cancel    [in] Optional token that ends the request.
+         */
+        [[nodiscard]]
+        TransactRequest transact( machine::Address component
+                                , std::span<std::byte const> body
+                                , std::span<std::byte> out
+                                , TickType_t timeout
+                                , CancelToken *cancel = nullptr ) noexcept
+        {
+            machine::Address const base( component.unitKind(), component.unitIndex()
+                                       , component.componentCode(), component.componentIndex(), 0U );
+
+            return TransactRequest( *this, base, body.first( std::min( body.size(), MAX_BODY_SIZE ) )
+                                  , out, timeout, cancel );
+        }
+
+        /** @brief Converts a status byte of the wire format. */
+        /**
+         * @return `Ok`, `NotFound`, or `Rejected` for any other value.
+         */
+        [[nodiscard]]
+        static Status statusOf( std::uint8_t wire ) noexcept;
+
+        /** @brief Hands received bytes to the client. */
+        /**
+         * @details
+         * Called by the transport task, never by the executor task.
+         *
+         * @param bytes [in] Received bytes, response frames.
+         * @param wait  [in] How long to wait for space in the stream buffer.
+         *
+         * @return The number of bytes accepted.
+         */
+        std::size_t onReceive( std::span<std::byte const> bytes, TickType_t wait ) noexcept;
+
+        /** @brief Returns a copy of all counters. */
+        [[nodiscard]]
+        Stats stats() const noexcept;
+
+        /* #endregion */// Public methods
+
+    private:
+
+        /* #region Private methods */
+
+        static void drainEntry( void *context ) noexcept;
+
+        static void timeoutEntry( void *context ) noexcept;
+
+        static void cancelEntry( void *context ) noexcept;
+
+        void begin( Request &request ) noexcept;
+
+        /** @brief Sends a request; `false` if the send failed and the caller must complete it. */
+        [[nodiscard]]
+        bool issue( Request &request ) noexcept;
+
+        /** @brief Unlinks a request and schedules its resumption, without issuing the next one. */
+        void complete( Request &request, Status status ) noexcept;
+
+        void finish( Request &request, Status status ) noexcept;
+
+        void pump() noexcept;
+
+        void drain() noexcept;
+
+        void deliver( std::uint8_t tag, std::uint8_t status, std::span<std::byte const> body ) noexcept;
+
+        std::uint8_t takeTag() noexcept;
+
+        /* #endregion */// Private methods
+
+        /* #region Member variables */
+
+        Config config_;
+        StreamBufferHandle_t rx_ = nullptr;                     //!< onReceive() -> executor.
+        std::atomic<bool> drainPosted_ { false };               //!< A drain job is queued.
+
+        // Note: Everything below is used by the executor task only.
+        Request *waitingHead_ = nullptr;                        //!< FIFO of requests without a tag.
+        Request *waitingTail_ = nullptr;
+        Request *inFlight_ = nullptr;                           //!< Sent requests.
+        std::size_t inFlightCount_ = 0U;
+        std::uint8_t nextTag_ = 0U;
+        std::array<std::byte, REQUEST_HEADER_SIZE + MAX_BODY_SIZE> tx_ {};
+        std::array<std::byte, RESPONSE_HEADER_SIZE + MAX_BODY_SIZE> frame_ {}; //!< Partial response.
+        std::uint16_t frameSize_ = 0U;                          //!< Bytes in `frame_`.
+        std::size_t skip_ = 0U;                                 //!< Body bytes of an oversized response still to drop.
+
+        std::atomic<std::uint32_t> sent_ { 0U };
+        std::atomic<std::uint32_t> timeouts_ { 0U };
+        std::atomic<std::uint32_t> cancelled_ { 0U };
+        std::atomic<std::uint32_t> stale_ { 0U };
+        std::atomic<std::uint32_t> maxInFlight_ { 0U };
+
+        /* #endregion */// Member variables
+
+    /* #endregion */// Instance members
+
+    }; // class Client
+
+} // namespace rpc
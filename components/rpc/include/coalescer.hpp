@@ -0,0 +1,331 @@
+#pragma once
+
+/* C++ Standard Library */
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+/* Custom Library */
+#include <address.hpp>
+#include <client.hpp>
+#include <executor.hpp>
+#include <property_table.hpp>
+#include <value.hpp>
+
+/* ESP-IDF */
+#include <freertos/FreeRTOS.h>
+#include <sdkconfig.h>
+
+namespace rpc
+{
+
+    /** @brief Gathers reads and writes to one component into one transaction. */
+    /**
+     * @details
+     * The link round trip costs far more than the payload, so refreshing a
+     * component property by property is dominated by waiting. A coalescer
+     * has the same `read()` / `write()` as `Client`, but requests to the
+     * same unit and component that arrive within `Config::window` are sent
+     * as one `Client::transact()`, and the results are handed back to each
+     * awaiter:
+     *
+     * \code{.cpp}
+     * rpc::Task<> refresh( rpc::Coalescer &coalescer, machine::Address address ) noexcept
+     * {
+     *     auto const r = co_await coalescer.read( address, pdMS_TO_TICKS( 50 ) );
+     *     // ...
+     * }
+     *
+     * // One transaction instead of one exchange per property.
+     * for ( std::uint8_t code : codes )
+     * {
+     *     executor.spawn( refresh( coalescer, machine::Address( kind, index, comp, compIndex, code ) ) );
+     * }
+     * \endcode
+     *
+     * A transaction is sent early once it holds `MAX_ITEMS` properties, or
+     * when the next request would make its request or expected response
+     * body exceed `Client::MAX_BODY_SIZE`.
+     *
+     * @par Permission filtering:
+     * Every request is checked against the `Permission::Kind` of the
+     * property in `Config::table` before it is gathered: reading a
+     * write-only or writing a read-only property returns
+     * `Status::NotPermitted`, and an address missing from the table
+     * returns `Status::NotFound`, both without using the link.
+     *
+     * @par Timeouts:
+     * A transaction uses the shortest timeout of its requests, counted
+     * from when it is sent; on failure every request of it fails alike.
+     *
+     * @par Transaction body:
+     * Entries follow each other without padding. The request body
+     * repeats, once per property,
+     *
+     * \code{.unparsed}
+     * size  field
+     * ----  -----------------------------------------------
+     *    1  operation: 0x01 read, 0x02 write
+     *    1  property code
+     *    1  value size (0 for read)
+     *    n  value (write only)
+     * \endcode
+     *
+     * and the response body answers each entry in the same order with
+     *
+     * \code{.unparsed}
+     * size  field
+     * ----  -----------------------------------------------
+     *    1  status: 0x00 ok, 0x01 not found, 0x02 rejected
+     *    1  value size (read only, else 0)
+     *    n  value
+     * \endcode
+     *
+     * @attention
+     * Executor task only, like `Client`.
+     *
+     * @note ja: 同一コンポーネントへの読み書きを1つのトランザクションにまとめる層。
+     */
+    class Coalescer
+    {
+    /* ^\__________________________________________ */
+    /* #region Static members, Inner types.         */
+
+    public:
+
+        /** @brief Maximum number of properties in one transaction. */
+        static constexpr std::size_t MAX_ITEMS = CONFIG_RPC_COALESCE_MAX_ITEMS;
+
+        /** @brief Number of transactions that can gather requests at once. */
+        static constexpr std::size_t BATCH_COUNT = CONFIG_RPC_COALESCE_BATCHES;
+
+        /** @brief Size of an entry header in a request body. */
+        static constexpr std::size_t REQUEST_ENTRY_SIZE = 3U;
+
+        /** @brief Size of an entry header in a response body. */
+        static constexpr std::size_t RESPONSE_ENTRY_SIZE = 2U;
+
+        static_assert( Client::MAX_BODY_SIZE >= REQUEST_ENTRY_SIZE + UINT8_MAX
+                     , "A transaction must hold the largest write" );
+
+        using Status = Client::Status;          //!< Outcome of a request.
+        using ReadResult = Client::ReadResult;  //!< Result of `read()`.
+
+        /** @brief What the coalescer works with. */
+        struct Config
+        {
+            Client *client;                       //!< Sends the transactions.
+            Executor *executor;                   //!< The executor of `client`.
+            machine::PropertyTable const *table;  //!< Permissions and formats of the properties.
+            TickType_t window;                    //!< Gathering time, e.g. `pdMS_TO_TICKS( CONFIG_RPC_COALESCE_WINDOW_MS )`.
+        };
+
+        /** @brief Counters, written by the executor task only. */
+        struct Stats
+        {
+            std::uint32_t transactions;  //!< Transactions sent.
+            std::uint32_t items;         //!< Requests sent within them.
+            std::uint32_t filtered;      //!< Requests answered locally: not found or not permitted.
+        };
+
+    private:
+
+        enum class Op : std::uint8_t
+        {
+            Read = 0x01,
+            Write = 0x02,
+        };
+
+        /** @brief State shared by read and write awaiters; lives in the awaiting frame. */
+        class Request
+        {
+        public:
+
+            Request( Request const & ) noexcept = delete;            //!< Copy constructor (deleted).
+            Request &operator=( Request const & ) noexcept = delete;  //!< Copy operator (deleted).
+
+            bool await_ready() const noexcept { return false; }
+
+            bool await_suspend( std::coroutine_handle<> awaiter ) noexcept;
+
+        protected:
+
+            friend class Coalescer;
+
+            explicit Request( Coalescer &coalescer, Op op, machine::Address address
+                            , std::span<std::byte const> data, TickType_t timeout ) noexcept
+                : coalescer_( coalescer ), op_( op ), address_( address )
+                , data_( data ), timeout_( timeout )
+            { /* Do nothing */ }
+
+            Coalescer &coalescer_;
+            Op op_;
+            Status status_ = Status::Ok;
+            std::uint8_t responseSize_ = 0U;                  //!< Largest valid response value.
+            machine::Address address_;
+            std::span<std::byte const> data_;                 //!< Write payload.
+            TickType_t timeout_;
+            std::coroutine_handle<> awaiter_ {};
+            Executor::Timer resume_ {};
+            Request *next_ = nullptr;                         //!< In a batch or the waiting list.
+            std::optional<machine::property::Value> result_;  //!< Read value.
+        };
+
+        /** @brief One transaction; gathers, then sends. */
+        struct Batch
+        {
+            enum class Stage : std::uint8_t { Free, Gathering, Sending };
+
+            Coalescer *owner = nullptr;
+            Stage stage = Stage::Free;
+            machine::Address component { 0U, 0U, 0U, 0U, 0U };
+            Request *head = nullptr;
+            Request *tail = nullptr;
+            std::size_t count = 0U;
+            std::size_t requestSize = 0U;   //!< Request body bytes.
+            std::size_t responseSize = 0U;  //!< Largest response body bytes.
+            Executor::Timer window {};
+            std::array<std::byte, Client::MAX_BODY_SIZE> request {};
+            std::array<std::byte, Client::MAX_BODY_SIZE> response {};
+        };
+
+    public:
+
+        /** @brief Awaiter of `read()`. */
+        class ReadRequest : public Request
+        {
+        public:
+
+            ReadResult await_resume() noexcept { return ReadResult{ status_, std::move( result_ ) }; }
+
+        private:
+
+            friend class Coalescer;
+
+            using Request::Request;
+        };
+
+        /** @brief Awaiter of `write()`. */
+        class WriteRequest : public Request
+        {
+        public:
+
+            Status await_resume() const noexcept { return status_; }
+
+        private:
+
+            friend class Coalescer;
+
+            using Request::Request;
+        };
+
+    /* #endregion */// Static members, Inner types
+
+    /* ^\__________________________________________ */
+    /* #region Constructors.                        */
+
+    public:
+
+        explicit Coalescer( Config const &config ) noexcept;
+        ~Coalescer() noexcept = default;                   //!< Destructor (default).
+        Coalescer( Coalescer const & ) noexcept = delete;  //!< Copy constructor (deleted).
+        Coalescer( Coalescer && ) noexcept = delete;       //!< Move constructor (deleted).
+
+    /* #endregion */// Constructors
+
+    /* ^\__________________________________________ */
+    /* #region Operators.                           */
+
+    public:
+
+        Coalescer &operator=( Coalescer const & ) noexcept = delete; //!< Copy operator (deleted).
+        Coalescer &operator=( Coalescer && ) noexcept = delete;      //!< Move operator (deleted).
+
+    /* #endregion */// Operators
+
+    /* ^\__________________________________________ */
+    /* #region Instance members.                    */
+
+    public:
+
+        /* #region Public methods */
+
+        /** @brief Reads the value of a property within a transaction. */
+        /**
+         * @param address [in] The property.
+         * @param timeout [in] Ticks until `Status::Timeout`; `portMAX_DELAY` waits forever.
+         */
+        [[nodiscard]]
+        ReadRequest read( machine::Address address, TickType_t timeout ) noexcept
+        {
+            return ReadRequest( *this, Op::Read, address, {}, timeout );
+        }
+
+        /** @brief Writes raw bytes to a property within a transaction. */
+        /**
+         * @param address [in] The property.
+         * @param data    [in] The new value, up to 255 bytes; must stay valid
+         *                     while the request is awaited.
+         * @param timeout [in] Ticks until `Status::Timeout`; `portMAX_DELAY` waits forever.
+         */
+        [[nodiscard]]
+        WriteRequest write( machine::Address address
+                          , std::span<std::byte const> data
+                          , TickType_t timeout ) noexcept
+        {
+            return WriteRequest( *this, Op::Write, address
+                               , data.first( std::min<std::size_t>( data.size(), UINT8_MAX ) ), timeout );
+        }
+
+        /** @brief Returns a copy of all counters. */
+        [[nodiscard]]
+        Stats stats() const noexcept;
+
+        /* #endregion */// Public methods
+
+    private:
+
+        /* #region Private methods */
+
+        static void windowEntry( void *context ) noexcept;
+
+        static Task<> send( Coalescer *self, Batch *batch ) noexcept;
+
+        [[nodiscard]]
+        Status check( Request &request ) const noexcept;
+
+        void join( Request &request ) noexcept;
+
+        void flush( Batch &batch ) noexcept;
+
+        void fanOut( Batch &batch, Client::TransactResult result ) noexcept;
+
+        void complete( Request &request, Status status ) noexcept;
+
+        void release( Batch &batch ) noexcept;
+
+        /* #endregion */// Private methods
+
+        /* #region Member variables */
+
+        Config config_;
+        std::array<Batch, BATCH_COUNT> batches_ {};
+        Request *waitingHead_ = nullptr;   //!< FIFO of requests without a free batch.
+        Request *waitingTail_ = nullptr;
+
+        std::atomic<std::uint32_t> transactions_ { 0U };
+        std::atomic<std::uint32_t> items_ { 0U };
+        std::atomic<std::uint32_t> filtered_ { 0U };
+
+        /* #endregion */// Member variables
+
+    /* #endregion */// Instance members
+
+    }; // class Coalescer
+
+} // namespace rpc
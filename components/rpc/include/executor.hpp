@@ -0,0 +1,273 @@
+#pragma once
+
+/* C++ Standard Library */
+#include <coroutine>
+#include <cstdint>
+
+/* Custom Library */
+#include <rpc_task.hpp>
+
+/* ESP-IDF */
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+#include <sdkconfig.h>
+
+namespace rpc
+{
+
+    class CancelToken;
+
+    /** @brief Runs coroutines and timers on one FreeRTOS task. */
+    /**
+     * @details
+     * Every coroutine spawned on an executor, and everything it awaits,
+     * runs on the executor's task. Any number of coroutines can be
+     * suspended at once, e.g. waiting for responses of the machine, while
+     * only one task stack exists.
+     *
+     * The task sleeps in `xQueueReceive()` until a job is posted or the
+     * next timer is due, so an idle executor costs no CPU time.
+     *
+     * @par Threading:
+     * - `spawn()`, `post()` and `cancel()` may be called from any task.
+     * - Timers and `CancelToken` must only be used from the executor task,
+     *   i.e. from coroutines it runs.
+     *
+     * @note ja: 1つのFreeRTOSタスク上でコルーチンとタイマーを実行するエグゼキュータ。
+     */
+    class Executor
+    {
+    /* ^\__________________________________________ */
+    /* #region Static members, Inner types.         */
+
+    public:
+
+        /** @brief A function to run on the executor task. */
+        struct Job
+        {
+            void ( *run )( void *context ) noexcept; //!< Called on the executor task.
+            void *context;                           //!< Passed to `run`.
+        };
+
+        /** @brief Intrusive one-shot timer. */
+        /**
+         * @details
+         * Owned by the caller, typically as a member of an awaiter in a
+         * coroutine frame, so arming a timer never allocates.
+         */
+        struct Timer
+        {
+            void ( *fire )( void *context ) noexcept = nullptr; //!< Called on the executor task when due.
+            void *context = nullptr;                            //!< Passed to `fire`.
+            TickType_t deadline = 0U;                           //!< Tick count at which it is due.
+            Timer *next = nullptr;                              //!< Next armed timer, by deadline.
+            bool armed = false;                                 //!< In the list of armed timers.
+        };
+
+        /** @brief Awaiter of `sleepFor()`. */
+        class Sleep
+        {
+        public:
+
+            bool await_ready() const noexcept { return false; }
+
+            void await_suspend( std::coroutine_handle<> awaiter ) noexcept;
+
+            void await_resume() const noexcept { /* Do nothing */ }
+
+        private:
+
+            friend class Executor;
+
+            explicit Sleep( Executor &executor, TickType_t ticks ) noexcept
+                : executor_( executor ), ticks_( ticks )
+            { /* Do nothing */ }
+
+            Executor &executor_;
+            TickType_t ticks_;
+            Timer timer_ {};
+        };
+
+    /* #endregion */// Static members, Inner types
+
+    /* ^\__________________________________________ */
+    /* #region Constructors.                        */
+
+    public:
+
+        explicit Executor() noexcept = default;
+        ~Executor() noexcept;                            //!< Destructor (stops the task).
+        Executor( Executor const & ) noexcept = delete;  //!< Copy constructor (deleted).
+        Executor( Executor && ) noexcept = delete;       //!< Move constructor (deleted).
+
+    /* #endregion */// Constructors
+
+    /* ^\__________________________________________ */
+    /* #region Operators.                           */
+
+    public:
+
+        Executor &operator=( Executor const & ) noexcept = delete; //!< Copy operator (deleted).
+        Executor &operator=( Executor && ) noexcept = delete;      //!< Move operator (deleted).
+
+    /* #endregion */// Operators
+
+    /* ^\__________________________________________ */
+    /* #region Instance members.                    */
+
+    public:
+
+        /* #region Public methods */
+
+        /** @brief Creates the job queue and starts the executor task. */
+        /**
+         * @return `true` if the task runs; `false` on allocation failure.
+         */
+        [[nodiscard]]
+        bool start() noexcept;
+
+        /** @brief Runs a task to completion on the executor and frees it. */
+        /**
+         * @param task [in] The task to run; its frame is freed when it finishes.
+         *
+         * @return `false` if `task` is not valid, or the job queue is full.
+         */
+        bool spawn( Task<> &&task ) noexcept;
+
+        /** @brief Queues a job. */
+        /**
+         * @param job  [in] The job.
+         * @param wait [in] How long to wait for space in the job queue.
+         *
+         * @return `false` if the job queue stayed full.
+         */
+        bool post( Job job, TickType_t wait = 0U ) noexcept;
+
+        /** @brief Queues the resumption of a coroutine. */
+        /**
+         * @copydetails post( Job, TickType_t )
+         */
+        bool post( std::coroutine_handle<> handle, TickType_t wait = 0U ) noexcept;
+
+        /** @brief Cancels a token from any task. */
+        /**
+         * @details
+         * Queues `CancelToken::cancel()`, which then runs on the executor.
+         * The token must stay valid until it ran.
+         *
+         * @return `false` if the job queue stayed full.
+         */
+        bool cancel( CancelToken &token, TickType_t wait = portMAX_DELAY ) noexcept;
+
+        /** @brief Suspends the awaiting coroutine for at least `ticks`. */
+        [[nodiscard]]
+        Sleep sleepFor( TickType_t ticks ) noexcept { return Sleep( *this, ticks ); }
+
+        /** @brief Arms a timer that fires after `ticks`. */
+        /**
+         * @details
+         * Executor task only. An armed timer is re-armed with the new
+         * deadline. A timer with 0 ticks fires before the executor waits
+         * for the next job, which defers a call without using the queue.
+         */
+        void arm( Timer &timer, TickType_t ticks ) noexcept;
+
+        /** @brief Disarms a timer; does nothing if it is not armed. */
+        /**
+         * @details
+         * Executor task only.
+         */
+        void disarm( Timer &timer ) noexcept;
+
+        /* #endregion */// Public methods
+
+    private:
+
+        /* #region Private methods */
+
+        static void entry( void *param ) noexcept;
+
+        void loop() noexcept;
+
+        void fireDue() noexcept;
+
+        /* #endregion */// Private methods
+
+        /* #region Member variables */
+
+        QueueHandle_t queue_ = nullptr;
+        TaskHandle_t task_ = nullptr;
+        Timer *timers_ = nullptr;     //!< Armed timers by deadline; executor task only.
+
+        /* #endregion */// Member variables
+
+    /* #endregion */// Instance members
+
+    }; // class Executor
+
+    /** @brief Cancels the requests it was passed to. */
+    /**
+     * @details
+     * Awaiters subscribe while they are suspended and unsubscribe when they
+     * resume, so a token can be shared by any number of requests and
+     * reused after `reset()`.
+     *
+     * @attention
+     * Executor task only; cancel from other tasks with `Executor::cancel()`.
+     *
+     * @note ja: 渡されたリクエストを取り消すためのトークン。
+     */
+    class CancelToken
+    {
+    public:
+
+        /** @brief Intrusive subscription, owned by the awaiter. */
+        struct Listener
+        {
+            void ( *notify )( void *context ) noexcept = nullptr; //!< Called by `cancel()`.
+            void *context = nullptr;                              //!< Passed to `notify`.
+            Listener *next = nullptr;
+        };
+
+        /** @brief Marks the token cancelled and notifies all subscribers once. */
+        void cancel() noexcept
+        {
+            cancelled_ = true;
+
+            while ( listeners_ )
+            {
+                Listener *const l = listeners_;
+                listeners_ = l->next;
+                l->next = nullptr;
+                l->notify( l->context );
+            }
+        }
+
+        /** @brief Clears the cancelled state for reuse. */
+        void reset() noexcept { cancelled_ = false; }
+
+        [[nodiscard]]
+        bool isCancelled() const noexcept { return cancelled_; }
+
+        void subscribe( Listener &l ) noexcept
+        {
+            l.next = listeners_;
+            listeners_ = &l;
+        }
+
+        void unsubscribe( Listener &l ) noexcept
+        {
+            for ( Listener **p = &listeners_; *p; p = &( *p )->next )
+            {
+                if ( *p == &l ) { *p = l.next; l.next = nullptr; return; }
+            }
+        }
+
+    private:
+
+        Listener *listeners_ = nullptr;
+        bool cancelled_ = false;
+    };
+
+} // namespace rpc
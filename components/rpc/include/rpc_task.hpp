@@ -0,0 +1,217 @@
+#pragma once
+
+/* C++ Standard Library */
+#include <coroutine>
+#include <cstddef>
+#include <cstdlib>
+#include <optional>
+#include <utility>
+
+/* ESP-IDF */
+#include <esp_heap_caps.h>
+
+namespace rpc
+{
+
+    template <typename T = void>
+    class Task;
+
+    namespace detail
+    {
+
+        /** @brief Frame allocation and continuation shared by all promises. */
+        /**
+         * @details
+         * Frames come from `heap_caps_malloc()`. If that fails, the
+         * coroutine returns an invalid task instead of throwing, see
+         * `Task::valid()`.
+         */
+        struct PromiseBase
+        {
+            /** @brief Resumes the awaiting coroutine, if any, by symmetric transfer. */
+            struct FinalAwaiter
+            {
+                bool await_ready() const noexcept { return false; }
+
+                template <typename Promise>
+                std::coroutine_handle<> await_suspend( std::coroutine_handle<Promise> self ) noexcept
+                {
+                    std::coroutine_handle<> const next = self.promise().continuation;
+                    return next ? next : std::noop_coroutine();
+                }
+
+                void await_resume() const noexcept { /* Do nothing */ }
+            };
+
+            static void *operator new( std::size_t size ) noexcept
+            {
+                return heap_caps_malloc( size, MALLOC_CAP_DEFAULT );
+            }
+
+            static void operator delete( void *p ) noexcept { heap_caps_free( p ); }
+
+            std::suspend_always initial_suspend() const noexcept { return {}; }
+
+            FinalAwaiter final_suspend() const noexcept { return {}; }
+
+            void unhandled_exception() const noexcept { std::abort(); }
+
+            std::coroutine_handle<> continuation {}; //!< The coroutine awaiting this one.
+        };
+
+        /** @brief Stores the result of a `Task<T>`. */
+        template <typename T>
+        struct ValuePromise : PromiseBase
+        {
+            void return_value( T value ) noexcept { result.emplace( std::move( value ) ); }
+
+            T take() noexcept { return std::move( *result ); }
+
+            std::optional<T> result;
+        };
+
+        /** @brief `Task<void>` has no result. */
+        template <>
+        struct ValuePromise<void> : PromiseBase
+        {
+            void return_void() const noexcept { /* Do nothing */ }
+
+            void take() const noexcept { /* Do nothing */ }
+        };
+
+    } // namespace detail
+
+    /** @brief Lazily started coroutine that returns a `T` to its awaiter. */
+    /**
+     * @details
+     * A task does not run until it is awaited, either by another task or,
+     * at the top level, by `Executor::spawn()`. When it finishes, it
+     * resumes its awaiter directly, so a chain of tasks runs on the
+     * executor's stack without growing it.
+     *
+     * The frame holds the locals of the coroutine and is freed with the
+     * `Task`. A suspended task therefore costs its frame, typically well
+     * under 200 bytes, instead of a task stack.
+     *
+     * \code{.cpp}
+     * rpc::Task<int> answer() noexcept { co_return 42; }
+     *
+     * rpc::Task<> example() noexcept
+     * {
+     *     int const v = co_await answer();
+     * }
+     * \endcode
+     *
+     * @attention
+     * If the frame cannot be allocated, the task is not `valid()`, and
+     * awaiting it aborts, as plain `new` would.
+     *
+     * @note ja: 待機時に開始され、結果を待機側へ返すコルーチン。
+     */
+    template <typename T>
+    class Task
+    {
+    /* ^\__________________________________________ */
+    /* #region Static members, Inner types.         */
+
+    public:
+
+        /** @brief Coroutine promise of `Task<T>`. */
+        struct promise_type : detail::ValuePromise<T>
+        {
+            Task get_return_object() noexcept
+            {
+                return Task( std::coroutine_handle<promise_type>::from_promise( *this ) );
+            }
+
+            static Task get_return_object_on_allocation_failure() noexcept { return Task(); }
+        };
+
+    private:
+
+        /** @brief Starts the task and suspends the awaiter until it finishes. */
+        struct Awaiter
+        {
+            bool await_ready() const noexcept { return !handle || handle.done(); }
+
+            std::coroutine_handle<> await_suspend( std::coroutine_handle<> awaiter ) const noexcept
+            {
+                handle.promise().continuation = awaiter;
+                return handle;
+            }
+
+            T await_resume() const noexcept
+            {
+                if ( !handle ) { std::abort(); }
+                // ~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Abort on allocation failure!! ]
+
+                return handle.promise().take();
+            }
+
+            std::coroutine_handle<promise_type> handle;
+        };
+
+    /* #endregion */// Static members, Inner types
+
+    /* ^\__________________________________________ */
+    /* #region Constructors.                        */
+
+    public:
+
+        explicit Task() noexcept = default; //!< Invalid task.
+
+        ~Task() noexcept { if ( handle_ ) { handle_.destroy(); } } //!< Destructor (frees the frame).
+
+        Task( Task const & ) noexcept = delete; //!< Copy constructor (deleted).
+
+        Task( Task &&other ) noexcept           //!< Move constructor.
+            : handle_( std::exchange( other.handle_, nullptr ) )
+        { /* Do nothing */ }
+
+    private:
+
+        explicit Task( std::coroutine_handle<promise_type> handle ) noexcept
+            : handle_( handle )
+        { /* Do nothing */ }
+
+    /* #endregion */// Constructors
+
+    /* ^\__________________________________________ */
+    /* #region Operators.                           */
+
+    public:
+
+        Task &operator=( Task const & ) noexcept = delete; //!< Copy operator (deleted).
+        Task &operator=( Task && ) noexcept = delete;      //!< Move operator (deleted).
+
+        /** @brief Runs the task until it finishes and returns its result. */
+        Awaiter operator co_await() const noexcept { return Awaiter{ handle_ }; }
+
+    /* #endregion */// Operators
+
+    /* ^\__________________________________________ */
+    /* #region Instance members.                    */
+
+    public:
+
+        /* #region Getter methods */
+
+        /** @brief Returns `false` if the frame could not be allocated. */
+        [[nodiscard]]
+        bool valid() const noexcept { return static_cast<bool>( handle_ ); }
+
+        /* #endregion */// Getter methods
+
+    private:
+
+        /* #region Member variables */
+
+        std::coroutine_handle<promise_type> handle_ {};
+
+        /* #endregion */// Member variables
+
+    /* #endregion */// Instance members
+
+    }; // class Task
+
+} // namespace rpc
@@ -0,0 +1,301 @@
+#include <unity.h>
+#include <unity_test_runner.h>
+#include <client.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+using namespace machine;
+using namespace rpc;
+
+
+namespace
+{
+    /** @brief Records sent requests; the test plays the machine. */
+    struct Link
+    {
+        std::array<std::array<std::byte, Client::REQUEST_HEADER_SIZE + UINT8_MAX>, 16> frames{};
+        std::atomic<std::size_t> count{0};
+        std::atomic<bool> down{false};
+        std::uintptr_t lowest = UINTPTR_MAX, highest = 0; //!< Stack addresses of the failed sends.
+
+        static bool send(std::span<std::byte const> frame, void *context) noexcept
+        {
+            auto &self = *static_cast<Link *>(context);
+            if (self.down.load())
+            {
+                volatile std::byte mark{};
+                auto const depth = reinterpret_cast<std::uintptr_t>(&mark);
+                self.lowest = std::min(self.lowest, depth);
+                self.highest = std::max(self.highest, depth);
+                return false;
+            }
+            std::size_t const i = self.count.load() % self.frames.size();
+            std::memcpy(self.frames[i].data(), frame.data(), frame.size());
+            self.count.fetch_add(1);
+            return true;
+        }
+
+        std::uint8_t tagOf(std::size_t i) const
+        {
+            return std::to_integer<std::uint8_t>(frames[i % frames.size()][0]);
+        }
+    };
+
+    struct Outcome
+    {
+        std::atomic<bool> done{false};
+        Client::Status status{};
+        std::uint8_t value{0};
+    };
+
+    struct Fixture
+    {
+        Executor executor;
+        Link link;
+        Client client{Client::Config{&executor, &Link::send, &link}};
+
+        Fixture()
+        {
+            TEST_ASSERT_TRUE(executor.start());
+            TEST_ASSERT_TRUE(client.start());
+        }
+    };
+
+    // Note: Never destroyed, since the executor task is never stopped.
+    Fixture &fixture()
+    {
+        static Fixture *f = new Fixture();
+        return *f;
+    }
+
+    Task<> readOne(Client *client, Address address, TickType_t timeout, CancelToken *cancel, Outcome *out) noexcept
+    {
+        auto r = co_await client->read(address, timeout, cancel);
+        out->status = r.status;
+        if (r.value.has_value() && r.value->size() > 0)
+        {
+            std::array<std::byte, 4> buf{};
+            static_cast<void>(r.value->copyTo(buf));
+            out->value = std::to_integer<std::uint8_t>(buf[0]);
+        }
+        out->done.store(true);
+    }
+
+    Task<> writeOne(Client *client, Address address, std::byte value, Outcome *out) noexcept
+    {
+        out->status = co_await client->write(address, std::span<std::byte const>(&value, 1), pdMS_TO_TICKS(1000));
+        out->done.store(true);
+    }
+
+    void respond(Client &client, std::uint8_t tag, std::uint8_t status, std::uint8_t value, bool withValue)
+    {
+        std::array<std::byte, 5> frame{std::byte{tag}, std::byte{status}, static_cast<std::byte>(withValue ? 1 : 0), std::byte{0}, std::byte{value}};
+        std::size_t const size = withValue ? 5U : 4U;
+
+        // Note: Split on purpose to exercise reassembly.
+        TEST_ASSERT_EQUAL(2U, client.onReceive(std::span<std::byte const>(frame.data(), 2), portMAX_DELAY));
+        TEST_ASSERT_EQUAL(size - 2U, client.onReceive(std::span<std::byte const>(frame.data() + 2, size - 2U), portMAX_DELAY));
+    }
+
+    bool waitFor(std::atomic<bool> const &flag)
+    {
+        for (int i = 0; i < 200 && !flag.load(); i++) { vTaskDelay(pdMS_TO_TICKS(5)); }
+        return flag.load();
+    }
+
+    bool waitForSent(Link const &link, std::size_t count)
+    {
+        for (int i = 0; i < 200 && link.count.load() < count; i++) { vTaskDelay(pdMS_TO_TICKS(5)); }
+        return link.count.load() >= count;
+    }
+}
+
+TEST_CASE("Client pipelines requests and matches responses by tag", "[Client]")
+{
+    Fixture &f = fixture();
+    std::size_t const base = f.link.count.load();
+    std::array<Outcome, 3> reads;
+    Outcome write;
+
+    for (std::uint8_t i = 0; i < reads.size(); i++)
+    {
+        TEST_ASSERT_TRUE(f.executor.spawn(readOne(&f.client, Address(0, 0, 1, 0, i), pdMS_TO_TICKS(1000), nullptr, &reads[i])));
+    }
+    TEST_ASSERT_TRUE(f.executor.spawn(writeOne(&f.client, Address(0, 0, 1, 0, 9), std::byte{7}, &write)));
+
+    // Note: All sent before any response arrived.
+    TEST_ASSERT_TRUE(waitForSent(f.link, base + 4));
+    TEST_ASSERT_EQUAL_UINT8(0x02, std::to_integer<std::uint8_t>(f.link.frames[(base + 3) % 16][1]));
+    TEST_ASSERT_EQUAL_UINT8(9, std::to_integer<std::uint8_t>(f.link.frames[(base + 3) % 16][6]));
+    TEST_ASSERT_EQUAL_UINT8(7, std::to_integer<std::uint8_t>(f.link.frames[(base + 3) % 16][9]));
+
+    respond(f.client, f.link.tagOf(base + 3), 0x02, 0, false);
+    for (std::size_t i = reads.size(); i-- > 0;)
+    {
+        std::uint8_t const code = std::to_integer<std::uint8_t>(f.link.frames[(base + i) % 16][6]);
+        respond(f.client, f.link.tagOf(base + i), 0x00, static_cast<std::uint8_t>(100 + code), true);
+    }
+
+    TEST_ASSERT_TRUE(waitFor(write.done));
+    TEST_ASSERT_EQUAL(static_cast<int>(Client::Status::Rejected), static_cast<int>(write.status));
+
+    for (std::uint8_t i = 0; i < reads.size(); i++)
+    {
+        TEST_ASSERT_TRUE(waitFor(reads[i].done));
+        TEST_ASSERT_EQUAL(static_cast<int>(Client::Status::Ok), static_cast<int>(reads[i].status));
+        TEST_ASSERT_EQUAL_UINT8(100 + i, reads[i].value);
+    }
+}
+
+TEST_CASE("Client limits requests in flight", "[Client]")
+{
+    Fixture &f = fixture();
+    std::size_t const base = f.link.count.load();
+    std::array<Outcome, Client::MAX_IN_FLIGHT + 1> reads;
+
+    for (std::size_t i = 0; i < reads.size(); i++)
+    {
+        auto const code = static_cast<std::uint8_t>(i);
+        TEST_ASSERT_TRUE(f.executor.spawn(readOne(&f.client, Address(0, 0, 2, 0, code), pdMS_TO_TICKS(1000), nullptr, &reads[i])));
+    }
+
+    TEST_ASSERT_TRUE(waitForSent(f.link, base + Client::MAX_IN_FLIGHT));
+    vTaskDelay(pdMS_TO_TICKS(20));
+    TEST_ASSERT_EQUAL(base + Client::MAX_IN_FLIGHT, f.link.count.load());
+
+    // Note: The first response frees a tag for the waiting request.
+    respond(f.client, f.link.tagOf(base), 0x01, 0, false);
+    TEST_ASSERT_TRUE(waitFor(reads[0].done));
+    TEST_ASSERT_EQUAL(static_cast<int>(Client::Status::NotFound), static_cast<int>(reads[0].status));
+    TEST_ASSERT_TRUE(waitForSent(f.link, base + Client::MAX_IN_FLIGHT + 1));
+
+    for (std::size_t i = 1; i < reads.size(); i++)
+    {
+        respond(f.client, f.link.tagOf(base + i), 0x00, 1, true);
+        TEST_ASSERT_TRUE(waitFor(reads[i].done));
+    }
+    TEST_ASSERT_EQUAL_UINT32(Client::MAX_IN_FLIGHT, f.client.stats().maxInFlight);
+}
+
+TEST_CASE("Client fails every waiting request when the link is down", "[Client]")
+{
+    Fixture &f = fixture();
+    std::size_t const base = f.link.count.load();
+    std::array<Outcome, Client::MAX_IN_FLIGHT> inFlight;
+    std::array<Outcome, 3 * Client::MAX_IN_FLIGHT> waiting;
+
+    for (std::size_t i = 0; i < inFlight.size(); i++)
+    {
+        auto const code = static_cast<std::uint8_t>(i);
+        TEST_ASSERT_TRUE(f.executor.spawn(readOne(&f.client, Address(0, 0, 5, 0, code), pdMS_TO_TICKS(1000), nullptr, &inFlight[i])));
+    }
+    TEST_ASSERT_TRUE(waitForSent(f.link, base + Client::MAX_IN_FLIGHT));
+
+    f.link.down.store(true);
+    for (std::size_t i = 0; i < waiting.size(); i++)
+    {
+        auto const code = static_cast<std::uint8_t>(0x80 + i);
+        TEST_ASSERT_TRUE(f.executor.spawn(readOne(&f.client, Address(0, 0, 5, 0, code), pdMS_TO_TICKS(1000), nullptr, &waiting[i])));
+    }
+    vTaskDelay(pdMS_TO_TICKS(20));
+
+    // Note: The first response frees a tag; every waiting request then fails in one loop.
+    respond(f.client, f.link.tagOf(base), 0x00, 1, true);
+    for (Outcome &r : waiting)
+    {
+        TEST_ASSERT_TRUE(waitFor(r.done));
+        TEST_ASSERT_EQUAL(static_cast<int>(Client::Status::SendFailed), static_cast<int>(r.status));
+    }
+    TEST_ASSERT_TRUE(f.link.highest - f.link.lowest < 64U); // Note: Not one frame deeper per failure.
+
+    f.link.down.store(false);
+    for (std::size_t i = 0; i < inFlight.size(); i++)
+    {
+        if (i > 0) { respond(f.client, f.link.tagOf(base + i), 0x00, 1, true); }
+        TEST_ASSERT_TRUE(waitFor(inFlight[i].done));
+        TEST_ASSERT_EQUAL(static_cast<int>(Client::Status::Ok), static_cast<int>(inFlight[i].status));
+    }
+    TEST_ASSERT_EQUAL(base + Client::MAX_IN_FLIGHT, f.link.count.load());
+}
+
+TEST_CASE("Client times out and drops late responses", "[Client]")
+{
+    Fixture &f = fixture();
+    std::size_t const base = f.link.count.load();
+    Client::Stats const before = f.client.stats();
+    Outcome read;
+
+    TEST_ASSERT_TRUE(f.executor.spawn(readOne(&f.client, Address(0, 0, 3, 0, 1), pdMS_TO_TICKS(20), nullptr, &read)));
+    TEST_ASSERT_TRUE(waitFor(read.done));
+    TEST_ASSERT_EQUAL(static_cast<int>(Client::Status::Timeout), static_cast<int>(read.status));
+
+    TEST_ASSERT_TRUE(waitForSent(f.link, base + 1));
+    respond(f.client, f.link.tagOf(base), 0x00, 5, true);
+    for (int i = 0; i < 200 && f.client.stats().stale == before.stale; i++) { vTaskDelay(pdMS_TO_TICKS(5)); }
+
+    TEST_ASSERT_EQUAL_UINT32(before.timeouts + 1, f.client.stats().timeouts);
+    TEST_ASSERT_EQUAL_UINT32(before.stale + 1, f.client.stats().stale);
+}
+
+TEST_CASE("Client drops the body of an oversized response", "[Client]")
+{
+    Fixture &f = fixture();
+    std::size_t const base = f.link.count.load();
+    Client::Stats const before = f.client.stats();
+    Outcome read;
+
+    TEST_ASSERT_TRUE(f.executor.spawn(readOne(&f.client, Address(0, 0, 6, 0, 1), pdMS_TO_TICKS(1000), nullptr, &read)));
+    TEST_ASSERT_TRUE(waitForSent(f.link, base + 1));
+    std::uint8_t const tag = f.link.tagOf(base);
+
+    // Note: The body is made of responses for the same tag; parsing any of them as a header would deliver 99.
+    constexpr std::size_t BODY = (Client::MAX_BODY_SIZE / 5U + 1U) * 5U;
+    std::array<std::byte, 4> const header{std::byte{tag}, std::byte{0x00}, static_cast<std::byte>(BODY & 0xFF), static_cast<std::byte>(BODY >> 8)};
+    TEST_ASSERT_EQUAL(4U, f.client.onReceive(header, portMAX_DELAY));
+    std::array<std::byte, 5> const fake{std::byte{tag}, std::byte{0x00}, std::byte{1}, std::byte{0}, std::byte{99}};
+    for (std::size_t i = 0; i < BODY; i += fake.size())
+    {
+        // Note: The body is larger than the stream buffer, which may take only a part at a time.
+        std::span<std::byte const> rest(fake);
+        while (!rest.empty()) { rest = rest.subspan(f.client.onReceive(rest, portMAX_DELAY)); }
+    }
+
+    respond(f.client, tag, 0x00, 7, true);
+    TEST_ASSERT_TRUE(waitFor(read.done));
+    TEST_ASSERT_EQUAL(static_cast<int>(Client::Status::Ok), static_cast<int>(read.status));
+    TEST_ASSERT_EQUAL(7, read.value);
+    TEST_ASSERT_EQUAL_UINT32(before.stale + 1, f.client.stats().stale);
+}
+
+TEST_CASE("Client cancels requests through a token", "[Client]")
+{
+    Fixture &f = fixture();
+    std::size_t const base = f.link.count.load();
+    CancelToken token;
+    std::array<Outcome, 2> reads;
+
+    for (std::size_t i = 0; i < reads.size(); i++)
+    {
+        auto const code = static_cast<std::uint8_t>(i);
+        TEST_ASSERT_TRUE(f.executor.spawn(readOne(&f.client, Address(0, 0, 4, 0, code), portMAX_DELAY, &token, &reads[i])));
+    }
+    TEST_ASSERT_TRUE(waitForSent(f.link, base + 2));
+
+    TEST_ASSERT_TRUE(f.executor.cancel(token));
+    for (Outcome &r : reads)
+    {
+        TEST_ASSERT_TRUE(waitFor(r.done));
+        TEST_ASSERT_EQUAL(static_cast<int>(Client::Status::Cancelled), static_cast<int>(r.status));
+    }
+
+    // Note: A cancelled token ends new requests without sending them.
+    Outcome late;
+    TEST_ASSERT_TRUE(f.executor.spawn(readOne(&f.client, Address(0, 0, 4, 0, 9), portMAX_DELAY, &token, &late)));
+    TEST_ASSERT_TRUE(waitFor(late.done));
+    TEST_ASSERT_EQUAL(static_cast<int>(Client::Status::Cancelled), static_cast<int>(late.status));
+    TEST_ASSERT_EQUAL(base + 2, f.link.count.load());
+}
@@ -0,0 +1,185 @@
+#include <unity.h>
+#include <unity_test_runner.h>
+#include <coalescer.hpp>
+#include "property_fixture.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <optional>
+#include <utility>
+
+using namespace machine;
+using namespace machine::property;
+using namespace rpc;
+
+
+namespace
+{
+    /** @brief Records sent requests; the test plays the machine. */
+    struct Link
+    {
+        std::array<std::array<std::byte, Client::REQUEST_HEADER_SIZE + Client::MAX_BODY_SIZE>, 4> frames{};
+        std::array<std::size_t, 4> sizes{};
+        std::atomic<std::size_t> count{0};
+
+        static bool send(std::span<std::byte const> frame, void *context) noexcept
+        {
+            auto &self = *static_cast<Link *>(context);
+            std::size_t const i = self.count.load() % self.frames.size();
+            std::memcpy(self.frames[i].data(), frame.data(), frame.size());
+            self.sizes[i] = frame.size();
+            self.count.fetch_add(1);
+            return true;
+        }
+
+        std::uint8_t at(std::size_t i, std::size_t offset) const
+        {
+            return std::to_integer<std::uint8_t>(frames[i % frames.size()][offset]);
+        }
+    };
+
+    struct Outcome
+    {
+        std::atomic<bool> done{false};
+        Client::Status status{};
+        std::uint8_t value{0};
+    };
+
+    Property makeProperty(std::uint8_t code, Permission::Kind permission)
+    {
+        return test::makeNumber(code, code, 100, permission);
+    }
+
+    std::optional<PropertyTable> makeTable()
+    {
+        PropertyTable::Builder builder;
+        builder.add(Address(0, 0, 5, 0, 1), makeProperty(1, Permission::Kind::ReadOnly));
+        builder.add(Address(0, 0, 5, 0, 2), makeProperty(2, Permission::Kind::WriteOnly));
+        builder.add(Address(0, 0, 5, 0, 3), makeProperty(3, Permission::Kind::ReadWrite));
+        return builder.build();
+    }
+
+    struct Fixture
+    {
+        Executor executor;
+        Link link;
+        Client client{Client::Config{&executor, &Link::send, &link}};
+        std::optional<PropertyTable> table = makeTable();
+        Coalescer coalescer{Coalescer::Config{&client, &executor, &*table, pdMS_TO_TICKS(20)}};
+
+        Fixture()
+        {
+            TEST_ASSERT_TRUE(table.has_value());
+            TEST_ASSERT_TRUE(executor.start());
+            TEST_ASSERT_TRUE(client.start());
+        }
+    };
+
+    // Note: Never destroyed, since the executor task is never stopped.
+    Fixture &fixture()
+    {
+        static Fixture *f = new Fixture();
+        return *f;
+    }
+
+    Task<> readOne(Coalescer *coalescer, Address address, Outcome *out) noexcept
+    {
+        auto r = co_await coalescer->read(address, pdMS_TO_TICKS(1000));
+        out->status = r.status;
+        if (r.value.has_value() && r.value->size() > 0)
+        {
+            std::array<std::byte, 4> buf{};
+            static_cast<void>(r.value->copyTo(buf));
+            out->value = std::to_integer<std::uint8_t>(buf[0]);
+        }
+        out->done.store(true);
+    }
+
+    Task<> writeOne(Coalescer *coalescer, Address address, std::byte value, Outcome *out) noexcept
+    {
+        out->status = co_await coalescer->write(address, std::span<std::byte const>(&value, 1), pdMS_TO_TICKS(1000));
+        out->done.store(true);
+    }
+
+    bool waitFor(std::atomic<bool> const &flag)
+    {
+        for (int i = 0; i < 200 && !flag.load(); i++) { vTaskDelay(pdMS_TO_TICKS(5)); }
+        return flag.load();
+    }
+
+    bool waitForSent(Link const &link, std::size_t count)
+    {
+        for (int i = 0; i < 200 && link.count.load() < count; i++) { vTaskDelay(pdMS_TO_TICKS(5)); }
+        return link.count.load() >= count;
+    }
+}
+
+TEST_CASE("Coalescer sends one transaction per component and fans out results", "[Coalescer]")
+{
+    Fixture &f = fixture();
+    std::size_t const base = f.link.count.load();
+    Coalescer::Stats const before = f.coalescer.stats();
+    Outcome readRo, readRw, writeWo;
+
+    TEST_ASSERT_TRUE(f.executor.spawn(readOne(&f.coalescer, Address(0, 0, 5, 0, 1), &readRo)));
+    TEST_ASSERT_TRUE(f.executor.spawn(writeOne(&f.coalescer, Address(0, 0, 5, 0, 2), std::byte{42}, &writeWo)));
+    TEST_ASSERT_TRUE(f.executor.spawn(readOne(&f.coalescer, Address(0, 0, 5, 0, 3), &readRw)));
+
+    TEST_ASSERT_TRUE(waitForSent(f.link, base + 1));
+    vTaskDelay(pdMS_TO_TICKS(40));
+    TEST_ASSERT_EQUAL(base + 1, f.link.count.load());
+
+    // Note: read 1, write 2 = 42, read 3; in the order they were awaited.
+    std::array<std::uint8_t, 10> const expected{0x01, 1, 0, 0x02, 2, 1, 42, 0x01, 3, 0};
+    TEST_ASSERT_EQUAL_UINT8(0x03, f.link.at(base, 1));
+    TEST_ASSERT_EQUAL_UINT8(0x00, f.link.at(base, 6));
+    TEST_ASSERT_EQUAL_UINT8(expected.size(), f.link.at(base, 7));
+    TEST_ASSERT_EQUAL(Client::REQUEST_HEADER_SIZE + expected.size(), f.link.sizes[base % f.link.sizes.size()]);
+    for (std::size_t i = 0; i < expected.size(); i++)
+    {
+        TEST_ASSERT_EQUAL_UINT8(expected[i], f.link.at(base, Client::REQUEST_HEADER_SIZE + i));
+    }
+
+    std::array<std::byte, 12> frame{std::byte{f.link.at(base, 0)}, std::byte{0x00}, std::byte{8}, std::byte{0}
+                                  , std::byte{0x00}, std::byte{1}, std::byte{11}
+                                  , std::byte{0x02}, std::byte{0}
+                                  , std::byte{0x00}, std::byte{1}, std::byte{33}};
+    TEST_ASSERT_EQUAL(frame.size(), f.client.onReceive(frame, portMAX_DELAY));
+
+    TEST_ASSERT_TRUE(waitFor(readRo.done));
+    TEST_ASSERT_TRUE(waitFor(writeWo.done));
+    TEST_ASSERT_TRUE(waitFor(readRw.done));
+    TEST_ASSERT_EQUAL(static_cast<int>(Client::Status::Ok), static_cast<int>(readRo.status));
+    TEST_ASSERT_EQUAL_UINT8(11, readRo.value);
+    TEST_ASSERT_EQUAL(static_cast<int>(Client::Status::Rejected), static_cast<int>(writeWo.status));
+    TEST_ASSERT_EQUAL(static_cast<int>(Client::Status::Ok), static_cast<int>(readRw.status));
+    TEST_ASSERT_EQUAL_UINT8(33, readRw.value);
+
+    TEST_ASSERT_EQUAL_UINT32(before.transactions + 1, f.coalescer.stats().transactions);
+    TEST_ASSERT_EQUAL_UINT32(before.items + 3, f.coalescer.stats().items);
+}
+
+TEST_CASE("Coalescer filters by permission without using the link", "[Coalescer]")
+{
+    Fixture &f = fixture();
+    std::size_t const base = f.link.count.load();
+    Coalescer::Stats const before = f.coalescer.stats();
+    Outcome readWo, writeRo, readMissing;
+
+    TEST_ASSERT_TRUE(f.executor.spawn(readOne(&f.coalescer, Address(0, 0, 5, 0, 2), &readWo)));
+    TEST_ASSERT_TRUE(f.executor.spawn(writeOne(&f.coalescer, Address(0, 0, 5, 0, 1), std::byte{1}, &writeRo)));
+    TEST_ASSERT_TRUE(f.executor.spawn(readOne(&f.coalescer, Address(0, 0, 5, 0, 9), &readMissing)));
+
+    TEST_ASSERT_TRUE(waitFor(readWo.done));
+    TEST_ASSERT_TRUE(waitFor(writeRo.done));
+    TEST_ASSERT_TRUE(waitFor(readMissing.done));
+    TEST_ASSERT_EQUAL(static_cast<int>(Client::Status::NotPermitted), static_cast<int>(readWo.status));
+    TEST_ASSERT_EQUAL(static_cast<int>(Client::Status::NotPermitted), static_cast<int>(writeRo.status));
+    TEST_ASSERT_EQUAL(static_cast<int>(Client::Status::NotFound), static_cast<int>(readMissing.status));
+
+    vTaskDelay(pdMS_TO_TICKS(40));
+    TEST_ASSERT_EQUAL(base, f.link.count.load());
+    TEST_ASSERT_EQUAL_UINT32(before.filtered + 3, f.coalescer.stats().filtered);
+    TEST_ASSERT_EQUAL_UINT32(before.transactions, f.coalescer.stats().transactions);
+}
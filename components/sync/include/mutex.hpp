@@ -0,0 +1,228 @@
+#pragma once
+
+/* ESP-IDF */
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+/**
+ * @namespace rtos
+ * @brief Lightweight synchronization primitives on FreeRTOS.
+ * @note ja: FreeRTOS上の軽量な同期プリミティブ。
+ *
+ * @details
+ * Every primitive keeps its FreeRTOS control block inside the object
+ * (static allocation), so creating one never touches the heap and never
+ * fails. Objects are neither copyable nor movable, because FreeRTOS
+ * refers to the control block by address.
+ *
+ * Not named `sync`, which newlib declares as a function in `<unistd.h>`.
+ */
+namespace rtos
+{
+
+    /** @brief Mutex on a statically allocated FreeRTOS semaphore. */
+    /**
+     * @details
+     * Uses `xSemaphoreCreateMutexStatic()`, i.e. with priority inheritance.
+     * Not recursive: a task must not lock it twice; see `RecursiveMutex`.
+     * Must not be used from an ISR.
+     *
+     * \code{.cpp}
+     * rtos::Mutex mutex;
+     *
+     * {
+     *     rtos::Guard<rtos::Mutex> const guard( mutex );
+     *     // ...
+     * }
+     *
+     * if ( rtos::Guard<rtos::Mutex> const guard( mutex, pdMS_TO_TICKS( 10 ) ); guard )
+     * {
+     *     // ...
+     * }
+     * \endcode
+     *
+     * @note ja: 静的に確保したFreeRTOSセマフォによるミューテックス。ヒープを使わない。
+     */
+    class Mutex
+    {
+    /* ^\__________________________________________ */
+    /* #region Constructors.                        */
+
+    public:
+
+        /** @brief Creates the mutex in place; never fails. */
+        explicit Mutex() noexcept : handle_( xSemaphoreCreateMutexStatic( &buffer_ ) ) {}
+
+        ~Mutex() noexcept { vSemaphoreDelete( handle_ ); }  //!< Destructor (must not be locked).
+        Mutex( Mutex const & ) noexcept = delete;            //!< Copy constructor (deleted).
+        Mutex( Mutex && ) noexcept = delete;                 //!< Move constructor (deleted).
+
+    /* #endregion */// Constructors
+
+    /* ^\__________________________________________ */
+    /* #region Operators.                           */
+
+    public:
+
+        Mutex &operator=( Mutex const & ) noexcept = delete; //!< Copy operator (deleted).
+        Mutex &operator=( Mutex && ) noexcept = delete;      //!< Move operator (deleted).
+
+    /* #endregion */// Operators
+
+    /* ^\__________________________________________ */
+    /* #region Instance members.                    */
+
+    public:
+
+        /* #region Public methods */
+
+        /** @brief Waits until the mutex is taken. */
+        void lock() noexcept { xSemaphoreTake( handle_, portMAX_DELAY ); }
+
+        /** @brief Takes the mutex if it is free. */
+        /**
+         * @return `true` if taken; `false` otherwise.
+         */
+        [[nodiscard]]
+        bool tryLock() noexcept { return tryLockFor( 0U ); }
+
+        /** @brief Waits at most `timeout` for the mutex. */
+        /**
+         * @param timeout [in] Ticks to wait; `portMAX_DELAY` waits forever.
+         *
+         * @return `true` if taken; `false` on timeout.
+         */
+        [[nodiscard]]
+        bool tryLockFor( TickType_t timeout ) noexcept { return xSemaphoreTake( handle_, timeout ) == pdTRUE; }
+
+        /** @brief Releases the mutex; must be called by the task that took it. */
+        void unlock() noexcept { xSemaphoreGive( handle_ ); }
+
+        /* #endregion */// Public methods
+
+    private:
+
+        /* #region Member variables */
+
+        StaticSemaphore_t buffer_;      //!< Control block; FreeRTOS refers to it by address.
+        SemaphoreHandle_t handle_;      //!< Points to `buffer_`.
+
+        /* #endregion */// Member variables
+
+    /* #endregion */// Instance members
+
+    }; // class Mutex
+
+    /** @brief Recursive mutex on a statically allocated FreeRTOS semaphore. */
+    /**
+     * @details
+     * Same as `Mutex`, but the owning task may lock it again; it is
+     * released after as many `unlock()` calls.
+     *
+     * @note ja: 同じタスクが重ねてロックできる、静的確保の再帰ミューテックス。
+     */
+    class RecursiveMutex
+    {
+    /* ^\__________________________________________ */
+    /* #region Constructors.                        */
+
+    public:
+
+        /** @copydoc Mutex::Mutex() */
+        explicit RecursiveMutex() noexcept : handle_( xSemaphoreCreateRecursiveMutexStatic( &buffer_ ) ) {}
+
+        ~RecursiveMutex() noexcept { vSemaphoreDelete( handle_ ); }      //!< Destructor (must not be locked).
+        RecursiveMutex( RecursiveMutex const & ) noexcept = delete;      //!< Copy constructor (deleted).
+        RecursiveMutex( RecursiveMutex && ) noexcept = delete;           //!< Move constructor (deleted).
+
+    /* #endregion */// Constructors
+
+    /* ^\__________________________________________ */
+    /* #region Operators.                           */
+
+    public:
+
+        RecursiveMutex &operator=( RecursiveMutex const & ) noexcept = delete; //!< Copy operator (deleted).
+        RecursiveMutex &operator=( RecursiveMutex && ) noexcept = delete;      //!< Move operator (deleted).
+
+    /* #endregion */// Operators
+
+    /* ^\__________________________________________ */
+    /* #region Instance members.                    */
+
+    public:
+
+        /* #region Public methods */
+
+        /** @copydoc Mutex::lock() */
+        void lock() noexcept { xSemaphoreTakeRecursive( handle_, portMAX_DELAY ); }
+
+        /** @copydoc Mutex::tryLock() */
+        [[nodiscard]]
+        bool tryLock() noexcept { return tryLockFor( 0U ); }
+
+        /** @copydoc Mutex::tryLockFor() */
+        [[nodiscard]]
+        bool tryLockFor( TickType_t timeout ) noexcept { return xSemaphoreTakeRecursive( handle_, timeout ) == pdTRUE; }
+
+        /** @copydoc Mutex::unlock() */
+        void unlock() noexcept { xSemaphoreGiveRecursive( handle_ ); }
+
+        /* #endregion */// Public methods
+
+    private:
+
+        /* #region Member variables */
+
+        StaticSemaphore_t buffer_;      //!< Control block; FreeRTOS refers to it by address.
+        SemaphoreHandle_t handle_;      //!< Points to `buffer_`.
+
+        /* #endregion */// Member variables
+
+    /* #endregion */// Instance members
+
+    }; // class RecursiveMutex
+
+    /** @brief Holds a lock for the lifetime of the guard. */
+    /**
+     * @details
+     * Works with every type that has `lock()`, `tryLockFor()` and
+     * `unlock()`: `Mutex`, `RecursiveMutex` and, exclusively, `RwLock`.
+     *
+     * @tparam Lockable The lock type.
+     *
+     * @note ja: スコープの間ロックを保持するRAIIガード。タイムアウト付きも可。
+     */
+    template <typename Lockable>
+    class Guard
+    {
+    public:
+
+        /** @brief Waits until `lock` is taken. */
+        explicit Guard( Lockable &lock ) noexcept : lock_( &lock ) { lock.lock(); }
+
+        /** @brief Waits at most `timeout` for `lock`; see `owns()`. */
+        explicit Guard( Lockable &lock, TickType_t timeout ) noexcept
+            : lock_( lock.tryLockFor( timeout ) ? &lock : nullptr )
+        {}
+
+        ~Guard() noexcept { if ( lock_ != nullptr ) { lock_->unlock(); } }  //!< Destructor (releases the lock if held).
+        Guard( Guard const & ) noexcept = delete;                           //!< Copy constructor (deleted).
+        Guard( Guard && ) noexcept = delete;                                //!< Move constructor (deleted).
+        Guard &operator=( Guard const & ) noexcept = delete;                //!< Copy operator (deleted).
+        Guard &operator=( Guard && ) noexcept = delete;                     //!< Move operator (deleted).
+
+        /** @brief Returns `true` if the lock is held, i.e. it did not time out. */
+        [[nodiscard]]
+        bool owns() const noexcept { return lock_ != nullptr; }
+
+        /** @copydoc owns() */
+        [[nodiscard]]
+        explicit operator bool() const noexcept { return owns(); }
+
+    private:
+
+        Lockable *lock_;    //!< The held lock; `nullptr` if not taken.
+    };
+
+} // namespace rtos
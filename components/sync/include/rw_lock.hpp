@@ -0,0 +1,181 @@
+#pragma once
+
+/* C++ Standard Library */
+#include <atomic>
+#include <cstdint>
+
+/* Custom Library */
+#include <mutex.hpp>
+
+/* ESP-IDF */
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+namespace rtos
+{
+
+    /** @brief Reader-writer lock on statically allocated FreeRTOS semaphores. */
+    /**
+     * @details
+     * Any number of readers share the lock; a writer holds it alone.
+     *
+     * \code{.cpp}
+     * rtos::RwLock lock;
+     *
+     * // readers
+     * rtos::SharedGuard<rtos::RwLock> const reading( lock );
+     *
+     * // writer
+     * rtos::Guard<rtos::RwLock> const writing( lock );
+     * \endcode
+     *
+     * @par Design:
+     * A `Mutex` gate is held by a writer for as long as it holds the lock,
+     * and by a reader only while it registers in an atomic counter. A
+     * writer that passed the gate waits on a binary semaphore, given by the
+     * last reader leaving, until the counter drops to zero. Readers that
+     * arrive meanwhile wait at the gate, so writers are not starved; the
+     * gate also passes priority inheritance on to the writer.
+     *
+     * @attention
+     * - A reader must not lock shared again while it holds the lock: a
+     *   writer waiting in between would deadlock both.
+     * - Must not be used from an ISR.
+     *
+     * @note ja: 読み手は共有、書き手は排他で保持するリーダー・ライターロック。書き手を飢えさせない。
+     */
+    class RwLock
+    {
+    /* ^\__________________________________________ */
+    /* #region Constructors.                        */
+
+    public:
+
+        /** @brief Creates the lock in place; never fails. */
+        explicit RwLock() noexcept;
+
+        ~RwLock() noexcept;                             //!< Destructor (must not be locked).
+        RwLock( RwLock const & ) noexcept = delete;     //!< Copy constructor (deleted).
+        RwLock( RwLock && ) noexcept = delete;          //!< Move constructor (deleted).
+
+    /* #endregion */// Constructors
+
+    /* ^\__________________________________________ */
+    /* #region Operators.                           */
+
+    public:
+
+        RwLock &operator=( RwLock const & ) noexcept = delete; //!< Copy operator (deleted).
+        RwLock &operator=( RwLock && ) noexcept = delete;      //!< Move operator (deleted).
+
+    /* #endregion */// Operators
+
+    /* ^\__________________________________________ */
+    /* #region Instance members.                    */
+
+    public:
+
+        /* #region Public methods */
+
+        /** @brief Waits until the lock is held exclusively. */
+        void lock() noexcept { static_cast<void>( tryLockFor( portMAX_DELAY ) ); }
+
+        /** @brief Takes the lock exclusively if there is neither a reader nor a writer. */
+        [[nodiscard]]
+        bool tryLock() noexcept { return tryLockFor( 0U ); }
+
+        /** @brief Waits at most `timeout` for the lock, exclusively. */
+        /**
+         * @details
+         * The timeout covers both the wait for other writers and the wait
+         * for the readers to leave.
+         *
+         * @param timeout [in] Ticks to wait; `portMAX_DELAY` waits forever.
+         *
+         * @return `true` if taken; `false` on timeout.
+         */
+        [[nodiscard]]
+        bool tryLockFor( TickType_t timeout ) noexcept;
+
+        /** @brief Releases the exclusive lock. */
+        void unlock() noexcept { gate_.unlock(); }
+
+        /** @brief Waits until the lock is held shared. */
+        void lockShared() noexcept { static_cast<void>( tryLockSharedFor( portMAX_DELAY ) ); }
+
+        /** @brief Takes the lock shared if there is no writer. */
+        [[nodiscard]]
+        bool tryLockShared() noexcept { return tryLockSharedFor( 0U ); }
+
+        /** @brief Waits at most `timeout` for the lock, shared. */
+        /**
+         * @param timeout [in] Ticks to wait; `portMAX_DELAY` waits forever.
+         *
+         * @return `true` if taken; `false` on timeout.
+         */
+        [[nodiscard]]
+        bool tryLockSharedFor( TickType_t timeout ) noexcept;
+
+        /** @brief Releases the shared lock. */
+        void unlockShared() noexcept;
+
+        /* #endregion */// Public methods
+
+    private:
+
+        /* #region Member variables */
+
+        Mutex gate_;                                    //!< Held by a writer, or by a reader while it registers.
+        std::atomic<std::uint32_t> readers_ { 0U };     //!< Readers holding the lock.
+        StaticSemaphore_t idleBuffer_;                  //!< Control block of `idle_`.
+        SemaphoreHandle_t idle_;                        //!< Given by the last reader leaving.
+
+        /* #endregion */// Member variables
+
+    /* #endregion */// Instance members
+
+    }; // class RwLock
+
+    /** @brief Holds a lock shared for the lifetime of the guard. */
+    /**
+     * @details
+     * Works with every type that has `lockShared()`, `tryLockSharedFor()`
+     * and `unlockShared()`, i.e. `RwLock`.
+     *
+     * @tparam SharedLockable The lock type.
+     *
+     * @note ja: スコープの間ロックを共有で保持するRAIIガード。
+     */
+    template <typename SharedLockable>
+    class SharedGuard
+    {
+    public:
+
+        /** @brief Waits until `lock` is taken shared. */
+        explicit SharedGuard( SharedLockable &lock ) noexcept : lock_( &lock ) { lock.lockShared(); }
+
+        /** @brief Waits at most `timeout` for `lock`; see `owns()`. */
+        explicit SharedGuard( SharedLockable &lock, TickType_t timeout ) noexcept
+            : lock_( lock.tryLockSharedFor( timeout ) ? &lock : nullptr )
+        {}
+
+        ~SharedGuard() noexcept { if ( lock_ != nullptr ) { lock_->unlockShared(); } }  //!< Destructor (releases the lock if held).
+        SharedGuard( SharedGuard const & ) noexcept = delete;                           //!< Copy constructor (deleted).
+        SharedGuard( SharedGuard && ) noexcept = delete;                                //!< Move constructor (deleted).
+        SharedGuard &operator=( SharedGuard const & ) noexcept = delete;                //!< Copy operator (deleted).
+        SharedGuard &operator=( SharedGuard && ) noexcept = delete;                     //!< Move operator (deleted).
+
+        /** @brief Returns `true` if the lock is held, i.e. it did not time out. */
+        [[nodiscard]]
+        bool owns() const noexcept { return lock_ != nullptr; }
+
+        /** @copydoc owns() */
+        [[nodiscard]]
+        explicit operator bool() const noexcept { return owns(); }
+
+    private:
+
+        SharedLockable *lock_;  //!< The held lock; `nullptr` if not taken.
+    };
+
+} // namespace rtos
@@ -0,0 +1,146 @@
+#pragma once
+
+/* C++ Standard Library */
+#include <array>
+#include <cstddef>
+
+/* Custom Library */
+#include <mutex.hpp>
+
+namespace rtos
+{
+
+    /** @brief Fixed array of locks, one per shard of an index space. */
+    /**
+     * @details
+     * Guards groups of items, e.g. the properties of a `machine::PropertyTable`
+     * by their index, with fewer locks than items. Item `i` belongs to
+     * shard `i % SHARDS`, so neighbouring items, which are often used
+     * together, spread over all shards:
+     *
+     * \code{.cpp}
+     * rtos::ShardedLock<16U> locks;
+     *
+     * rtos::Guard<rtos::Mutex> const guard( locks.forIndex( i ) );
+     * \endcode
+     *
+     * @attention
+     * A task that holds more than one shard must take them in ascending
+     * `shardOf()` order, and each only once, e.g. with `forEachShard()`.
+     *
+     * @tparam N        Number of shards, a power of two.
+     * @tparam Lockable The lock type, e.g. `Mutex` or `RwLock`.
+     *
+     * @note ja: インデックス空間をシャードに分け、シャードごとに1つのロックを持つ配列。
+     */
+    template <std::size_t N, typename Lockable = Mutex>
+    class ShardedLock
+    {
+    /* ^\__________________________________________ */
+    /* #region Static members, Inner types.         */
+
+    public:
+
+        /** @brief Number of shards. */
+        static constexpr std::size_t SHARDS = N;
+
+        static_assert( ( N != 0U ) && ( ( N & ( N - 1U ) ) == 0U ), "N must be a power of two" );
+
+        /** @brief Returns the shard of item `index`. */
+        [[nodiscard]]
+        static constexpr std::size_t shardOf( std::size_t index ) noexcept { return index & ( N - 1U ); }
+
+    /* #endregion */// Static members, Inner types
+
+    /* ^\__________________________________________ */
+    /* #region Constructors.                        */
+
+    public:
+
+        explicit ShardedLock() noexcept = default;                  //!< Default constructor (all unlocked).
+        ~ShardedLock() noexcept = default;                          //!< Destructor (default).
+        ShardedLock( ShardedLock const & ) noexcept = delete;       //!< Copy constructor (deleted).
+        ShardedLock( ShardedLock && ) noexcept = delete;            //!< Move constructor (deleted).
+
+    /* #endregion */// Constructors
+
+    /* ^\__________________________________________ */
+    /* #region Operators.                           */
+
+    public:
+
+        ShardedLock &operator=( ShardedLock const & ) noexcept = delete; //!< Copy operator (deleted).
+        ShardedLock &operator=( ShardedLock && ) noexcept = delete;      //!< Move operator (deleted).
+
+    /* #endregion */// Operators
+
+    /* ^\__________________________________________ */
+    /* #region Instance members.                    */
+
+    public:
+
+        /* #region Public methods */
+
+        /** @brief Returns the lock of the shard of item `index`. */
+        [[nodiscard]]
+        Lockable &forIndex( std::size_t index ) noexcept { return shards_[shardOf( index )]; }
+
+        /** @brief Returns the lock of shard `shard`, less than `SHARDS`. */
+        [[nodiscard]]
+        Lockable &shard( std::size_t shard ) noexcept { return shards_[shard]; }
+
+        /** @brief Calls `f()` with the shards of `indices` locked. */
+        /**
+         * @details
+         * Every shard is taken once, in ascending order, and all are
+         * released when `f()` returns.
+         *
+         * @param indices [in] The items, in any order; repeats are fine.
+         * @param f       [in] Called once, with no arguments.
+         *
+         * @return What `f()` returns.
+         */
+        template <typename Indices, typename F>
+        decltype( auto ) forEachShard( Indices const &indices, F &&f ) noexcept
+        {
+            std::array<bool, N> used {};
+            for ( std::size_t i : indices ) { used[shardOf( i )] = true; }
+
+            for ( std::size_t s = 0U; s < N; s++ )
+            {
+                if ( used[s] ) { shards_[s].lock(); }
+            }
+
+            // Note: Unlocks on every way out of `f()`, including its return value.
+            struct Unlock
+            {
+                ShardedLock &self;
+                std::array<bool, N> const &used;
+
+                ~Unlock() noexcept
+                {
+                    for ( std::size_t s = N; s-- > 0U; )
+                    {
+                        if ( used[s] ) { self.shards_[s].unlock(); }
+                    }
+                }
+            } const unlock { *this, used };
+
+            return f();
+        }
+
+        /* #endregion */// Public methods
+
+    private:
+
+        /* #region Member variables */
+
+        std::array<Lockable, N> shards_;
+
+        /* #endregion */// Member variables
+
+    /* #endregion */// Instance members
+
+    }; // class ShardedLock
+
+} // namespace rtos
@@ -0,0 +1,76 @@
+/* Self */
+#include <rw_lock.hpp>
+
+/* ESP-IDF */
+#include <freertos/task.h>
+
+/* ^\__________________________________________ */
+/* Namespaces.                                  */
+using namespace rtos;
+
+
+/* ^\__________________________________________ */
+/* #region Constructors.                        */
+
+RwLock::RwLock() noexcept
+    : idle_( xSemaphoreCreateBinaryStatic( &idleBuffer_ ) )
+{ /* Do nothing */ }
+
+RwLock::~RwLock() noexcept
+{
+    vSemaphoreDelete( idle_ );
+}
+
+/* #endregion */// Constructors.
+
+
+/* ^\__________________________________________ */
+/* #region Public methods.                      */
+
+bool RwLock::tryLockFor( TickType_t timeout ) noexcept
+{
+    TimeOut_t start;
+    vTaskSetTimeOutState( &start );
+
+    if ( !gate_.tryLockFor( timeout ) ) { return false; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on timeout!! ]
+    // [===> Follows: No reader can register until `unlock()`]
+
+    // Note: Drops a token of a reader that left before; the counter below decides.
+    xSemaphoreTake( idle_, 0U );
+
+    while ( readers_.load( std::memory_order_acquire ) != 0U )
+    {
+        if ( xTaskCheckForTimeOut( &start, &timeout ) != pdFALSE )
+        {
+            gate_.unlock();
+            return false;
+        }
+        // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on timeout!! ]
+
+        xSemaphoreTake( idle_, timeout );
+    }
+
+    return true;
+}
+
+bool RwLock::tryLockSharedFor( TickType_t timeout ) noexcept
+{
+    if ( !gate_.tryLockFor( timeout ) ) { return false; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on timeout!! ]
+
+    readers_.fetch_add( 1U, std::memory_order_acquire );
+    gate_.unlock();
+
+    return true;
+}
+
+void RwLock::unlockShared() noexcept
+{
+    if ( readers_.fetch_sub( 1U, std::memory_order_release ) == 1U )
+    {
+        xSemaphoreGive( idle_ ); // Note: The last reader; wakes a writer waiting at the counter.
+    }
+}
+
+/* #endregion */// Public methods.
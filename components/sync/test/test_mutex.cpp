@@ -0,0 +1,138 @@
+#include <unity.h>
+#include <unity_test_runner.h>
+#include <mutex.hpp>
+#include <sharded_lock.hpp>
+
+#include <array>
+#include <atomic>
+
+#include <freertos/task.h>
+
+using namespace rtos;
+
+
+namespace
+{
+    /** @brief Tries a lock with a timeout from another task. */
+    template <typename Lockable>
+    struct Probe
+    {
+        Lockable *lock;
+        TickType_t timeout;
+        std::atomic<int> result{-1};
+
+        static void entry(void *context)
+        {
+            auto &self = *static_cast<Probe *>(context);
+            Guard<Lockable> const guard(*self.lock, self.timeout);
+            self.result.store(guard.owns() ? 1 : 0);
+            vTaskDelete(nullptr);
+        }
+
+        int run()
+        {
+            TaskHandle_t handle = nullptr;
+            TEST_ASSERT_TRUE(xTaskCreate(&Probe::entry, "probe", 4096, this, 5, &handle) == pdPASS);
+            for (int i = 0; i < 1000 && result.load() < 0; i++) { vTaskDelay(pdMS_TO_TICKS(10)); }
+            return result.load();
+        }
+    };
+
+    /** @brief Increments a plain counter under a lock. */
+    struct Counter
+    {
+        Mutex *lock;
+        int *value;
+        std::atomic<int> *done;
+
+        static void entry(void *context)
+        {
+            auto const &self = *static_cast<Counter *>(context);
+            for (int i = 0; i < 10000; i++)
+            {
+                Guard<Mutex> const guard(*self.lock);
+                *self.value = *self.value + 1;
+            }
+            self.done->fetch_add(1);
+            vTaskDelete(nullptr);
+        }
+    };
+}
+
+TEST_CASE("Mutex excludes other tasks and times out", "[Mutex]")
+{
+    Mutex mutex;
+    {
+        Guard<Mutex> const guard(mutex);
+        TEST_ASSERT_TRUE(guard.owns());
+
+        Probe<Mutex> busy{&mutex, pdMS_TO_TICKS(20)};
+        TEST_ASSERT_EQUAL(0, busy.run());
+    }
+
+    Probe<Mutex> free{&mutex, pdMS_TO_TICKS(20)};
+    TEST_ASSERT_EQUAL(1, free.run());
+
+    TEST_ASSERT_TRUE(mutex.tryLock());
+    mutex.unlock();
+}
+
+TEST_CASE("Mutex guards keep a counter of several tasks consistent", "[Mutex]")
+{
+    Mutex mutex;
+    int value = 0;
+    std::atomic<int> done{0};
+    std::array<Counter, 4> counters{{{&mutex, &value, &done}, {&mutex, &value, &done},
+                                     {&mutex, &value, &done}, {&mutex, &value, &done}}};
+    TaskHandle_t handle = nullptr;
+    for (auto &counter : counters)
+    {
+        TEST_ASSERT_TRUE(xTaskCreate(&Counter::entry, "count", 4096, &counter, 5, &handle) == pdPASS);
+    }
+
+    for (int i = 0; i < 1000 && done.load() < 4; i++) { vTaskDelay(pdMS_TO_TICKS(10)); }
+    TEST_ASSERT_EQUAL(4, done.load());
+    TEST_ASSERT_EQUAL(40000, value);
+}
+
+TEST_CASE("RecursiveMutex can be locked again by its owner", "[Mutex]")
+{
+    RecursiveMutex mutex;
+    mutex.lock();
+    TEST_ASSERT_TRUE(mutex.tryLock());
+
+    Probe<RecursiveMutex> held{&mutex, 0};
+    TEST_ASSERT_EQUAL(0, held.run());
+
+    // Note: Still held after the first unlock.
+    mutex.unlock();
+    Probe<RecursiveMutex> stillHeld{&mutex, 0};
+    TEST_ASSERT_EQUAL(0, stillHeld.run());
+
+    mutex.unlock();
+    Probe<RecursiveMutex> released{&mutex, 0};
+    TEST_ASSERT_EQUAL(1, released.run());
+}
+
+TEST_CASE("ShardedLock takes each shard of a set of indices once", "[Mutex]")
+{
+    ShardedLock<4> locks;
+    TEST_ASSERT_EQUAL(1, ShardedLock<4>::shardOf(5));
+    TEST_ASSERT_TRUE(&locks.forIndex(6) == &locks.shard(2));
+
+    // Note: 1 and 9 share a shard; a non-recursive mutex taken twice would hang.
+    std::array<std::size_t, 3> const indices{9, 2, 1};
+    int const result = locks.forEachShard(indices, [&]() noexcept
+    {
+        Probe<Mutex> held{&locks.shard(1), 0};
+        Probe<Mutex> other{&locks.shard(3), 0};
+        return held.run() * 10 + other.run();
+    });
+    TEST_ASSERT_EQUAL(1, result); // Note: Shard 1 was held, shard 3 was free.
+
+    for (std::size_t s = 0; s < ShardedLock<4>::SHARDS; s++)
+    {
+        TEST_ASSERT_TRUE(locks.shard(s).tryLock());
+        locks.shard(s).unlock();
+    }
+}
@@ -0,0 +1,140 @@
+#include <unity.h>
+#include <unity_test_runner.h>
+#include <rw_lock.hpp>
+
+#include <array>
+#include <atomic>
+
+#include <freertos/task.h>
+
+using namespace rtos;
+
+
+namespace
+{
+    /** @brief Takes the lock exclusively from another task, until told to leave. */
+    struct Writer
+    {
+        RwLock *lock;
+        std::atomic<bool> entered{false};
+        std::atomic<bool> leave{false};
+        std::atomic<bool> done{false};
+
+        static void entry(void *context)
+        {
+            auto &self = *static_cast<Writer *>(context);
+            {
+                Guard<RwLock> const guard(*self.lock);
+                self.entered.store(true);
+                while (!self.leave.load()) { vTaskDelay(pdMS_TO_TICKS(1)); }
+            }
+            self.done.store(true);
+            vTaskDelete(nullptr);
+        }
+    };
+
+    /** @brief Writes a pair, or checks that it is equal. */
+    struct Worker
+    {
+        RwLock *lock;
+        int *a;
+        int *b;
+        bool writes;
+        std::atomic<int> *torn;
+        std::atomic<int> *done;
+
+        static void entry(void *context)
+        {
+            auto const &self = *static_cast<Worker *>(context);
+            for (int i = 0; i < 2000; i++)
+            {
+                if (self.writes)
+                {
+                    Guard<RwLock> const guard(*self.lock);
+                    *self.a = *self.a + 1;
+                    taskYIELD();
+                    *self.b = *self.b + 1;
+                }
+                else
+                {
+                    SharedGuard<RwLock> const guard(*self.lock);
+                    if (*self.a != *self.b) { self.torn->fetch_add(1); }
+                }
+            }
+            self.done->fetch_add(1);
+            vTaskDelete(nullptr);
+        }
+    };
+
+    template <typename Predicate>
+    bool waitFor(Predicate predicate)
+    {
+        for (int i = 0; i < 1000 && !predicate(); i++) { vTaskDelay(pdMS_TO_TICKS(10)); }
+        return predicate();
+    }
+}
+
+TEST_CASE("RwLock is shared by readers and exclusive for writers", "[RwLock]")
+{
+    RwLock lock;
+
+    TEST_ASSERT_TRUE(lock.tryLockShared());
+    TEST_ASSERT_TRUE(lock.tryLockShared()); // Note: No writer waits, so a second reader may enter.
+    TEST_ASSERT_FALSE(lock.tryLock());
+    TEST_ASSERT_FALSE(lock.tryLockFor(pdMS_TO_TICKS(20)));
+    lock.unlockShared();
+    TEST_ASSERT_FALSE(lock.tryLock());
+    lock.unlockShared();
+
+    TEST_ASSERT_TRUE(lock.tryLock());
+    TEST_ASSERT_FALSE(lock.tryLockShared());
+    {
+        SharedGuard<RwLock> const reading(lock, pdMS_TO_TICKS(20));
+        TEST_ASSERT_FALSE(reading.owns());
+    }
+    lock.unlock();
+
+    SharedGuard<RwLock> const reading(lock, 0);
+    TEST_ASSERT_TRUE(reading.owns());
+}
+
+TEST_CASE("RwLock writer waits for readers and holds off new ones", "[RwLock]")
+{
+    RwLock lock;
+    lock.lockShared();
+
+    Writer writer{&lock};
+    TaskHandle_t handle = nullptr;
+    TEST_ASSERT_TRUE(xTaskCreate(&Writer::entry, "writer", 4096, &writer, 5, &handle) == pdPASS);
+
+    vTaskDelay(pdMS_TO_TICKS(30));
+    TEST_ASSERT_FALSE(writer.entered.load());
+    TEST_ASSERT_FALSE(lock.tryLockSharedFor(pdMS_TO_TICKS(10))); // Note: The waiting writer holds the gate.
+
+    lock.unlockShared();
+    TEST_ASSERT_TRUE(waitFor([&] { return writer.entered.load(); }));
+
+    writer.leave.store(true);
+    TEST_ASSERT_TRUE(waitFor([&] { return writer.done.load(); }));
+    TEST_ASSERT_TRUE(lock.tryLockShared());
+    lock.unlockShared();
+}
+
+TEST_CASE("RwLock readers never see a half-written pair", "[RwLock]")
+{
+    RwLock lock;
+    int a = 0, b = 0;
+    std::atomic<int> torn{0}, done{0};
+    std::array<Worker, 4> workers{{{&lock, &a, &b, true, &torn, &done}, {&lock, &a, &b, false, &torn, &done},
+                                   {&lock, &a, &b, true, &torn, &done}, {&lock, &a, &b, false, &torn, &done}}};
+    TaskHandle_t handle = nullptr;
+    for (auto &worker : workers)
+    {
+        TEST_ASSERT_TRUE(xTaskCreate(&Worker::entry, "worker", 4096, &worker, 5, &handle) == pdPASS);
+    }
+
+    TEST_ASSERT_TRUE(waitFor([&] { return done.load() == 4; }));
+    TEST_ASSERT_EQUAL(0, torn.load());
+    TEST_ASSERT_EQUAL(4000, a);
+    TEST_ASSERT_EQUAL(4000, b);
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <format>
+#include <span>
+#include <string_view>
+#include <utility>
+
+namespace util {
+
+    /** @brief Format into a caller-supplied buffer without heap allocation. */
+    /**
+     * @tparam Args Types of the arguments to be formatted.
+     * @param buf Destination buffer. One byte is reserved for the terminator.
+     * @param fmt Format string, checked at compile time.
+     * @param args Arguments to be formatted.
+     * @return View of the formatted text within `buf`.
+     * @details
+     * Thin wrapper around `std::format_to_n()` writing to a `char` buffer,
+     * typically a `std::array<char, N>` on the stack. Output that does not fit
+     * is truncated. The result is always NUL-terminated, so `.data()` can be
+     * passed straight to `ESP_LOGx()` / `printf()` style APIs.
+     * @note An empty `buf` yields an empty view and nothing is written.
+     */
+    template <typename... Args>
+    std::string_view formatTo(std::span<char> buf, std::format_string<Args...> fmt, Args &&...args) noexcept {
+        if (buf.empty()) {
+            return {};
+        }
+
+        auto const result = std::format_to_n(buf.data(), buf.size() - 1U, fmt, std::forward<Args>(args)...);
+        *result.out = '\0';
+
+        return std::string_view(buf.data(), result.out);
+    }
+
+} // namespace util
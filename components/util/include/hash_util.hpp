@@ -1,7 +1,10 @@
 #pragma once
 
+#include <bit>
 #include <cstddef>
 #include <cstdint>
+#include <span>
+#include <type_traits>
 
 namespace util {
     namespace detail {
@@ -41,8 +44,69 @@ namespace util {
             ((seed = combinePair(seed, values)), ...);
             return seed;
         }
+
+        /** @brief Multipliers of MurmurHash3 (32-bit). */
+        constexpr std::uint32_t MURMUR3_C1 = 0xcc9e2d51U;
+        constexpr std::uint32_t MURMUR3_C2 = 0x1b873593U;
+
+        /** @brief Scrambles one 32-bit block before it is mixed into the hash. */
+        constexpr std::uint32_t scrambleBlock(std::uint32_t k) noexcept {
+            return std::rotl(k * MURMUR3_C1, 15) * MURMUR3_C2;
+        }
+
+        /** @brief Final avalanche of MurmurHash3 (32-bit). */
+        constexpr std::uint32_t finalizeHash(std::uint32_t h) noexcept {
+            h ^= h >> 16;
+            h *= 0x85ebca6bU;
+            h ^= h >> 13;
+            h *= 0xc2b2ae35U;
+            h ^= h >> 16;
+            return h;
+        }
     } // namespace util::detail
 
+    /** @brief Hash a byte payload. */
+    /**
+     * @param bytes Payload to be hashed.
+     * @param seed Initial hash value; hashes with different seeds are unrelated.
+     * @return 32-bit hash value.
+     * @details
+     * MurmurHash3 (x86, 32-bit): the payload is consumed 4 bytes at a time
+     * as little-endian words, which the compiler turns into single loads,
+     * and the 0-3 trailing bytes are mixed in last. No memory is allocated
+     * and the payload needs no alignment.
+     * Equal payloads always have equal hashes, whatever holds them, so a
+     * `Value255`, its bytes and a `std::string_view` of them hash alike.
+     */
+    constexpr std::uint32_t hashBytes(std::span<std::byte const> bytes, std::uint32_t seed = 0U) noexcept {
+        std::uint32_t h = seed;
+        std::size_t const blocks = bytes.size() / 4U;
+
+        for (std::size_t i = 0; i < blocks; i++) {
+            std::byte const *p = bytes.data() + i * 4U;
+            std::uint32_t const k = std::to_integer<std::uint32_t>(p[0])
+                                  | (std::to_integer<std::uint32_t>(p[1]) << 8)
+                                  | (std::to_integer<std::uint32_t>(p[2]) << 16)
+                                  | (std::to_integer<std::uint32_t>(p[3]) << 24);
+
+            h ^= detail::scrambleBlock(k);
+            h = std::rotl(h, 13) * 5U + 0xe6546b64U;
+        }
+
+        std::byte const *tail = bytes.data() + blocks * 4U;
+        std::uint32_t k = 0U;
+        switch (bytes.size() & 3U) {
+            case 3: k ^= std::to_integer<std::uint32_t>(tail[2]) << 16; [[fallthrough]];
+            case 2: k ^= std::to_integer<std::uint32_t>(tail[1]) << 8;  [[fallthrough]];
+            case 1: k ^= std::to_integer<std::uint32_t>(tail[0]);
+                    h ^= detail::scrambleBlock(k);
+                    break;
+            default: break;
+        }
+
+        return detail::finalizeHash(h ^ static_cast<std::uint32_t>(bytes.size()));
+    }
+
     /** @brief Combine multiple hash values into a single hash value. */
     /**
      * @tparam Ts Types of the values to be hashed.
@@ -1,22 +1,159 @@
 #pragma once
 
-#include <cstdint>
 #include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
 
 namespace util {
-    static constexpr int32_t toInt32LE(const std::array<std::byte, 3>& arr) {
-        uint32_t value = toUInt32LE(arr);
+    namespace detail {
+        /** @brief Largest integer size handled by the little-endian decoders. */
+        constexpr std::size_t MAX_LE_SIZE = sizeof(std::uint32_t);
+
+        /** @brief Assembles `N` little-endian bytes into the low bytes of a word. */
+        /**
+         * @tparam N Number of bytes, 1 to 4.
+         * @param p First byte; `p[0]` to `p[N - 1]` must be readable.
+         * @return The bytes as an unsigned value; the upper bytes are 0.
+         * @details
+         * The shifts are fixed at compile time, so this compiles to a single
+         * load (plus a zero extension) on little-endian targets.
+         */
+        template <std::size_t N>
+        constexpr std::uint32_t loadLE(std::byte const *p) noexcept {
+            static_assert(N >= 1U && N <= MAX_LE_SIZE, "loadLE: 1 to 4 bytes");
+
+            std::uint32_t value = 0U;
+            for (std::size_t i = 0; i < N; i++) {
+                value |= std::to_integer<std::uint32_t>(p[i]) << (8U * i);
+            }
+            return value;
+        }
+
+        /** @brief Sign-extends the low `bits` bits of a word. */
+        /**
+         * @param value Word whose upper `32 - bits` bits are ignored.
+         * @param bits Width of the value, 8 to 32.
+         * @return The value as a signed integer.
+         * @details
+         * Shifts the sign bit to bit 31 and back with an arithmetic shift,
+         * which is well defined since C++20; no branch on the sign.
+         */
+        constexpr std::int32_t signExtend(std::uint32_t value, std::uint32_t bits) noexcept {
+            std::uint32_t const shift = 32U - bits;
+            return static_cast<std::int32_t>(value << shift) >> shift;
+        }
+    } // namespace util::detail
+
+    /** @brief Decode an unsigned little-endian integer of a fixed size. */
+    /**
+     * @tparam N Size of the integer, 1 to 4 bytes.
+     * @param bytes The encoded integer.
+     * @return The decoded value.
+     */
+    template <std::size_t N>
+        requires (N >= 1U && N <= detail::MAX_LE_SIZE)
+    constexpr std::uint32_t toUInt32LE(std::span<std::byte const, N> bytes) noexcept {
+        return detail::loadLE<N>(bytes.data());
+    }
+
+    /** @brief Decode a signed (two's complement) little-endian integer of a fixed size. */
+    /**
+     * @tparam N Size of the integer, 1 to 4 bytes.
+     * @param bytes The encoded integer.
+     * @return The decoded value, sign-extended from `8 * N` bits.
+     */
+    template <std::size_t N>
+        requires (N >= 1U && N <= detail::MAX_LE_SIZE)
+    constexpr std::int32_t toInt32LE(std::span<std::byte const, N> bytes) noexcept {
+        return detail::signExtend(detail::loadLE<N>(bytes.data()), 8U * N);
+    }
+
+    /** @brief Decode an unsigned little-endian integer of 1 to 4 bytes. */
+    /**
+     * @param bytes The encoded integer.
+     * @return The decoded value; 0 if `bytes` is empty or longer than 4 bytes.
+     * @details
+     * The size is only checked once. All four byte positions are then read
+     * at an index clamped to the last byte and masked off beyond the size,
+     * so the result needs no branch per size and never reads past `bytes`.
+     */
+    constexpr std::uint32_t toUInt32LE(std::span<std::byte const> bytes) noexcept {
+        std::size_t const size = bytes.size();
+        if (size == 0U || size > detail::MAX_LE_SIZE) {
+            return 0U;
+        }
 
-        // Expand 24bit sign extension
-        if (value & 0x00800000) { // Negative 24th bit is 1, indicating a negative number
-            value |= 0xFF000000;  // Fill the upper 8 bits with 1s
+        std::size_t const last = size - 1U;
+        std::uint32_t value = 0U;
+        for (std::size_t i = 0; i < detail::MAX_LE_SIZE; i++) {
+            std::uint32_t const keep = 0U - static_cast<std::uint32_t>(i < size);
+            std::uint32_t const byte = std::to_integer<std::uint32_t>(bytes[i < last ? i : last]);
+            value |= (byte & keep) << (8U * i);
         }
-        return static_cast<int32_t>(value);
+        return value;
     }
-    static constexpr uint32_t toUInt32LE(const std::array<std::byte, 3>& arr) {
-        return
-            (static_cast<uint32_t>(arr[0])      ) |
-            (static_cast<uint32_t>(arr[1]) <<  8) |
-            (static_cast<uint32_t>(arr[2]) << 16);
+
+    /** @brief Decode a signed (two's complement) little-endian integer of 1 to 4 bytes. */
+    /**
+     * @param bytes The encoded integer.
+     * @return The decoded value, sign-extended from `8 * bytes.size()` bits;
+     *         0 if `bytes` is empty or longer than 4 bytes.
+     * @details
+     * A 1-byte `0xFF` is -1, a 1-byte `0x7F` is 127.
+     */
+    constexpr std::int32_t toInt32LE(std::span<std::byte const> bytes) noexcept {
+        std::size_t const size = bytes.size();
+        if (size == 0U || size > detail::MAX_LE_SIZE) {
+            return 0;
+        }
+        return detail::signExtend(toUInt32LE(bytes), static_cast<std::uint32_t>(8U * size));
+    }
+
+    /** @brief Decode packed unsigned little-endian integers of `N` bytes each. */
+    /**
+     * @tparam N Size of each integer, 1 to 4 bytes.
+     * @param packed The integers, one after another.
+     * @param out Receives the decoded values.
+     * @return Number of decoded values: the whole integers in `packed`, at most `out.size()`.
+     * @details
+     * The loop has a fixed stride and no data-dependent branch, so the
+     * compiler can unroll or vectorize it.
+     */
+    template <std::size_t N>
+        requires (N >= 1U && N <= detail::MAX_LE_SIZE)
+    constexpr std::size_t toUInt32LE(std::span<std::byte const> packed, std::span<std::uint32_t> out) noexcept {
+        std::size_t const count = (packed.size() / N < out.size()) ? packed.size() / N : out.size();
+        for (std::size_t i = 0; i < count; i++) {
+            out[i] = detail::loadLE<N>(packed.data() + i * N);
+        }
+        return count;
+    }
+
+    /** @brief Decode packed signed (two's complement) little-endian integers of `N` bytes each. */
+    /**
+     * @tparam N Size of each integer, 1 to 4 bytes.
+     * @param packed The integers, one after another.
+     * @param out Receives the decoded values, sign-extended from `8 * N` bits.
+     * @return Number of decoded values: the whole integers in `packed`, at most `out.size()`.
+     */
+    template <std::size_t N>
+        requires (N >= 1U && N <= detail::MAX_LE_SIZE)
+    constexpr std::size_t toInt32LE(std::span<std::byte const> packed, std::span<std::int32_t> out) noexcept {
+        std::size_t const count = (packed.size() / N < out.size()) ? packed.size() / N : out.size();
+        for (std::size_t i = 0; i < count; i++) {
+            out[i] = detail::signExtend(detail::loadLE<N>(packed.data() + i * N), 8U * N);
+        }
+        return count;
+    }
+
+    /** @brief Decode an unsigned 3-byte little-endian integer. */
+    constexpr std::uint32_t toUInt32LE(const std::array<std::byte, 3>& arr) noexcept {
+        return toUInt32LE(std::span<std::byte const, 3>(arr));
+    }
+
+    /** @brief Decode a signed 3-byte little-endian integer, sign-extended from 24 bits. */
+    constexpr std::int32_t toInt32LE(const std::array<std::byte, 3>& arr) noexcept {
+        return toInt32LE(std::span<std::byte const, 3>(arr));
     }
 } // namespace util
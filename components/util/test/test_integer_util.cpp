@@ -0,0 +1,66 @@
+#include <unity.h>
+#include <unity_test_runner.h>
+#include <integer_util.hpp>
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+
+namespace
+{
+    constexpr std::array<std::byte, 4> MINUS_ONE = {std::byte{0xFF}, std::byte{0xFF}, std::byte{0xFF}, std::byte{0xFF}};
+    constexpr std::array<std::byte, 4> MIXED = {std::byte{0x80}, std::byte{0x01}, std::byte{0x7F}, std::byte{0x80}};
+
+    static_assert(util::toInt32LE(std::span<std::byte const, 1>(MINUS_ONE.data(), 1)) == -1);
+    static_assert(util::toUInt32LE(std::span<std::byte const, 1>(MINUS_ONE.data(), 1)) == 0xFFU);
+    static_assert(util::toInt32LE(std::span<std::byte const, 2>(MIXED.data(), 2)) == 0x0180);
+    static_assert(util::toInt32LE(std::span<std::byte const, 3>(MIXED.data() + 1, 3)) == -0x7F80FF);
+    static_assert(util::toInt32LE(std::span<std::byte const, 4>(MIXED)) == static_cast<std::int32_t>(0x807F0180U));
+    static_assert(util::toInt32LE(std::array<std::byte, 3>{std::byte{0x00}, std::byte{0x00}, std::byte{0x80}}) == -0x800000);
+}
+
+TEST_CASE("Little-endian decoders sign-extend by size", "[integer_util]")
+{
+    std::span<std::byte const> const bytes(MIXED);
+
+    TEST_ASSERT_EQUAL_INT32(-128, util::toInt32LE(bytes.first(1)));
+    TEST_ASSERT_EQUAL_UINT32(0x80U, util::toUInt32LE(bytes.first(1)));
+    TEST_ASSERT_EQUAL_INT32(0x0180, util::toInt32LE(bytes.first(2)));
+    TEST_ASSERT_EQUAL_INT32(0x7F0180, util::toInt32LE(bytes.first(3)));
+    TEST_ASSERT_EQUAL_UINT32(0x807F0180U, util::toUInt32LE(bytes));
+    TEST_ASSERT_EQUAL_INT32(static_cast<std::int32_t>(0x807F0180U), util::toInt32LE(bytes));
+    TEST_ASSERT_EQUAL_INT32(-1, util::toInt32LE(std::span<std::byte const>(MINUS_ONE).first(3)));
+
+    // Note: Masked positions never leak into the result.
+    TEST_ASSERT_EQUAL_UINT32(0x7FU, util::toUInt32LE(bytes.subspan(2, 1)));
+
+    // Note: Empty and oversized payloads decode to 0.
+    std::array<std::byte, 5> const five{std::byte{1}, std::byte{2}, std::byte{3}, std::byte{4}, std::byte{5}};
+    TEST_ASSERT_EQUAL_INT32(0, util::toInt32LE(std::span<std::byte const>()));
+    TEST_ASSERT_EQUAL_UINT32(0U, util::toUInt32LE(std::span<std::byte const>(five)));
+}
+
+TEST_CASE("Little-endian batch decoders", "[integer_util]")
+{
+    // Note: Three 2-byte integers and one trailing byte.
+    std::array<std::byte, 7> const packed{std::byte{0xFF}, std::byte{0xFF}, std::byte{0x01}, std::byte{0x00},
+                                          std::byte{0x00}, std::byte{0x80}, std::byte{0x42}};
+
+    std::array<std::int32_t, 4> signedOut{};
+    TEST_ASSERT_EQUAL(3, util::toInt32LE<2>(packed, signedOut));
+    TEST_ASSERT_EQUAL_INT32(-1, signedOut[0]);
+    TEST_ASSERT_EQUAL_INT32(1, signedOut[1]);
+    TEST_ASSERT_EQUAL_INT32(-32768, signedOut[2]);
+    TEST_ASSERT_EQUAL_INT32(0, signedOut[3]);
+
+    std::array<std::uint32_t, 2> unsignedOut{};
+    TEST_ASSERT_EQUAL(2, util::toUInt32LE<2>(packed, unsignedOut)); // Note: Limited by `out`.
+    TEST_ASSERT_EQUAL_UINT32(0xFFFFU, unsignedOut[0]);
+    TEST_ASSERT_EQUAL_UINT32(1U, unsignedOut[1]);
+
+    std::array<std::int32_t, 8> bytesOut{};
+    TEST_ASSERT_EQUAL(7, util::toInt32LE<1>(packed, bytesOut));
+    TEST_ASSERT_EQUAL_INT32(-128, bytesOut[5]);
+    TEST_ASSERT_EQUAL_INT32(0x42, bytesOut[6]);
+}
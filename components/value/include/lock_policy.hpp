@@ -0,0 +1,301 @@
+#pragma once
+
+/* C++ Standard Library */
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+/* Custom Library */
+#include <value_stats.hpp>
+
+/* ESP-IDF */
+#include <sdkconfig.h>
+#if CONFIG_IDF_TARGET_LINUX
+#include <thread>
+#else
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+/**
+ * @namespace value::lock
+ * @brief Locking policies for `value::BasicValue255`.
+ *
+ * @details
+ * A locking policy is a stateless type that provides the following members:
+ *
+ * - `State`: per-instance lock state, at most 1 byte.
+ * - `OPTIMISTIC_READ`: `true` if readers use `beginRead()` / `validateRead()`
+ *   instead of taking the lock.
+ * - `HEAP_PAYLOAD`: `false` if the lock may not call `PayloadAllocator`, so
+ *   payloads larger than the inline buffer are rejected.
+ * - `static void lock( State & )` / `static void unlock( State & )`:
+ *   exclusive access, used by writers (and by readers unless
+ *   `OPTIMISTIC_READ` is `true`).
+ * - `static std::uint8_t beginRead( State & )` /
+ *   `static bool validateRead( State &, std::uint8_t )`:
+ *   only required if `OPTIMISTIC_READ` is `true`.
+ *
+ * Every policy uses exactly 1 byte of state, so `sizeof(BasicValue255)` and
+ * therefore the layouts of `Spec` and `Property` do not depend on the policy.
+ */
+namespace value::lock
+{
+
+#if !CONFIG_IDF_TARGET_LINUX
+
+    namespace detail
+    {
+        /** @brief Nesting depth of `CriticalSection`; `Backoff` never blocks while it is held. */
+        inline std::atomic<std::uint8_t> criticalDepth{ 0U };
+    }
+
+#endif
+
+    /** @brief Exponential backoff for the busy loops of the policies. */
+    /**
+     * @details
+     * Each `pause()` idles for twice as many CPU relax hints as the one before,
+     * up to `MAX_BACKOFF`, so contending tasks stop hammering the lock byte.
+     * After `SPINS_BEFORE_YIELD` pauses the owner is assumed to be preempted,
+     * and every further `pause()` gives the CPU away instead.
+     *
+     * @note ja: ビジーループ用の指数バックオフ。一定回数後は CPU を譲る。
+     */
+    class Backoff
+    {
+    public:
+
+        static constexpr std::uint32_t SPINS_BEFORE_YIELD = CONFIG_VALUE255_LOCK_SPINS_BEFORE_YIELD;
+        static constexpr std::uint32_t MAX_BACKOFF = CONFIG_VALUE255_LOCK_MAX_BACKOFF;
+
+        void pause() noexcept
+        {
+            if ( spins_++ < SPINS_BEFORE_YIELD )
+            {
+                for ( std::uint32_t i = 0U; i < delay_; i++ ) { relax(); }
+                delay_ = std::min( delay_ * 2U, MAX_BACKOFF );
+                return;
+            }
+            // [===> Follows: The owner is likely preempted]
+
+            yield();
+        }
+
+        /** @brief Returns the number of `pause()` calls. */
+        [[nodiscard]]
+        std::uint32_t spins() const noexcept { return spins_; }
+
+    private:
+
+        static void relax() noexcept
+        {
+#if defined( __x86_64__ ) || defined( __i386__ )
+            __builtin_ia32_pause();
+#else
+            __asm__ __volatile__( "nop" );
+#endif
+        }
+
+        static void yield() noexcept
+        {
+#if CONFIG_IDF_TARGET_LINUX
+            std::this_thread::yield();
+#else
+            // Note: `taskYIELD()` only switches to tasks of the same or a higher priority;
+            //       a delay of one tick also lets a lower-priority owner run.
+            //       Never block where the scheduler cannot switch, including inside a `CriticalSection`.
+            if ( xPortInIsrContext()
+              || ( detail::criticalDepth.load( std::memory_order_relaxed ) != 0U )
+              || ( xTaskGetSchedulerState() != taskSCHEDULER_RUNNING ) ) { return; }
+            vTaskDelay( 1 );
+#endif
+        }
+
+        std::uint32_t spins_ = 0U;
+        std::uint32_t delay_ = 1U;
+    };
+
+    /** @brief Per-instance `atomic<bool>` spinlock. */
+    /**
+     * @details
+     * Every access, including reads, takes the lock.
+     * Concurrent readers serialize on each other.
+     * Waiters spin on a plain load (test-and-test-and-set) with `Backoff`.
+     */
+    struct SpinLock
+    {
+        using State = std::atomic<bool>; //!< false=unlocked, true=locked.
+
+        static constexpr bool OPTIMISTIC_READ = false;
+        static constexpr bool HEAP_PAYLOAD = true;
+
+        static void lock( State &s ) noexcept
+        {
+            Backoff backoff;
+
+            while( s.exchange( true, std::memory_order_acquire ) )
+            {
+                // Note: Wait on a load; only retry the store once the lock looks free.
+                do { backoff.pause(); } while( s.load( std::memory_order_relaxed ) );
+            }
+
+            Stats::onAcquire( backoff.spins() );
+        }
+
+        static void unlock( State &s ) noexcept
+        {
+            s.store( false, std::memory_order_release );
+        }
+    };
+
+    /** @brief Per-instance 8-bit sequence lock. */
+    /**
+     * @details
+     * The state is a sequence counter; it is odd while a writer is active.
+     * Only writers take exclusive access. Readers read optimistically and
+     * retry when a writer intervened, so they never wait for each other.
+     *
+     * @attention
+     * - Readers still wait while a writer is active.
+     * - A reader may observe a heap payload that is concurrently released.
+     *   The read is discarded and retried, but the memory must stay readable,
+     *   which holds for the ESP32 heap and for `PoolAllocator` slots.
+     * - The counter is 8 bits wide; a reader preempted for exactly a multiple
+     *   of 128 writes could accept a torn read. This is the price of keeping
+     *   the 6-byte footprint.
+     */
+    struct SeqLock
+    {
+        using State = std::atomic<std::uint8_t>; //!< even=idle, odd=writing.
+
+        static constexpr bool OPTIMISTIC_READ = true;
+        static constexpr bool HEAP_PAYLOAD = true;
+
+        static void lock( State &s ) noexcept
+        {
+            // Note: Wait for an even (idle) counter, then make it odd.
+            std::uint8_t seq = s.load( std::memory_order_relaxed );
+            Backoff backoff;
+
+            while( ( seq & 1U ) ||
+                   !s.compare_exchange_weak( seq, seq + 1U
+                                           , std::memory_order_acquire
+                                           , std::memory_order_relaxed ) )
+            {
+                backoff.pause();
+                seq = s.load( std::memory_order_relaxed );
+            }
+
+            Stats::onAcquire( backoff.spins() );
+
+            // Note: Order the odd counter before any payload store.
+            std::atomic_thread_fence( std::memory_order_release );
+        }
+
+        static void unlock( State &s ) noexcept
+        {
+            s.fetch_add( 1U, std::memory_order_release );
+        }
+
+        static std::uint8_t beginRead( State &s ) noexcept
+        {
+            std::uint8_t seq = s.load( std::memory_order_acquire );
+            Backoff backoff;
+
+            while( seq & 1U )
+            {
+                backoff.pause();
+                seq = s.load( std::memory_order_acquire );
+            }
+
+            Stats::onAcquire( backoff.spins() );
+
+            return seq;
+        }
+
+        static bool validateRead( State &s, std::uint8_t seq ) noexcept
+        {
+            std::atomic_thread_fence( std::memory_order_acquire );
+            return s.load( std::memory_order_relaxed ) == seq;
+        }
+    };
+
+    /** @brief No locking, for data owned by a single task. */
+    /**
+     * @details
+     * All lock operations are empty, so every access compiles down to plain
+     * loads, stores and `memcpy`s.
+     *
+     * @attention
+     * The caller must guarantee that an instance is never accessed by more
+     * than one task at a time.
+     */
+    struct NoLock
+    {
+        using State = std::uint8_t; //!< Unused; keeps the footprint of the locked policies.
+
+        static constexpr bool OPTIMISTIC_READ = false;
+        static constexpr bool HEAP_PAYLOAD = true;
+
+        static void lock( State & ) noexcept { /* Do nothing */ }
+
+        static void unlock( State & ) noexcept { /* Do nothing */ }
+    };
+
+#if !CONFIG_IDF_TARGET_LINUX
+
+    /** @brief ISR-safe critical section shared by all instances. */
+    /**
+     * @details
+     * Enters a critical section with `portENTER_CRITICAL_SAFE()`, so values
+     * may be accessed from both tasks and ISRs.
+     * A single `portMUX_TYPE` is shared by all instances, because one per
+     * instance would add 8 bytes to every value.
+     *
+     * @attention
+     * - Interrupts are masked while the lock is held; keep accesses short.
+     * - Payloads are inline only; a larger `set()` fails with
+     *   `SetResult::OutOfMemory`. Freeing or allocating a heap payload would
+     *   spin on the `PayloadAllocator` lock, or enter the heap, with
+     *   interrupts masked, and on a single core the task holding that lock
+     *   could never run again.
+     */
+    struct CriticalSection
+    {
+        using State = std::uint8_t; //!< Unused; the spinlock is shared.
+
+        static constexpr bool OPTIMISTIC_READ = false;
+        static constexpr bool HEAP_PAYLOAD = false;
+
+        static void lock( State & ) noexcept
+        {
+            portENTER_CRITICAL_SAFE( &mux_ );
+            detail::criticalDepth.fetch_add( 1U, std::memory_order_relaxed );
+        }
+
+        static void unlock( State & ) noexcept
+        {
+            detail::criticalDepth.fetch_sub( 1U, std::memory_order_relaxed );
+            portEXIT_CRITICAL_SAFE( &mux_ );
+        }
+
+    private:
+
+        static inline portMUX_TYPE mux_ = portMUX_INITIALIZER_UNLOCKED;
+    };
+
+#endif
+
+    /** @brief The locking policy of `value::Value255`, selected by Kconfig. */
+#if CONFIG_VALUE255_LOCK_SEQLOCK
+    using Default = SeqLock;
+#elif CONFIG_VALUE255_LOCK_NONE
+    using Default = NoLock;
+#elif CONFIG_VALUE255_LOCK_CRITICAL
+    using Default = CriticalSection;
+#else
+    using Default = SpinLock;
+#endif
+
+} // namespace value::lock
@@ -0,0 +1,107 @@
+#pragma once
+
+/* C++ Standard Library */
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/* ESP-IDF */
+#include <sdkconfig.h>
+
+namespace value
+{
+    /** @brief Allocates `Value255` payloads directly from the system heap. */
+    /**
+     * @details
+     * Every allocation is a separate `heap_caps_malloc()` call.
+     *
+     * @par Allocator interface
+     * An allocator for `Value255` payloads provides the following static methods:
+     * - `void *allocate( std::uint8_t size )`: returns `nullptr` on failure.
+     * - `void deallocate( void *p, std::uint8_t size )`: `size` is the size
+     *   of the value currently stored in `p`.
+     * - `bool canReuse( std::uint8_t current, std::uint8_t requested )`:
+     *   returns `true` if a block holding `current` bytes may be reused
+     *   in place for `requested` bytes.
+     */
+    struct HeapAllocator
+    {
+        [[nodiscard]]
+        static void *allocate( std::uint8_t size ) noexcept;
+
+        static void deallocate( void *p, std::uint8_t size ) noexcept;
+
+        [[nodiscard]]
+        static constexpr bool canReuse( std::uint8_t current
+                                      , std::uint8_t requested ) noexcept
+        {
+            return requested <= current;
+        }
+    };
+
+    /** @brief Allocates `Value255` payloads from fixed size-class slabs. */
+    /**
+     * @details
+     * Each size class keeps a free list of equally sized slots.
+     * When a class runs empty, a slab of `CONFIG_VALUE255_POOL_SLOTS_PER_SLAB`
+     * slots is allocated with the heap capabilities selected by
+     * `CONFIG_VALUE255_POOL_REGION`. Slabs are never returned to the system
+     * heap, so the heap is not fragmented by payload churn.
+     *
+     * | Class | Slot size | Payload sizes |
+     * | ----- | --------: | ------------- |
+     * | 0     |       8 B | 5 - 8 B       |
+     * | 1     |      16 B | 9 - 16 B      |
+     * | 2     |      32 B | 17 - 32 B     |
+     * | 3     |      64 B | 33 - 64 B     |
+     * | 4     |     128 B | 65 - 128 B    |
+     * | 5     |     256 B | 129 - 255 B   |
+     *
+     * @par Thread Safety
+     * Each size class is protected by its own spinlock, which waits with
+     * `lock::Backoff` and is only held to pop or push slots; slabs
+     * are allocated with the lock released.
+     *
+     * @see HeapAllocator for the allocator interface.
+     */
+    struct PoolAllocator
+    {
+        /** @brief Slot size of each size class in bytes. */
+        static constexpr std::array<std::uint16_t, 6U> CLASS_SIZES =
+        {
+            8U, 16U, 32U, 64U, 128U, 256U,
+        };
+
+        /** @brief Returns the index of the size class that holds `size` bytes. */
+        [[nodiscard]]
+        static constexpr std::uint8_t classOf( std::uint8_t size ) noexcept
+        {
+            std::uint8_t idx = 0U;
+
+            while ( CLASS_SIZES[idx] < size ) { idx++; }
+
+            return idx;
+        }
+
+        [[nodiscard]]
+        static void *allocate( std::uint8_t size ) noexcept;
+
+        static void deallocate( void *p, std::uint8_t size ) noexcept;
+
+        [[nodiscard]]
+        static constexpr bool canReuse( std::uint8_t current
+                                      , std::uint8_t requested ) noexcept
+        {
+            // Note: The slot must be released to the class it came from.
+            return classOf( current ) == classOf( requested );
+        }
+    };
+
+    /** @brief The allocator used by `Value255`, selected by Kconfig. */
+#if CONFIG_VALUE255_POOL_ENABLE
+    using PayloadAllocator = PoolAllocator;
+#else
+    using PayloadAllocator = HeapAllocator;
+#endif
+
+} // namespace value
@@ -1,39 +1,93 @@
 #pragma once
 
 /* C++ Standard Library */
+#include <algorithm>
 #include <atomic>
 #include <compare>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <optional>
 #include <ostream>
+#include <span>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+/* Custom Library */
+#include <hash_util.hpp>
+#include <lock_policy.hpp>
+
 namespace value
 {
+    /** @brief Result of `BasicMutableValue255::setEx()`. */
+    enum class SetResult : std::uint8_t
+    {
+        Success = 0,
+        NoChange = 1,
+        IllegalArgument = 2,
+        OutOfMemory = 3,
+    };
+
     /** @brief Represents an opaque value with dynamic storage up to 255 bytes. */
     /**
     * @details
     * This class manages an opaque value that may be stored either inline
-    * (4 bytes) or on the heap (for larger sizes). It provides mechanisms for
+    * (up to `InlineSize` bytes) or on the heap (for larger sizes). It provides mechanisms for
     * constructing, moving, comparing, and streaming member values.
     * Instances are movable but not copyable.
     *
+    * Heap payloads are obtained from `PayloadAllocator`, which is either the
+    * system heap or size-class pools (see `CONFIG_VALUE255_POOL_ENABLE`).
+    *
     * For external users, this class behaves as an immutable value type.
     * Mutation is only permitted through the derived `MutableValue255`.
     *
     * Critical sections are intentionally kept short; a spinlock is chosen
-    * to minimize memory footprint and locking overhead.
+    * by default to minimize memory footprint and locking overhead.
     *
     * The class supports equality comparison, ordering comparison,
     * and stream output via `operator<<`.
     *
     * @par Thread Safety
-    * All **public methods** of this class acquire an `atomic<bool>`-based
-    * spinlock to ensure thread safety.
-    * Locking is performed per instance and held for the entire duration
-    * of each public method.
+    * Synchronization is delegated to `LockPolicy` (see `value::lock`):
+    *
+    * | Policy                  | Readers                  | Writers            |
+    * | ----------------------- | ------------------------ | ------------------ |
+    * | `lock::SpinLock`        | per-instance spinlock    | same               |
+    * | `lock::SeqLock`         | optimistic, retry        | per-instance lock  |
+    * | `lock::NoLock`          | none (single owner)      | none               |
+    * | `lock::CriticalSection` | shared ISR-safe section  | same               |
+    *
+    * Under `lock::CriticalSection` payloads never leave the inline buffer,
+    * see its `@attention`.
+    *
+    * Unless the policy reads optimistically, all **public methods** take the
+    * lock for their entire duration. Writers (`BasicMutableValue255::set()`
+    * / `setEx()`, moves and `view()`) always take exclusive access.
+    * `value::Value255` uses `lock::Default`, selected by
+    * `CONFIG_VALUE255_LOCK_MODE`.
+    *
+    * @par Inline capacity
+    * The inline buffer doubles as the 32-bit heap pointer, so it is at
+    * least 4 bytes. `value::Value255` uses 4 bytes and
+    * is 6 bytes in total. A wider buffer trades size for fewer heap
+    * allocations, e.g. `InlineValue255<16>` keeps typical serial numbers
+    * and labels inline:
+    *
+    * | `InlineSize` | `sizeof` (1-byte lock state) | inline payloads |
+    * | ------------ | ---------------------------- | --------------- |
+    * | 4            | 6                            | 0 to 4 bytes    |
+    * | 12           | 14                           | 0 to 12 bytes   |
+    * | 16           | 18                           | 0 to 16 bytes   |
+    *
+    * These capacities are instantiated for every locking policy in
+    * `value255.cpp`; add an instantiation there to use another one.
+    *
+    * @tparam LockPolicy The locking policy, see `value::lock`.
+    * @tparam InlineSize The inline capacity in bytes.
     *
     * @note
     * Private/internal methods such as `set()` and `cleanup()` assume that
@@ -48,7 +102,8 @@ namespace value
     * - Locking granularity is coarse (per instance), limiting concurrency
     *   to a single thread at a time.
     */
-    class Value255
+    template <typename LockPolicy, std::uint8_t InlineSize = 4U>
+    class BasicValue255
     {
     /* ^\__________________________________________ */
     /* #region Static members, Inner types.         */
@@ -73,20 +128,14 @@ namespace value
         * - `data` is null while `size` is greater than 0.
         * - A situation where memory cannot be allocated to store a copy of `data`.
         */
-        static std::optional<Value255> create(
+        static std::optional<BasicValue255> create(
             std::byte const *data, std::uint8_t size ) noexcept;
 
         /* #endregion */// Factory methods
 
         /* #region SetResult */
 
-        enum class SetResult : std::uint8_t
-        {
-            Success = 0,
-            NoChange = 1,
-            IllegalArgument = 2,
-            OutOfMemory = 3,
-        };
+        using SetResult = value::SetResult;
 
         /* #endregion */// SetResult
 
@@ -96,14 +145,17 @@ namespace value
 
         struct SpinGuard
         {
-            Value255 const &a_;
-            Value255 const &b_;
+            BasicValue255 const &a_;
+            BasicValue255 const &b_;
 
-            explicit SpinGuard( Value255 const &v ) noexcept
+            explicit SpinGuard( BasicValue255 const &v ) noexcept
                 : SpinGuard( v, v ) {}
 
-            explicit SpinGuard( Value255 const &a, Value255 const &b ) noexcept
-                : a_( a ), b_( b )
+            // Note: Two instances are always locked in address order, lower first,
+            //       so `SpinGuard( x, y )` and `SpinGuard( y, x )` cannot deadlock.
+            explicit SpinGuard( BasicValue255 const &a, BasicValue255 const &b ) noexcept
+                : a_( std::less<>{}( &b, &a ) ? b : a )
+                , b_( std::less<>{}( &b, &a ) ? a : b )
             {
                 // Note: To prevent deadlocks, only one if the same instance will be locked.
                 if ( &a_ == &b_ ) { a_.lock();            }
@@ -125,9 +177,93 @@ namespace value
 
         /* #endregion */// SpinGuard
 
+    public:
+
+        /* #region View */
+
+        /** @brief Scoped, lock-holding read view of a `Value255`. */
+        /**
+         * @details
+         * Grants direct, non-allocating access to the payload of a `Value255`
+         * through a `std::span<std::byte const>`.
+         *
+         * The instance's spinlock is acquired on construction and released on
+         * destruction, so the payload is guaranteed not to change while the
+         * view is alive.
+         *
+         * @attention
+         * - Keep the lifetime of a view as short as possible; every other
+         *   access to the same instance spins until the view is destroyed.
+         * - Calling any public method of the viewed instance while the view is
+         *   alive will result in deadlock (see `Value255` non-reentrancy).
+         * - Do not hold views of two different instances at the same time
+         *   unless the locking order is guaranteed by the caller.
+         */
+        class View
+        {
+        public:
+
+            /** @brief Locks `v` and exposes its payload. */
+            /**
+             * @param v [in] The `Value255` instance to view.
+             */
+            explicit View( BasicValue255 const &v ) noexcept
+                : guard_( v )
+                , bytes_( v.data_unlocked(), v.size_ )
+            {
+                // [===> Follows: Locked]
+            }
+
+            View( View const & ) = delete;              //!< Copy constructor (deleted).
+            View &operator=( View const & ) = delete;   //!< Copy operator (deleted).
+            View( View && ) = delete;                   //!< Move constructor (deleted).
+            View &operator=( View && ) = delete;        //!< Move operator (deleted).
+
+            /** @brief Returns the payload as a span of bytes. */
+            [[nodiscard]]
+            std::span<std::byte const> span() const noexcept { return bytes_; }
+
+            /** @brief Returns the size of the payload in bytes. */
+            [[nodiscard]]
+            std::uint8_t size() const noexcept
+            {
+                return static_cast<std::uint8_t>( bytes_.size() );
+            }
+
+            /** @brief Returns `true` if the payload is empty. */
+            [[nodiscard]]
+            bool empty() const noexcept { return bytes_.empty(); }
+
+            /** @brief Returns the byte at `i`. `i` must be less than `size()`. */
+            [[nodiscard]]
+            std::byte operator[]( std::uint8_t i ) const noexcept { return bytes_[i]; }
+
+            /** @brief Returns the payload as characters, e.g. of a `String` format value. */
+            /**
+             * @details
+             * Not terminated; valid only while the view is alive.
+             */
+            [[nodiscard]]
+            std::string_view chars() const noexcept
+            {
+                return std::string_view( reinterpret_cast<char const *>( bytes_.data() ), bytes_.size() );
+            }
+
+        private:
+
+            SpinGuard guard_;                       //!< Held for the lifetime of the view.
+            std::span<std::byte const> bytes_;      //!< Payload of the viewed instance.
+        };
+
+        /* #endregion */// View
+
     private:
 
-        static constexpr std::uint8_t INLINE_SIZE = 4;
+        static constexpr std::uint8_t INLINE_SIZE = InlineSize;
+        static constexpr std::uint8_t POINTER_SIZE = 4U; //!< Size of the heap pointer, see `value255.cpp`.
+
+        static_assert( INLINE_SIZE >= POINTER_SIZE, "The inline buffer must hold a heap pointer" );
+        static_assert( INLINE_SIZE < UINT8_MAX, "Payloads larger than the inline buffer must exist" );
 
     /* #endregion */// Static members, Inner types
 
@@ -142,21 +278,21 @@ namespace value
          * @details
          * Initializes an empty `Value255` with size 0 and no allocated memory.
          */
-        explicit Value255() noexcept = default;
+        explicit BasicValue255() noexcept = default;
 
         /** @brief Destructor. */
         /**
          * @details
          * Cleans up any heap-allocated memory when the `Value255` instance is destroyed.
          */
-        ~Value255() noexcept
+        ~BasicValue255() noexcept
         {
             // Note: Destructor called, there's no need to lock it.
             cleanup();
         }
 
         /** @brief Copy constructor (deleted). */
-        Value255( Value255 const & ) = delete;
+        BasicValue255( BasicValue255 const & ) = delete;
 
         /** @brief Move constructor. */
         /**
@@ -166,7 +302,7 @@ namespace value
          *
          * @param other [in,out] The other `Value255` to move from.
          */
-        Value255( Value255 &&other ) noexcept;
+        BasicValue255( BasicValue255 &&other ) noexcept;
 
     /* #endregion */// Constructors
 
@@ -177,7 +313,7 @@ namespace value
     public:
 
         /** @brief Copy assignment operator (deleted). */
-        Value255 &operator=( Value255 const & ) noexcept = delete;
+        BasicValue255 &operator=( BasicValue255 const & ) noexcept = delete;
 
         /** @brief Move assignment operator. */
         /**
@@ -195,7 +331,7 @@ namespace value
          *
          * @return Reference to this `Value255` after the move.
          */
-        Value255 &operator=( Value255 &&other ) noexcept;
+        BasicValue255 &operator=( BasicValue255 &&other ) noexcept;
 
         /** @brief Equality operator. */
         /**
@@ -211,7 +347,7 @@ namespace value
          *
          * @return `true` if both instances are equal, `false` otherwise.
          */
-        bool operator==( Value255 const &other ) const noexcept;
+        bool operator==( BasicValue255 const &other ) const noexcept;
 
         /** @brief Three-way comparison operator. */
         /**
@@ -227,7 +363,7 @@ namespace value
          *
          * @return `std::strong_ordering` indicating the comparison result.
          */
-        auto operator<=>( Value255 const &other ) const noexcept
+        auto operator<=>( BasicValue255 const &other ) const noexcept
             ->std::strong_ordering;
 
     /* #endregion */// Operators
@@ -245,19 +381,78 @@ namespace value
         [[nodiscard]]
         std::uint8_t size() const noexcept
         {
-            SpinGuard guard( *this );
-            // [===> Follows: Locked]
+            return read( []( std::span<std::byte const> bytes ) noexcept
+            {
+                return static_cast<std::uint8_t>( bytes.size() );
+            } );
+        }
 
-            return size_;
+        /** @brief Returns a hash of the payload. */
+        /**
+         * @details
+         * `util::hashBytes()` of the payload, read under the lock without
+         * copying. Equal values have equal hashes, and so do their raw
+         * bytes, so lookups by `std::span` or `std::string_view` need no
+         * `Value255` (see `value::Hash`).
+         *
+         * @return 32-bit hash of the payload.
+         */
+        [[nodiscard]]
+        std::uint32_t hash() const noexcept
+        {
+            return read( []( std::span<std::byte const> bytes ) noexcept
+            {
+                return util::hashBytes( bytes );
+            } );
         }
 
         /** @brief Returns the value as a vector of bytes. */
         /**
+         * @note
+         * This method allocates a new vector on every call.
+         * Use `view()` or `copyTo()` on hot paths instead.
+         *
          * @return Vector of bytes representing the value.
          */
         [[nodiscard]]
         std::vector<std::byte> bytes() const noexcept;
 
+        /** @brief Returns a scoped, lock-holding view of the value. */
+        /**
+         * @details
+         * The returned view keeps this instance locked until it is destroyed.
+         * No memory is allocated.
+         * In seqlock read mode the view takes exclusive (writer) access.
+         *
+         * @code
+         * {
+         *     Value255::View const view = v.view();
+         *     std::span<std::byte const> bytes = view.span();
+         *     // ... read bytes ...
+         * } // Unlocked here.
+         * @endcode
+         *
+         * @see View for the locking rules.
+         *
+         * @return View of this instance.
+         */
+        [[nodiscard]]
+        View view() const noexcept { return View( *this ); }
+
+        /** @brief Copies the value into a caller-supplied buffer. */
+        /**
+         * @details
+         * Copies the whole payload into the head of `out` without allocating.
+         * Nothing is copied if `out` is smaller than the value.
+         *
+         * @param out [out] Destination buffer.
+         *
+         * @return The number of bytes copied if successful;
+         *         `std::nullopt` if `out` is too small.
+         */
+        [[nodiscard]]
+        std::optional<std::uint8_t> copyTo( std::span<std::byte> out ) const noexcept;
+
         /** @brief Returns a string representation of the value. */
         /**
          * @details
@@ -290,15 +485,15 @@ namespace value
         * - A situation where memory cannot be allocated to store a copy of `data`.
         */
         [[nodiscard]]
-        std::optional<Value255> clone( void ) const noexcept
+        std::optional<BasicValue255> clone( void ) const noexcept
         {
-            SpinGuard guard( *this );
-            // [===> Follows: Locked]
-
-            /* Note:
-                create() is public method but does not require a lock,
-                so there are no deadlock issues. */
-            return create( data_unlocked(), size_ );
+            return read( []( std::span<std::byte const> bytes ) noexcept
+            {
+                /* Note:
+                    create() is public method but does not require a lock,
+                    so there are no deadlock issues. */
+                return create( bytes.data(), static_cast<std::uint8_t>( bytes.size() ) );
+            } );
         }
 
     protected:
@@ -317,19 +512,95 @@ namespace value
 
         void cleanup() noexcept;
 
-        void moveFrom( Value255 &&other ) noexcept;
+        void moveFrom( BasicValue255 &&other ) noexcept;
+
+        void lock() const noexcept { LockPolicy::lock( lock_ ); }
 
-        void lock() const noexcept
+        void unlock() const noexcept { LockPolicy::unlock( lock_ ); }
+
+        /** @brief Runs `f` on a consistent snapshot of the payload. */
+        /**
+         * @details
+         * `f` receives the payload as `std::span<std::byte const>` and must
+         * only read it. If `LockPolicy` reads optimistically, `f` may be invoked
+         * more than once, and only the result of a consistent invocation is
+         * returned.
+         *
+         * @param f [in] Callable invoked as `f( std::span<std::byte const> )`.
+         *
+         * @return The result of `f`.
+         */
+        template <typename F>
+        std::invoke_result_t<F, std::span<std::byte const>> read( F &&f ) const noexcept
         {
-            while( lock_.exchange( true, std::memory_order_acquire ) )
+            if constexpr ( LockPolicy::OPTIMISTIC_READ )
             {
-                /* Busy loop */
+                while ( true )
+                {
+                    std::uint8_t const seq = LockPolicy::beginRead( lock_ );
+
+                    // Note: Validate the header before following the heap pointer,
+                    //       a torn pointer must never be dereferenced.
+                    std::uint8_t const size = size_;
+                    std::uintptr_t const ptr = heapPointer();
+
+                    if ( !LockPolicy::validateRead( lock_, seq ) ) { continue; }
+                    // [===> Follows: Size and pointer are consistent]
+
+                    std::byte const *data = ( size > INLINE_SIZE )
+                        ? reinterpret_cast<std::byte const *>( ptr )
+                        : raw_data_;
+
+                    auto result = f( std::span<std::byte const>( data, size ) );
+
+                    if ( LockPolicy::validateRead( lock_, seq ) ) { return result; }
+                    // [===> Follows: A writer intervened, retry]
+                }
+            }
+            else
+            {
+                SpinGuard guard( *this );
+                // [===> Follows: Locked]
+
+                return f( std::span<std::byte const>( data_unlocked(), size_ ) );
             }
         }
 
-        void unlock() const noexcept
+        /** @brief Runs `f` on consistent snapshots of this and another payload. */
+        /**
+         * @details
+         * Without optimistic reads both instances are locked by one `SpinGuard`,
+         * i.e. in address order, so `x == y` and `y == x` racing on two tasks
+         * cannot deadlock. Optimistic readers take no lock and nest `read()`.
+         *
+         * @param other [in] The other instance; must not be `*this`.
+         * @param f     [in] Callable invoked as
+         *                   `f( std::span<std::byte const>, std::span<std::byte const> )`
+         *                   with the payload of `*this` first.
+         *
+         * @return The result of `f`.
+         */
+        template <typename F>
+        auto readBoth( BasicValue255 const &other, F &&f ) const noexcept
         {
-            lock_.store( false, std::memory_order_release );
+            if constexpr ( LockPolicy::OPTIMISTIC_READ )
+            {
+                return read( [&other, &f]( std::span<std::byte const> a ) noexcept
+                {
+                    return other.read( [a, &f]( std::span<std::byte const> b ) noexcept
+                    {
+                        return f( a, b );
+                    } );
+                } );
+            }
+            else
+            {
+                SpinGuard guard( *this, other );
+                // [===> Follows: Both locked]
+
+                return f( std::span<std::byte const>( data_unlocked(), size_ )
+                        , std::span<std::byte const>( other.data_unlocked(), other.size_ ) );
+            }
         }
 
         std::uintptr_t heapPointer() const noexcept;
@@ -353,15 +624,18 @@ namespace value
 
         /* #region Member variables */
 
-        std::atomic<bool> mutable lock_ = false;    //!< Spinlock for thread safety. false=unlocked, true=locked.
-        std::uint8_t size_ = 0;                     //!< Size of the property value in bytes.
-        std::byte raw_data_[INLINE_SIZE] = {};      //!< Inline storage or heap pointer.
+        typename LockPolicy::State mutable lock_ {};    //!< Lock state for thread safety, see `LockPolicy`.
+        std::uint8_t size_ = 0;                         //!< Size of the property value in bytes.
+        std::byte raw_data_[INLINE_SIZE] = {};          //!< Inline storage or heap pointer.
 
         /* #endregion */// Member variables
 
     /* #endregion */// Instance members
 
-    }; // class Value255
+    }; // class BasicValue255
+
+    /** @brief Opaque value up to 255 bytes using the Kconfig-selected locking policy. */
+    using Value255 = BasicValue255<lock::Default>;
 
     /** @brief Stream output operator for `Value255`. */
     /**
@@ -376,7 +650,12 @@ namespace value
      *
      * @return Reference to the output stream after writing.
      */
-    std::ostream &operator<<( std::ostream &os, Value255 const &v ) noexcept;
+    template <typename LockPolicy, std::uint8_t InlineSize>
+    std::ostream &operator<<( std::ostream &os, BasicValue255<LockPolicy, InlineSize> const &v ) noexcept
+    {
+        os << v.str();
+        return os;
+    }
 
     /** @brief Mutable counterpart of `Value255`. */
     /**
@@ -403,14 +682,38 @@ namespace value
     * - Avoid long-running operations inside `set()`, as the lock is held for
     *   the entire duration of the mutation.
     */
-    class MutableValue255 : public Value255
+    template <typename LockPolicy, std::uint8_t InlineSize = 4U>
+    class BasicMutableValue255 : public BasicValue255<LockPolicy, InlineSize>
     {
+    /* ^\__________________________________________ */
+    /* #region Static members, Inner types.         */
+
+    private:
+
+        using Base = BasicValue255<LockPolicy, InlineSize>;
+        using typename Base::SpinGuard;
+
+    public:
+
+        using typename Base::SetResult;
+
+    /* #endregion */// Static members, Inner types
+
+
     /* ^\__________________________________________ */
     /* #region Constructors.                        */
 
     public:
 
-        using Value255::Value255;
+        using Base::Base;
+
+        /** @brief Takes over the payload of an immutable value. */
+        /**
+         * @param other [in,out] The value to move from.
+         */
+        explicit BasicMutableValue255( Base &&other ) noexcept
+            : Base( std::move( other ) )
+        { /* Do nothing */ }
 
     /* #endregion */// Constructors
 
@@ -446,7 +749,7 @@ namespace value
             SpinGuard guard( *this );
             // [===> Follows: Locked]
 
-            return Value255::set( data, size );
+            return Base::set( data, size );
         }
 
         /** @brief Sets the value's data and size. */
@@ -475,14 +778,135 @@ namespace value
             SpinGuard guard( *this );
             // [===> Follows: Locked]
 
-            return Value255::setEx( data, size );
+            return Base::setEx( data, size );
         }
 
     /* #endregion */// Instance members
 
-    }; // class MutableValue255
+    }; // class BasicMutableValue255
+
+    /** @brief Mutable counterpart of `Value255`. */
+    using MutableValue255 = BasicMutableValue255<lock::Default>;
+
+    /** @brief `Value255` with an inline capacity of `InlineSize` bytes. */
+    template <std::uint8_t InlineSize>
+    using InlineValue255 = BasicValue255<lock::Default, InlineSize>;
+
+    /** @brief Mutable counterpart of `InlineValue255`. */
+    template <std::uint8_t InlineSize>
+    using InlineMutableValue255 = BasicMutableValue255<lock::Default, InlineSize>;
+
+    /** @brief Transparent hash of `Value255` keys. */
+    /**
+     * @details
+     * Also hashes raw bytes and `std::string_view` exactly like a value
+     * with the same payload. Together with `value::EqualTo`, unordered
+     * containers keyed by values can be searched without building a value:
+     *
+     * \code{.cpp}
+     * std::unordered_map<value::Value255, Label, value::Hash, value::EqualTo> labels;
+     * auto it = labels.find( std::string_view( "serial-0042" ) );
+     * \endcode
+     */
+    struct Hash
+    {
+        using is_transparent = void;
+
+        template <typename LockPolicy, std::uint8_t InlineSize>
+        std::size_t operator()( BasicValue255<LockPolicy, InlineSize> const &v ) const noexcept
+        {
+            return v.hash();
+        }
+
+        std::size_t operator()( std::span<std::byte const> bytes ) const noexcept
+        {
+            return util::hashBytes( bytes );
+        }
+
+        std::size_t operator()( std::string_view chars ) const noexcept
+        {
+            return util::hashBytes( std::as_bytes( std::span( chars ) ) );
+        }
+    };
+
+    /** @brief Transparent equality of `Value255` keys, raw bytes and `std::string_view`. */
+    /**
+     * @details
+     * A value is compared in place, under its lock.
+     *
+     * @see value::Hash
+     */
+    struct EqualTo
+    {
+        using is_transparent = void;
+
+        template <typename LockPolicy, std::uint8_t InlineSize>
+        bool operator()( BasicValue255<LockPolicy, InlineSize> const &a
+                       , BasicValue255<LockPolicy, InlineSize> const &b ) const noexcept
+        {
+            return a == b;
+        }
+
+        template <typename LockPolicy, std::uint8_t InlineSize>
+        bool operator()( BasicValue255<LockPolicy, InlineSize> const &v
+                       , std::span<std::byte const> bytes ) const noexcept
+        {
+            typename BasicValue255<LockPolicy, InlineSize>::View const view = v.view();
+            return std::ranges::equal( view.span(), bytes );
+        }
+
+        template <typename LockPolicy, std::uint8_t InlineSize>
+        bool operator()( BasicValue255<LockPolicy, InlineSize> const &v, std::string_view chars ) const noexcept
+        {
+            return ( *this )( v, std::as_bytes( std::span( chars ) ) );
+        }
+
+        template <typename LockPolicy, std::uint8_t InlineSize>
+        bool operator()( std::span<std::byte const> bytes, BasicValue255<LockPolicy, InlineSize> const &v ) const noexcept
+        {
+            return ( *this )( v, bytes );
+        }
+
+        template <typename LockPolicy, std::uint8_t InlineSize>
+        bool operator()( std::string_view chars, BasicValue255<LockPolicy, InlineSize> const &v ) const noexcept
+        {
+            return ( *this )( v, chars );
+        }
+    };
 
     static_assert(  sizeof(value::Value255) == 6U, "Unexpected Value255 size");
     static_assert( alignof(value::Value255) == 1U, "Unexpected Value255 alignment");
+    static_assert(  sizeof(value::BasicValue255<lock::SpinLock>) == 6U, "Unexpected Value255 size");
+    static_assert(  sizeof(value::BasicValue255<lock::SeqLock>) == 6U, "Unexpected Value255 size");
+    static_assert(  sizeof(value::BasicValue255<lock::NoLock>) == 6U, "Unexpected Value255 size");
+    static_assert(  sizeof(value::InlineValue255<12U>) == 14U, "Unexpected InlineValue255<12> size");
+    static_assert(  sizeof(value::InlineValue255<16U>) == 18U, "Unexpected InlineValue255<16> size");
+    static_assert( alignof(value::InlineValue255<16U>) == 1U, "Unexpected InlineValue255<16> alignment");
 
 } // namespace value
+
+
+namespace std // Hash specialization
+{
+
+    /** @brief Hash specialization for `value::BasicValue255`, see `BasicValue255::hash()`. */
+    template <typename LockPolicy, std::uint8_t InlineSize>
+    struct hash<value::BasicValue255<LockPolicy, InlineSize>>
+    {
+        std::size_t operator()( value::BasicValue255<LockPolicy, InlineSize> const &v ) const noexcept
+        {
+            return v.hash();
+        }
+    };
+
+    /** @brief Hash specialization for `value::BasicMutableValue255`, same as for its base. */
+    template <typename LockPolicy, std::uint8_t InlineSize>
+    struct hash<value::BasicMutableValue255<LockPolicy, InlineSize>>
+    {
+        std::size_t operator()( value::BasicMutableValue255<LockPolicy, InlineSize> const &v ) const noexcept
+        {
+            return v.hash();
+        }
+    };
+
+} // namespace std
@@ -4,30 +4,96 @@
 #include <value255.hpp>
 
 /* C++ Standard Library */
-#include <string>
-
-// to cpp
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <format>
+#include <span>
+
+
+namespace value::detail
+{
+
+    /** @brief Upper-case hexadecimal digits, indexed by nibble. */
+    constexpr std::array<char, 16U> HEX_DIGITS =
+    {
+        '0', '1', '2', '3', '4', '5', '6', '7',
+        '8', '9', 'A', 'B', 'C', 'D', 'E', 'F',
+    };
+
+    /** @brief Writes bytes as `[ 0xAB 0xCD ]` to an output iterator. */
+    /**
+     * @details
+     * Digits are taken from `HEX_DIGITS`, so no `std::format` call and no
+     * intermediate `std::string` is involved. An empty span is written
+     * as `[  ]`.
+     *
+     * @param out   [in,out] The output iterator to write to.
+     * @param bytes [in]     The bytes to write.
+     *
+     * @return Iterator to the end of the written output.
+     */
+    template <typename OutputIt>
+    constexpr OutputIt writeHex( OutputIt out, std::span<std::byte const> bytes ) noexcept
+    {
+        *out++ = '[';
+        *out++ = ' ';
+
+        for ( std::size_t i = 0U; i < bytes.size(); i++ )
+        {
+            auto const b = static_cast<std::uint8_t>( bytes[i] );
+
+            *out++ = '0';
+            *out++ = 'x';
+            *out++ = HEX_DIGITS[b >> 4U];
+            *out++ = HEX_DIGITS[b & 0x0FU];
+
+            if ( i + 1U < bytes.size() ) { *out++ = ' '; }
+        }
+
+        *out++ = ' ';
+        *out++ = ']';
+
+        return out;
+    }
+
+    /** @brief Raw bytes that format like a `Value255`. */
+    /**
+     * @details
+     * For payloads that are not held by a value, e.g. decoded from a
+     * binary log record; the output is the same as for a `Value255`
+     * with these bytes.
+     */
+    struct HexBytes
+    {
+        std::span<std::byte const> bytes; //!< The payload.
+    };
+
+} // namespace value::detail
 
 
 namespace std // Formatter specialization
 {
 
-    /** @brief Formatter specialization for `value::Value255`. */
+    /** @brief Formatter specialization for `value::BasicValue255`. */
     /**
      * @details
-     * Formats a `value::Value255` instance. Examples are follows:
+     * Formats a `value::BasicValue255` instance of any locking policy and
+     * inline capacity. Examples are follows:
      *
      * - A `Value255` containing the bytes `0xA5, 0xE7, 0x00, 0xFF`
      *   will be formatted as: `[ 0xA5 0xE7 0x00 0xFF ]`
      * - A `Value255` containing the bytes `0x12, 0x34`
      *   will be formatted as: `[ 0x12 0x34 ]`
-     * - An empty `Value255` (size 0) will be formatted as: `[ ]`
+     * - An empty `Value255` (size 0) will be formatted as: `[  ]`
+     *
+     * The payload is written directly to the output iterator; no heap
+     * memory is allocated.
      *
      * @see Value255::str() for the format of the output.
      */
-    template <>
-    struct formatter<value::Value255>
+    template <typename LockPolicy, std::uint8_t InlineSize>
+    struct formatter<value::BasicValue255<LockPolicy, InlineSize>>
     {
         /** @brief Parse format specifiers (no supported). */
         /**
@@ -50,16 +116,36 @@ namespace std // Formatter specialization
          * @return Iterator to the end of the formatted output.
          */
         template <typename FormatContext>
-        auto format( value::Value255 const &v, FormatContext &ctx ) const noexcept
+        auto format( value::BasicValue255<LockPolicy, InlineSize> const &v, FormatContext &ctx ) const noexcept
+        {
+            // Note: Copy out first so that the lock is not held while writing.
+            std::array<std::byte, UINT8_MAX> buf;
+            std::uint8_t const size = v.copyTo( buf ).value_or( 0U );
+
+            return value::detail::writeHex(
+                ctx.out(), std::span<std::byte const>( buf.data(), size ) );
+        }
+    };
+
+    /** @brief Formatter specialization for `value::detail::HexBytes`. */
+    /**
+     * @see formatter<value::BasicValue255> for the format of the output.
+     */
+    template <>
+    struct formatter<value::detail::HexBytes>
+    {
+        /** @brief Parse format specifiers (none supported). */
+        constexpr auto parse( std::format_parse_context &ctx ) const noexcept
+            -> const char *
+        {
+            return ctx.begin();
+        }
+
+        /** @brief Format the bytes. */
+        template <typename FormatContext>
+        auto format( value::detail::HexBytes const &v, FormatContext &ctx ) const noexcept
         {
-            std::string str = v.str();
-            
-            for ( char c : str )
-            {
-                *ctx.out()++ = c;
-            }
-
-            return ctx.out();
+            return value::detail::writeHex( ctx.out(), v.bytes );
         }
     };
 
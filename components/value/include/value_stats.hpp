@@ -0,0 +1,184 @@
+#pragma once
+
+/* C++ Standard Library */
+#include <atomic>
+#include <cstdint>
+
+/* ESP-IDF */
+#include <sdkconfig.h>
+
+namespace value
+{
+
+    /** @brief Heap and lock counters of all `Value255` instances. */
+    /**
+     * @details
+     * Enabled by `CONFIG_VALUE255_STATS_ENABLE`. When disabled, every hook
+     * is an empty inline function and no counter exists, so instrumented
+     * code compiles to exactly what it was before.
+     *
+     * | Counter         | Meaning                                                    |
+     * | --------------- | ---------------------------------------------------------- |
+     * | `liveBytes`     | payload bytes currently stored on the heap                 |
+     * | `peakBytes`     | maximum of `liveBytes` since start or `resetPeak()`        |
+     * | `allocations`   | payload allocations                                        |
+     * | `frees`         | payload releases                                           |
+     * | `reallocations` | `setEx()` calls that released a payload to allocate anew   |
+     * | `contentions`   | lock acquisitions that had to wait                         |
+     * | `spins`         | busy-loop iterations while waiting for a lock              |
+     *
+     * Payload bytes are the sizes of the values, not including allocator
+     * overhead or unused pool slots. Values inside a `Spec` are counted as
+     * well, so the counters cover the whole property model.
+     *
+     * All counters are relaxed atomics; a snapshot is not a consistent cut
+     * across counters, but each counter is exact.
+     *
+     * @note ja: `Value255`のヒープ使用量とロック競合の統計。
+     */
+    class Stats
+    {
+    public:
+        explicit Stats() noexcept = delete; //!< @brief Default constructor (deleted).
+
+    /* ^\__________________________________________ */
+    /* #region Static members, Inner types.         */
+
+    public:
+
+        /** @brief `true` if the counters are compiled in. */
+#if CONFIG_VALUE255_STATS_ENABLE
+        static constexpr bool ENABLED = true;
+#else
+        static constexpr bool ENABLED = false;
+#endif
+
+        /** @brief Copy of all counters, see the class description. */
+        struct Snapshot
+        {
+            std::uint32_t liveBytes;
+            std::uint32_t peakBytes;
+            std::uint32_t allocations;
+            std::uint32_t frees;
+            std::uint32_t reallocations;
+            std::uint32_t contentions;
+            std::uint32_t spins;
+        };
+
+        /* #region Public methods */
+
+        /** @brief Returns the current counters; all zero if disabled. */
+        [[nodiscard]]
+        static Snapshot snapshot() noexcept;
+
+        /** @brief Restarts `peakBytes` at the current `liveBytes`. */
+        static void resetPeak() noexcept;
+
+        /** @brief Writes the current counters to the log with `ESP_LOGI`. */
+        /**
+         * @param tag [in] The log tag.
+         */
+        static void log( char const *tag ) noexcept;
+
+        /** @brief Logs the counters periodically from a FreeRTOS timer. */
+        /**
+         * @details
+         * Calls `log( "value255" )` every `period_ms` milliseconds until
+         * `stopPeriodicLog()` is called. Calling it again changes the period.
+         *
+         * @param period_ms [in] The period in milliseconds; must not be 0.
+         *
+         * @return `true` if the timer runs; `false` if disabled or the timer
+         *         could not be created.
+         */
+        static bool startPeriodicLog( std::uint32_t period_ms ) noexcept;
+
+        /** @brief Stops the timer of `startPeriodicLog()`. */
+        static void stopPeriodicLog() noexcept;
+
+        /* #endregion */// Public methods
+
+        /* #region Hooks */
+
+#if CONFIG_VALUE255_STATS_ENABLE
+
+        /** @brief A payload of `size` bytes was allocated. */
+        static void onAllocate( std::uint8_t size ) noexcept
+        {
+            allocations_.fetch_add( 1U, std::memory_order_relaxed );
+            addLive( size );
+        }
+
+        /** @brief A payload of `size` bytes was released. */
+        static void onFree( std::uint8_t size ) noexcept
+        {
+            frees_.fetch_add( 1U, std::memory_order_relaxed );
+            liveBytes_.fetch_sub( size, std::memory_order_relaxed );
+        }
+
+        /** @brief A payload was resized in place from `from` to `to` bytes. */
+        static void onResize( std::uint8_t from, std::uint8_t to ) noexcept
+        {
+            if ( to >= from ) { addLive( static_cast<std::uint8_t>( to - from ) ); }
+            else              { liveBytes_.fetch_sub( from - to, std::memory_order_relaxed ); }
+        }
+
+        /** @brief `setEx()` released a payload to allocate a new one. */
+        static void onReallocate() noexcept
+        {
+            reallocations_.fetch_add( 1U, std::memory_order_relaxed );
+        }
+
+        /** @brief A lock was acquired after `spins` busy-loop iterations. */
+        static void onAcquire( std::uint32_t spins ) noexcept
+        {
+            if ( spins == 0U ) { return; }
+            // ~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on uncontended lock!! ]
+
+            contentions_.fetch_add( 1U, std::memory_order_relaxed );
+            spins_.fetch_add( spins, std::memory_order_relaxed );
+        }
+
+#else
+
+        static void onAllocate( std::uint8_t ) noexcept { /* Do nothing */ }
+        static void onFree( std::uint8_t ) noexcept { /* Do nothing */ }
+        static void onResize( std::uint8_t, std::uint8_t ) noexcept { /* Do nothing */ }
+        static void onReallocate() noexcept { /* Do nothing */ }
+        static void onAcquire( std::uint32_t ) noexcept { /* Do nothing */ }
+
+#endif
+
+        /* #endregion */// Hooks
+
+    private:
+
+#if CONFIG_VALUE255_STATS_ENABLE
+
+        static void addLive( std::uint32_t bytes ) noexcept
+        {
+            std::uint32_t const live = liveBytes_.fetch_add( bytes, std::memory_order_relaxed ) + bytes;
+            std::uint32_t peak = peakBytes_.load( std::memory_order_relaxed );
+
+            while ( ( live > peak ) &&
+                    !peakBytes_.compare_exchange_weak( peak, live, std::memory_order_relaxed ) )
+            {
+                /* Retry with the updated peak */
+            }
+        }
+
+        static inline std::atomic<std::uint32_t> liveBytes_ { 0U };
+        static inline std::atomic<std::uint32_t> peakBytes_ { 0U };
+        static inline std::atomic<std::uint32_t> allocations_ { 0U };
+        static inline std::atomic<std::uint32_t> frees_ { 0U };
+        static inline std::atomic<std::uint32_t> reallocations_ { 0U };
+        static inline std::atomic<std::uint32_t> contentions_ { 0U };
+        static inline std::atomic<std::uint32_t> spins_ { 0U };
+
+#endif
+
+    /* #endregion */// Static members, Inner types
+
+    }; // class Stats
+
+} // namespace value
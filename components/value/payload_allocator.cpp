@@ -0,0 +1,163 @@
+/* Self */
+#include <payload_allocator.hpp>
+
+/* C++ Standard Library */
+#include <atomic>
+
+/* Custom Library */
+#include <lock_policy.hpp>
+
+/* ESP-IDF */
+#include <esp_heap_caps.h>
+
+
+/* ^\__________________________________________ */
+/* Namespaces.                                  */
+
+using namespace value;
+
+
+/* ^\__________________________________________ */
+/* #region HeapAllocator.                       */
+
+void *HeapAllocator::allocate( std::uint8_t size ) noexcept
+{
+    return heap_caps_malloc( size, MALLOC_CAP_DEFAULT );
+}
+
+void HeapAllocator::deallocate( void *p, std::uint8_t /* size */ ) noexcept
+{
+    heap_caps_free( p );
+}
+
+/* #endregion */// HeapAllocator
+
+
+/* ^\__________________________________________ */
+/* #region PoolAllocator.                       */
+
+namespace
+{
+#if CONFIG_VALUE255_POOL_REGION_SPIRAM
+    constexpr std::uint32_t POOL_CAPS = MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT;
+#else
+    constexpr std::uint32_t POOL_CAPS = MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT;
+#endif
+
+#ifdef CONFIG_VALUE255_POOL_SLOTS_PER_SLAB
+    constexpr std::size_t SLOTS_PER_SLAB = CONFIG_VALUE255_POOL_SLOTS_PER_SLAB;
+#else
+    constexpr std::size_t SLOTS_PER_SLAB = 16U;
+#endif
+
+    /** @brief A released slot, linked into the free list of its class. */
+    struct FreeSlot
+    {
+        FreeSlot *next;
+    };
+
+    /** @brief Free list of one size class. */
+    struct SizeClass
+    {
+        std::atomic<bool> lock_ = false;    //!< Spinlock with backoff. false=unlocked, true=locked.
+        FreeSlot *head_ = nullptr;          //!< First free slot.
+
+        void lock() noexcept
+        {
+            lock::Backoff backoff;
+
+            while( lock_.exchange( true, std::memory_order_acquire ) )
+            {
+                // Note: Wait on a load; only retry the store once the lock looks free.
+                do { backoff.pause(); } while( lock_.load( std::memory_order_relaxed ) );
+            }
+        }
+
+        void unlock() noexcept
+        {
+            lock_.store( false, std::memory_order_release );
+        }
+
+        /** @brief Allocates a new slab, keeps its first slot and links the others. */
+        /**
+         * @details
+         * The slab is allocated without the lock, which is only taken to
+         * link the remaining slots.
+         *
+         * @return The first slot, or `nullptr` on allocation failure.
+         */
+        FreeSlot *grow( std::size_t slot_size ) noexcept
+        {
+            // [===> Prerequisite: This class is not locked by the caller]
+
+            auto *slab = static_cast<std::byte *>(
+                heap_caps_malloc( slot_size * SLOTS_PER_SLAB, POOL_CAPS ) );
+            if ( !slab ) { return nullptr; }
+            // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on allocation failure!! ]
+            // [===> Follows: Slab allocated]
+
+            // Note: Chained before locking, so that linking is a single splice.
+            FreeSlot *first = nullptr;
+            FreeSlot *last = nullptr;
+            for ( std::size_t i = SLOTS_PER_SLAB - 1U; i > 0U; i-- )
+            {
+                auto *slot = reinterpret_cast<FreeSlot *>( slab + slot_size * i );
+                slot->next = first;
+                first = slot;
+                if ( !last ) { last = slot; }
+            }
+
+            if ( first )
+            {
+                lock();
+                last->next = head_;
+                head_ = first;
+                unlock();
+            }
+            // [===> Follows: Slots 1.. are linked in address order]
+
+            return reinterpret_cast<FreeSlot *>( slab );
+        }
+    };
+
+    constinit std::array<SizeClass, PoolAllocator::CLASS_SIZES.size()> size_classes {};
+
+} // namespace
+
+void *PoolAllocator::allocate( std::uint8_t size ) noexcept
+{
+    std::uint8_t const idx = classOf( size );
+    SizeClass &sc = size_classes[idx];
+
+    sc.lock();
+    // [===> Follows: Locked]
+
+    FreeSlot *slot = sc.head_;
+    if ( slot ) { sc.head_ = slot->next; }
+
+    sc.unlock();
+
+    if ( slot ) { return slot; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on a free slot!! ]
+    // [===> Follows: Empty free list; grown without holding the lock]
+
+    return sc.grow( CLASS_SIZES[idx] );
+}
+
+void PoolAllocator::deallocate( void *p, std::uint8_t size ) noexcept
+{
+    if ( !p ) { return; }
+
+    SizeClass &sc = size_classes[ classOf( size ) ];
+    auto *slot = static_cast<FreeSlot *>( p );
+
+    sc.lock();
+    // [===> Follows: Locked]
+
+    slot->next = sc.head_;
+    sc.head_ = slot;
+
+    sc.unlock();
+}
+
+/* #endregion */// PoolAllocator
@@ -1,6 +1,18 @@
 #include <unity.h>
 #include <unity_test_runner.h>
 #include <value255.hpp>
+#include <payload_allocator.hpp>
+#include <value255_format.hpp>
+#include <value_stats.hpp>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <array>
+#include <atomic>
+#include <format>
+#include <string_view>
+#include <unordered_map>
 
 using namespace value;
 
@@ -12,3 +24,216 @@ TEST_CASE("Value255 string conversion", "[Value255]")
     TEST_ASSERT_TRUE(v.has_value());
     TEST_ASSERT_EQUAL_STRING("[ 0xAB 0xCD ]", v->str().c_str());
 }
+
+TEST_CASE("Value255 view and copyTo", "[Value255]")
+{
+    std::byte src[] = {std::byte{0x01}, std::byte{0x02}, std::byte{0x03}, std::byte{0x04}, std::byte{0x05}};
+    auto v = Value255::create(src, sizeof(src));
+    TEST_ASSERT_TRUE(v.has_value());
+
+    {
+        Value255::View const view = v->view();
+        TEST_ASSERT_EQUAL_UINT8(sizeof(src), view.size());
+        TEST_ASSERT_EQUAL_MEMORY(src, view.span().data(), sizeof(src));
+    }
+
+    std::byte out[sizeof(src)] = {};
+    TEST_ASSERT_EQUAL_UINT8(sizeof(src), v->copyTo(out).value_or(0U));
+    TEST_ASSERT_EQUAL_MEMORY(src, out, sizeof(src));
+
+    std::byte small[sizeof(src) - 1] = {};
+    TEST_ASSERT_FALSE(v->copyTo(small).has_value());
+}
+
+TEST_CASE("PoolAllocator reuses released slots", "[Value255]")
+{
+    TEST_ASSERT_EQUAL_UINT8(0, PoolAllocator::classOf(5));
+    TEST_ASSERT_EQUAL_UINT8(1, PoolAllocator::classOf(9));
+    TEST_ASSERT_EQUAL_UINT8(5, PoolAllocator::classOf(255));
+    TEST_ASSERT_TRUE(PoolAllocator::canReuse(9, 16));
+    TEST_ASSERT_FALSE(PoolAllocator::canReuse(8, 9));
+
+    void *a = PoolAllocator::allocate(10);
+    TEST_ASSERT_NOT_NULL(a);
+    PoolAllocator::deallocate(a, 10);
+
+    void *b = PoolAllocator::allocate(16);
+    TEST_ASSERT_EQUAL_PTR(a, b);
+    PoolAllocator::deallocate(b, 16);
+}
+
+TEST_CASE("BasicValue255 explicit lock policies", "[Value255]")
+{
+    std::byte src[] = {std::byte{0x10}, std::byte{0x20}, std::byte{0x30}, std::byte{0x40}, std::byte{0x50}};
+
+    auto a = BasicValue255<lock::NoLock>::create(src, sizeof(src));
+    auto b = BasicValue255<lock::SeqLock>::create(src, sizeof(src));
+    TEST_ASSERT_TRUE(a.has_value());
+    TEST_ASSERT_TRUE(b.has_value());
+
+    TEST_ASSERT_EQUAL_STRING(a->str().c_str(), b->str().c_str());
+    TEST_ASSERT_EQUAL_UINT8(b->size(), a->size());
+
+    BasicMutableValue255<lock::NoLock> m;
+    TEST_ASSERT_EQUAL(static_cast<int>(SetResult::Success), static_cast<int>(m.setEx(src, 2)));
+    TEST_ASSERT_EQUAL(static_cast<int>(SetResult::NoChange), static_cast<int>(m.setEx(src, 2)));
+    TEST_ASSERT_EQUAL_STRING("[ 0x10 0x20 ]", m.str().c_str());
+}
+
+TEST_CASE("Value255 formatter writes into caller buffer", "[Value255]")
+{
+    std::byte src[] = {std::byte{0x0F}, std::byte{0xA0}};
+    auto v = Value255::create(src, sizeof(src));
+    TEST_ASSERT_TRUE(v.has_value());
+
+    std::array<char, 32> buf = {};
+    auto result = std::format_to_n(buf.data(), buf.size() - 1, "{}", *v);
+    *result.out = '\0';
+    TEST_ASSERT_EQUAL_STRING("[ 0x0F 0xA0 ]", buf.data());
+    TEST_ASSERT_EQUAL_STRING(v->str().c_str(), buf.data());
+
+    Value255 empty;
+    TEST_ASSERT_EQUAL_STRING("[  ]", std::format("{}", empty).c_str());
+}
+
+TEST_CASE("InlineValue255 keeps short strings inline", "[Value255]")
+{
+    char const serial[] = "SN-0123456";
+    auto const *src = reinterpret_cast<std::byte const *>(serial);
+    std::uint8_t const size = sizeof(serial) - 1U;
+
+    auto const isInline = [](auto const &v) {
+        auto const *begin = reinterpret_cast<std::byte const *>(&v);
+        auto const view = v.view();
+        return (view.span().data() >= begin) && (view.span().data() < begin + sizeof(v));
+    };
+
+    auto narrow = Value255::create(src, size);
+    auto wide = InlineValue255<16U>::create(src, size);
+    TEST_ASSERT_TRUE(narrow.has_value());
+    TEST_ASSERT_TRUE(wide.has_value());
+    TEST_ASSERT_FALSE(isInline(*narrow));
+    TEST_ASSERT_TRUE(isInline(*wide));
+    TEST_ASSERT_EQUAL_STRING(narrow->str().c_str(), wide->str().c_str());
+
+    InlineValue255<16U> moved(std::move(*wide));
+    TEST_ASSERT_EQUAL_UINT8(size, moved.size());
+    TEST_ASSERT_EQUAL_UINT8(0U, wide->size());
+
+    InlineMutableValue255<12U> m;
+    std::byte long_src[13] = {};
+    TEST_ASSERT_TRUE(m.set(src, size));
+    TEST_ASSERT_TRUE(isInline(m));
+    TEST_ASSERT_TRUE(m.set(long_src, sizeof(long_src)));
+    TEST_ASSERT_FALSE(isInline(m));
+    TEST_ASSERT_EQUAL_STRING("[ 0x00 0x00 0x00 0x00 0x00 0x00 0x00 0x00 0x00 0x00 0x00 0x00 0x00 ]",
+                             m.str().c_str());
+}
+
+TEST_CASE("Stats counts heap payloads", "[Value255]")
+{
+    if constexpr (!Stats::ENABLED) {
+        Stats::Snapshot const s = Stats::snapshot();
+        TEST_ASSERT_EQUAL_UINT32(0U, s.allocations);
+        TEST_ASSERT_FALSE(Stats::startPeriodicLog(1000U));
+        return;
+    }
+
+    Stats::Snapshot const before = Stats::snapshot();
+    std::byte src[32] = {};
+    {
+        MutableValue255 m;
+        TEST_ASSERT_TRUE(m.set(src, 8U));
+        TEST_ASSERT_TRUE(m.set(src, 32U));
+
+        Stats::Snapshot const s = Stats::snapshot();
+        TEST_ASSERT_EQUAL_UINT32(before.liveBytes + 32U, s.liveBytes);
+        TEST_ASSERT_TRUE(s.peakBytes >= s.liveBytes);
+        TEST_ASSERT_TRUE(s.allocations > before.allocations);
+    }
+
+    Stats::Snapshot const after = Stats::snapshot();
+    TEST_ASSERT_EQUAL_UINT32(before.liveBytes, after.liveBytes);
+    TEST_ASSERT_EQUAL_UINT32(after.allocations - before.allocations, after.frees - before.frees);
+
+    Stats::resetPeak();
+    TEST_ASSERT_EQUAL_UINT32(after.liveBytes, Stats::snapshot().peakBytes);
+}
+
+TEST_CASE("Value255 hashes like its bytes and keys unordered maps", "[Value255]")
+{
+    std::string_view const serial = "SN-0123456";
+    auto const bytes = std::as_bytes(std::span(serial));
+    auto const size = static_cast<std::uint8_t>(bytes.size());
+
+    auto heap = Value255::create(bytes.data(), size);
+    auto wide = InlineValue255<16U>::create(bytes.data(), size);
+    TEST_ASSERT_TRUE(heap.has_value());
+    TEST_ASSERT_TRUE(wide.has_value());
+
+    // Note: Where the payload lives does not matter.
+    TEST_ASSERT_EQUAL_UINT32(util::hashBytes(bytes), heap->hash());
+    TEST_ASSERT_EQUAL_UINT32(heap->hash(), wide->hash());
+    TEST_ASSERT_EQUAL(std::hash<Value255>{}(*heap), Hash{}(serial));
+    TEST_ASSERT_NOT_EQUAL(heap->hash(), Hash{}(serial.substr(1)));
+
+    {
+        Value255::View const view = heap->view();
+        TEST_ASSERT_TRUE(view.chars() == serial);
+    }
+
+    std::unordered_map<Value255, int, Hash, EqualTo> labels;
+    labels.emplace(std::move(*heap), 42);
+
+    auto const it = labels.find(serial);
+    TEST_ASSERT_TRUE(it != labels.end());
+    TEST_ASSERT_EQUAL(42, it->second);
+    TEST_ASSERT_TRUE(labels.find(std::string_view("SN-0000000")) == labels.end());
+    TEST_ASSERT_TRUE(labels.find(bytes) != labels.end());
+}
+
+namespace
+{
+    /** @brief Compares two values many times, in the order given. */
+    struct Comparer
+    {
+        BasicValue255<lock::SpinLock> const *lhs;
+        BasicValue255<lock::SpinLock> const *rhs;
+        std::atomic<int> *done;
+
+        static void entry(void *context)
+        {
+            auto const &self = *static_cast<Comparer *>(context);
+            for (int i = 0; i < 200000; i++)
+            {
+                static_cast<void>(*self.lhs == *self.rhs);
+                static_cast<void>(*self.lhs <=> *self.rhs);
+            }
+            self.done->fetch_add(1);
+            vTaskDelete(nullptr);
+        }
+    };
+}
+
+TEST_CASE("Value255 compares in both orders concurrently without deadlock", "[Value255]")
+{
+    std::byte const lo[] = {std::byte{0x01}, std::byte{0x02}, std::byte{0x03}};
+    std::byte const hi[] = {std::byte{0x80}, std::byte{0x02}, std::byte{0x03}};
+    auto x = BasicValue255<lock::SpinLock>::create(lo, sizeof(lo));
+    auto y = BasicValue255<lock::SpinLock>::create(hi, sizeof(hi));
+    TEST_ASSERT_TRUE(x.has_value() && y.has_value());
+
+    // Note: Bytes order as unsigned.
+    TEST_ASSERT_TRUE(*x < *y);
+    TEST_ASSERT_FALSE(*x == *y);
+
+    std::atomic<int> done{0};
+    Comparer forward{&*x, &*y, &done};
+    Comparer backward{&*y, &*x, &done};
+    TaskHandle_t handle = nullptr;
+    TEST_ASSERT_TRUE(xTaskCreate(&Comparer::entry, "cmp_xy", 4096, &forward, 5, &handle) == pdPASS);
+    TEST_ASSERT_TRUE(xTaskCreate(&Comparer::entry, "cmp_yx", 4096, &backward, 5, &handle) == pdPASS);
+
+    for (int i = 0; i < 1000 && done.load() < 2; i++) { vTaskDelay(pdMS_TO_TICKS(10)); }
+    TEST_ASSERT_EQUAL(2, done.load());
+}
@@ -2,14 +2,14 @@
 #include <value255.hpp>
 
 /* C++ Standard Library */
-#include <algorithm>
 #include <cstring>
-#include <format>
-#include <sstream>
+#include <iterator>
 #include <utility>
 
-/* ESP-IDF */
-#include <esp_heap_caps.h>
+/* Custom Library */
+#include <payload_allocator.hpp>
+#include <value255_format.hpp>
+#include <value_stats.hpp>
 
 
 /* ^\__________________________________________ */
@@ -21,12 +21,13 @@ using namespace value;
 /* ^\__________________________________________ */
 /* #region Factory methods.                     */
 
-std::optional<Value255> Value255::create(
+template <typename LockPolicy, std::uint8_t InlineSize>
+std::optional<BasicValue255<LockPolicy, InlineSize>> BasicValue255<LockPolicy, InlineSize>::create(
     std::byte const *data, std::uint8_t size ) noexcept
 {
     // Note: Creating a new instance, there's no need to lock it.
 
-    Value255 pv;
+    BasicValue255 pv;
     bool ans = pv.set( data, size );
 
     if ( ans )
@@ -43,7 +44,8 @@ std::optional<Value255> Value255::create(
 /* ^\__________________________________________ */
 /* #region Constructors.                        */
 
-Value255::Value255( Value255 &&other ) noexcept
+template <typename LockPolicy, std::uint8_t InlineSize>
+BasicValue255<LockPolicy, InlineSize>::BasicValue255( BasicValue255 &&other ) noexcept
 {
     SpinGuard guard( *this, other );
     // [===> Follows: Locked]
@@ -57,7 +59,8 @@ Value255::Value255( Value255 &&other ) noexcept
 /* ^\__________________________________________ */
 /* #region Operators.                           */
 
-Value255 &Value255::operator=( Value255 &&other ) noexcept
+template <typename LockPolicy, std::uint8_t InlineSize>
+BasicValue255<LockPolicy, InlineSize> &BasicValue255<LockPolicy, InlineSize>::operator=( BasicValue255 &&other ) noexcept
 {
     SpinGuard guard( *this, other );
     // [===> Follows: Locked]
@@ -74,59 +77,48 @@ Value255 &Value255::operator=( Value255 &&other ) noexcept
     return *this;
 }
 
-bool Value255::operator==( Value255 const &other ) const noexcept
+template <typename LockPolicy, std::uint8_t InlineSize>
+bool BasicValue255<LockPolicy, InlineSize>::operator==( BasicValue255 const &other ) const noexcept
 {
-    SpinGuard guard( *this, other );
-    // [===> Follows: Locked]
-
     if ( this == &other ) { return true; }
     // [===> Follows: Not the same instance]
 
-    if ( size_ != other.size_ ) { return false; }
-    // [===> Follows: Sizes matched]
+    return readBoth( other, []( std::span<std::byte const> a, std::span<std::byte const> b ) noexcept
+    {
+        // [===> Follows: Both payloads are consistent]
 
-    if ( size_ == 0U ) { return true; }
-    // [===> Follows: Sizes present]
+        if ( a.size() != b.size() ) { return false; }
+        // [===> Follows: Sizes matched]
 
-    std::byte const *a = data_unlocked();
-    std::byte const *b = other.data_unlocked();
+        if ( a.empty() ) { return true; }
+        // [===> Follows: Sizes present]
 
-    return std::equal( a, a + size_, b );
+        // Note: `memcmp` compares whole words where it can, not byte by byte.
+        return std::memcmp( a.data(), b.data(), a.size() ) == 0;
+    } );
 }
 
-auto Value255::operator<=>( Value255 const &other ) const noexcept
+template <typename LockPolicy, std::uint8_t InlineSize>
+auto BasicValue255<LockPolicy, InlineSize>::operator<=>( BasicValue255 const &other ) const noexcept
     ->std::strong_ordering
 {
-    SpinGuard guard( *this, other );
-    // [===> Follows: Locked]
-
     if ( this == &other ) { return std::strong_ordering::equal; }
     // [===> Follows: Not the same instance]
 
-    if ( size_ < other.size_ ) { return std::strong_ordering::less; }
-    if ( size_ > other.size_ ) { return std::strong_ordering::greater; }
-    // [===> Follows: Sizes matched]
+    return readBoth( other, []( std::span<std::byte const> a, std::span<std::byte const> b ) noexcept
+    {
+        // [===> Follows: Both payloads are consistent]
 
-    if (size_ == 0) { return std::strong_ordering::equal; }
-    // [===> Follows: Sizes present]
+        if ( a.size() < b.size() ) { return std::strong_ordering::less; }
+        if ( a.size() > b.size() ) { return std::strong_ordering::greater; }
+        // [===> Follows: Sizes matched]
 
-    std::byte const *a = data_unlocked();
-    std::byte const *b = other.data_unlocked();
+        if ( a.empty() ) { return std::strong_ordering::equal; }
+        // [===> Follows: Sizes present]
 
-    return std::lexicographical_compare_three_way(
-        a, a + size_,
-        b, b + other.size_,
-        std::compare_three_way()
-    );
-}
-
-namespace value
-{
-    std::ostream &operator<<( std::ostream &os, Value255 const &v ) noexcept
-    {
-        os << v.str();
-        return os;
-    }
+        // Note: `memcmp` orders as unsigned bytes, the same as `std::byte`.
+        return std::memcmp( a.data(), b.data(), a.size() ) <=> 0;
+    } );
 }
 
 /* #endregion */// Operators
@@ -135,47 +127,44 @@ namespace value
 /* ^\__________________________________________ */
 /* #region Public methods.                      */
 
-std::vector<std::byte> Value255::bytes() const noexcept
+template <typename LockPolicy, std::uint8_t InlineSize>
+std::vector<std::byte> BasicValue255<LockPolicy, InlineSize>::bytes() const noexcept
 {
-    SpinGuard guard( *this );
-    // [===> Follows: Locked]
-
-    std::vector<std::byte> out;
-    out.reserve( size_ );
-
-    if ( isHeapAllocated() )
-    {
-        std::byte *ptr = heapPointerAsByte();
-        out.insert( out.end(), ptr, ptr + size_ );
-    }
-    else
+    return read( []( std::span<std::byte const> bytes ) noexcept
     {
-        out.insert( out.end(), raw_data_, raw_data_ + size_ );
-    }
-
-    return out;
+        return std::vector<std::byte>( bytes.begin(), bytes.end() );
+    } );
 }
 
-std::string Value255::str() const noexcept
+template <typename LockPolicy, std::uint8_t InlineSize>
+std::optional<std::uint8_t> BasicValue255<LockPolicy, InlineSize>::copyTo( std::span<std::byte> out ) const noexcept
 {
-    SpinGuard guard( *this );
-    // [===> Follows: Locked]
+    return read( [out]( std::span<std::byte const> bytes ) noexcept
+        -> std::optional<std::uint8_t>
+    {
+        if ( out.size() < bytes.size() ) { return std::nullopt; }
+        // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on too small buffer!! ]
+        // [===> Follows: Buffer is large enough]
 
-    std::byte const *ptr = data_unlocked();
-    std::ostringstream oss;
+        std::memcpy( out.data(), bytes.data(), bytes.size() );
 
-    oss << "[ ";
+        return static_cast<std::uint8_t>( bytes.size() );
+    } );
+}
 
-    for ( uint8_t i = 0; i < size_; i++ )
+template <typename LockPolicy, std::uint8_t InlineSize>
+std::string BasicValue255<LockPolicy, InlineSize>::str() const noexcept
+{
+    return read( []( std::span<std::byte const> bytes ) noexcept
     {
-        oss << std::format( "0x{:02X}", static_cast<unsigned>( ptr[i] ) );
-
-        if ( i + 1 < size_ ) oss << ' ';
-    }
+        // Note: "[ " + "0xHH " per byte + " ]", the last byte without a separator.
+        std::string str;
+        str.reserve( 4U + 5U * bytes.size() );
 
-    oss << " ]";
+        detail::writeHex( std::back_inserter( str ), bytes );
 
-    return oss.str();
+        return str;
+    } );
 }
 
 /* #endregion */// Public methods
@@ -184,7 +173,8 @@ std::string Value255::str() const noexcept
 /* ^\__________________________________________ */
 /* #region Protected methods.                   */
 
-bool Value255::set( std::byte const *data, std::uint8_t size ) noexcept
+template <typename LockPolicy, std::uint8_t InlineSize>
+bool BasicValue255<LockPolicy, InlineSize>::set( std::byte const *data, std::uint8_t size ) noexcept
 {
     SetResult ret = setEx( data, size );
 
@@ -192,7 +182,8 @@ bool Value255::set( std::byte const *data, std::uint8_t size ) noexcept
         || ( ret == SetResult::NoChange );
 }
 
-Value255::SetResult Value255::setEx( std::byte const *data, std::uint8_t size ) noexcept
+template <typename LockPolicy, std::uint8_t InlineSize>
+SetResult BasicValue255<LockPolicy, InlineSize>::setEx( std::byte const *data, std::uint8_t size ) noexcept
 {
     // [===> Prerequisite: This instance is locked]
 
@@ -204,13 +195,10 @@ Value255::SetResult Value255::setEx( std::byte const *data, std::uint8_t size )
     // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on invalid parameters!! ]
     // [===> Follows: All parameters are valid]
 
-    if ( size_ == size )
+    if ( ( size_ == size ) &&
+         ( ( size == 0U ) || ( std::memcmp( data_unlocked(), data, size ) == 0 ) ) )
     {
-        void *current = heapPointerAsVoid();
-        if ( memcmp( current, data, size ) == 0 )
-        {
-            return SetResult::NoChange;
-        }
+        return SetResult::NoChange;
     }
     // [===> Follows: Data is different]
 
@@ -224,18 +212,30 @@ Value255::SetResult Value255::setEx( std::byte const *data, std::uint8_t size )
     }
     else // [!! Caution !!]__  Contains early returns.  __[!! Caution !!]
     {
-        if ( size > size_ ) // Note: Allocate or reallocate.
+        if constexpr ( !LockPolicy::HEAP_PAYLOAD ) { return SetResult::OutOfMemory; }
+        // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on a policy without heap payloads!! ]
+
+        // Note: Allocate or reallocate unless the current block can be reused.
+        if ( !isHeapAllocated() || !PayloadAllocator::canReuse( size_, size ) )
         {
+            if ( isHeapAllocated() ) { Stats::onReallocate(); }
+
             cleanup();
             // [===> Follows: All resources were released and cleared]
 
-            void* p = heap_caps_malloc( size, MALLOC_CAP_DEFAULT );
+            void* p = PayloadAllocator::allocate( size );
             if ( !p ) { return SetResult::OutOfMemory; }
             // ~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on allocation failure!! ]
             // [===> Follows: Heap memory reallocated]
 
+            Stats::onAllocate( size );
+
             std::uintptr_t addr = reinterpret_cast<std::uintptr_t>( p );
-            std::memcpy( raw_data_, &addr, INLINE_SIZE );
+            std::memcpy( raw_data_, &addr, POINTER_SIZE );
+        }
+        else
+        {
+            Stats::onResize( size_, size );
         }
         // [===> Follows: Heap memory allocation completed]
 
@@ -249,7 +249,7 @@ Value255::SetResult Value255::setEx( std::byte const *data, std::uint8_t size )
     return SetResult::Success;
 }
 
-static_assert( sizeof( std::uintptr_t ) == 4U, "The `uintptr_t` must be 4 bytes." );
+static_assert( sizeof( std::uintptr_t ) == 4U, "The `uintptr_t` must be 4 bytes." ); // Note: See `POINTER_SIZE`.
 
 /* #endregion */// Protected methods
 
@@ -257,13 +257,15 @@ static_assert( sizeof( std::uintptr_t ) == 4U, "The `uintptr_t` must be 4 bytes.
 /* ^\__________________________________________ */
 /* #region Private methods.                     */
 
-void Value255::cleanup() noexcept
+template <typename LockPolicy, std::uint8_t InlineSize>
+void BasicValue255<LockPolicy, InlineSize>::cleanup() noexcept
 {
     // [===> Prerequisite: This instance is locked]
 
     if ( isHeapAllocated() )
     {
-        heap_caps_free( heapPointerAsVoid() );
+        PayloadAllocator::deallocate( heapPointerAsVoid(), size_ );
+        Stats::onFree( size_ );
     }
     // [===> Follows: This instance has no heap memory]
 
@@ -274,7 +276,8 @@ void Value255::cleanup() noexcept
     // [===> Follows: This instance has no size]
 }
 
-void Value255::moveFrom( Value255 &&other ) noexcept
+template <typename LockPolicy, std::uint8_t InlineSize>
+void BasicValue255<LockPolicy, InlineSize>::moveFrom( BasicValue255 &&other ) noexcept
 {
     // [===> Prerequisite: This and other instance are locked]
     // [===> Prerequisite: This instance has no heap memory]
@@ -292,13 +295,34 @@ void Value255::moveFrom( Value255 &&other ) noexcept
     // [===> Follows: Other instance has no size]
 }
 
-std::uintptr_t Value255::heapPointer() const noexcept
+template <typename LockPolicy, std::uint8_t InlineSize>
+std::uintptr_t BasicValue255<LockPolicy, InlineSize>::heapPointer() const noexcept
 {
     std::uintptr_t ptr = 0;
 
-    std::memcpy( &ptr, raw_data_, INLINE_SIZE );
+    std::memcpy( &ptr, raw_data_, POINTER_SIZE );
 
     return ptr;
 }
 
 /* #endregion */// Private methods
+
+
+/* ^\__________________________________________ */
+/* #region Explicit instantiations.             */
+
+#define VALUE255_INSTANTIATE( LOCK_POLICY ) \
+    template class value::BasicValue255<LOCK_POLICY, 4U>; \
+    template class value::BasicValue255<LOCK_POLICY, 12U>; \
+    template class value::BasicValue255<LOCK_POLICY, 16U>;
+
+VALUE255_INSTANTIATE( lock::SpinLock )
+VALUE255_INSTANTIATE( lock::SeqLock )
+VALUE255_INSTANTIATE( lock::NoLock )
+#if !CONFIG_IDF_TARGET_LINUX
+VALUE255_INSTANTIATE( lock::CriticalSection )
+#endif
+
+#undef VALUE255_INSTANTIATE
+
+/* #endregion */// Explicit instantiations
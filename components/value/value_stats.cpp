@@ -0,0 +1,97 @@
+/* Self */
+#include <value_stats.hpp>
+
+/* C++ Standard Library */
+#include <cinttypes>
+
+/* ESP-IDF */
+#include <esp_log.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/timers.h>
+
+/* ^\__________________________________________ */
+/* Namespaces.                                  */
+using namespace value;
+
+
+/* ^\__________________________________________ */
+/* #region Private types, functions.            */
+
+namespace
+{
+    constexpr char const *PERIODIC_TAG = "value255";
+
+    TimerHandle_t periodic_timer = nullptr;
+
+    void onPeriodicTimer( TimerHandle_t ) noexcept
+    {
+        Stats::log( PERIODIC_TAG );
+    }
+
+} // namespace
+
+/* #endregion */// Private types, functions.
+
+
+/* ^\__________________________________________ */
+/* #region Public methods.                      */
+
+Stats::Snapshot Stats::snapshot() noexcept
+{
+#if CONFIG_VALUE255_STATS_ENABLE
+    return Snapshot{ liveBytes_.load( std::memory_order_relaxed )
+                   , peakBytes_.load( std::memory_order_relaxed )
+                   , allocations_.load( std::memory_order_relaxed )
+                   , frees_.load( std::memory_order_relaxed )
+                   , reallocations_.load( std::memory_order_relaxed )
+                   , contentions_.load( std::memory_order_relaxed )
+                   , spins_.load( std::memory_order_relaxed ) };
+#else
+    return Snapshot{};
+#endif
+}
+
+void Stats::resetPeak() noexcept
+{
+#if CONFIG_VALUE255_STATS_ENABLE
+    peakBytes_.store( liveBytes_.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+#endif
+}
+
+void Stats::log( [[maybe_unused]] char const *tag ) noexcept
+{
+    if constexpr ( !ENABLED ) { return; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on disabled statistics!! ]
+
+    Snapshot const s = snapshot();
+
+    ESP_LOGI( tag, "live=%" PRIu32 " peak=%" PRIu32 " allocs=%" PRIu32 " frees=%" PRIu32
+                   " reallocs=%" PRIu32 " contentions=%" PRIu32 " spins=%" PRIu32
+            , s.liveBytes, s.peakBytes, s.allocations, s.frees
+            , s.reallocations, s.contentions, s.spins );
+}
+
+bool Stats::startPeriodicLog( std::uint32_t period_ms ) noexcept
+{
+    if ( !ENABLED || ( period_ms == 0U ) ) { return false; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on invalid parameters!! ]
+
+    stopPeriodicLog();
+
+    periodic_timer = xTimerCreate( PERIODIC_TAG, pdMS_TO_TICKS( period_ms ), pdTRUE, nullptr, &onPeriodicTimer );
+    if ( periodic_timer == nullptr ) { return false; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on allocation failure!! ]
+
+    return xTimerStart( periodic_timer, 0U ) == pdPASS;
+}
+
+void Stats::stopPeriodicLog() noexcept
+{
+    if ( periodic_timer == nullptr ) { return; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on no timer!! ]
+
+    xTimerDelete( periodic_timer, portMAX_DELAY );
+    periodic_timer = nullptr;
+}
+
+/* #endregion */// Public methods.
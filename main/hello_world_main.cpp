@@ -1,32 +1,71 @@
-/* Minimal task-based app_main
- * This file now contains a small FreeRTOS task that repeatedly calls
- * processing_loop(). The original example was removed per user request.
+/* Event-driven app_main
+ * Logs a few example specs once, then starts the property pipeline
+ * (see pipeline.hpp), which only runs when bytes are received.
  */
 
 #include "sdkconfig.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_log.h"
+#include "pipeline.hpp"
+#include <change_ring.hpp>
+#include <diag_log.hpp>
+#include <flash_snapshot.hpp>
 #include <format.hpp>
+#include <format_util.hpp>
 #include <permission.hpp>
+#include <property_codec.hpp>
+#include <property_table.hpp>
 #include <resolution.hpp>
 #include <spec.hpp>
+#include <spec_format.hpp>
+#include <table_snapshot.hpp>
 #include <value.hpp>
+#include <value255_format.hpp>
 #include <optional>
 #include <bit>
 #include <span>
 #include <array>
 #include <cstdint>
+#include <cstdio>
 #include <cstring>
 #include <string>
 
 static const char* TAG = "app_main";
 
+#if CONFIG_APP_DEFERRED_DIAG_LOG
+// Tag id of the records logged by this file
+static constexpr std::uint16_t DIAG_TAG = 1U;
+
+static machine::DiagLog *diagLog = nullptr;
+
+// prints each record as one "DLOG,<hex>" line, on the drain task
+static void print_record( std::span<std::byte const> record, void * ) noexcept
+{
+    std::array<char, 2U * machine::DiagLog::RECORD_SIZE + 1U> hex;
+    std::size_t n = 0U;
+    for ( std::byte b : record )
+    {
+        hex[n++] = value::detail::HEX_DIGITS[std::to_integer<std::uint8_t>( b ) >> 4U];
+        hex[n++] = value::detail::HEX_DIGITS[std::to_integer<std::uint8_t>( b ) & 0x0FU];
+    }
+    hex[n] = '\0';
+
+    std::printf( "DLOG,%s\n", hex.data() );
+}
+#endif
+
 static void logSpec( std::optional<machine::property::Spec> const &spec )
 {
     if ( spec.has_value() )
     {
-        ESP_LOGI( TAG, "Spec created: %s", spec->str().data() );
+#if CONFIG_APP_DEFERRED_DIAG_LOG
+        if ( diagLog && diagLog->log( DIAG_TAG, *spec ) ) return;
+        // Note: Falls back to the text below if the ring is full.
+#endif
+        // Note: Formatted on the stack, longer output is truncated.
+        std::array<char, 256U> buf;
+        ESP_LOGI( TAG, "Spec created: %s", util::formatTo( buf, "{}", *spec ).data() );
     }
     else
     {
@@ -34,11 +73,9 @@ static void logSpec( std::optional<machine::property::Spec> const &spec )
     }
 }
 
-// main processing method that runs inside the task's infinite loop
-static void processing_loop()
+// logs one spec of every format
+static void log_example_specs()
 {
-    // Minimal work: log a message once per loop iteration.
-    ESP_LOGI(TAG, "processing_loop iteration");
 
     using namespace machine::property;
 
@@ -107,66 +144,153 @@ static void processing_loop()
     }
 }
 
-// C++ class that owns the task and runs the processing loop
-class MainTask {
-public:
-    MainTask() = default;
-
-    // start the FreeRTOS task
-    bool start() {
-        BaseType_t res = xTaskCreate(
-            &MainTask::taskEntry,
-            "main_task",
-            stackSize_,
-            this,
-            tskIDLE_PRIORITY + 1,
-            &handle_);
-
-        return res == pdPASS;
-    }
-
-    // the method that runs repeatedly inside the task
-    void run() {
-        while (true) {
-            processing_loop();
-            vTaskDelay(pdMS_TO_TICKS(1000));
-        }
+// Unit and component of the example properties fed through the pipeline
+static constexpr machine::Address EXAMPLE_COMPONENT( 0U, 0U, 1U, 0U, 0U );
+
+// builds a table with one numeric property (code 1, 0 to 100)
+static std::optional<machine::PropertyTable> build_example_table()
+{
+    using namespace machine::property;
+
+    std::byte const init{ 50 }, min{ 0 }, max{ 100 };
+
+    auto spec = Spec::create( Permission::Kind::ReadWrite, &init, 1U, &min, 1U, &max, 1U );
+    if ( !spec.has_value() ) return std::nullopt;
+
+    auto property = machine::Property::create( 1U, std::move( *spec ) );
+    if ( !property.has_value() ) return std::nullopt;
+
+    machine::PropertyTable::Builder builder;
+    builder.add( machine::Address( 0U, 0U, 1U, 0U, 1U ), std::move( *property ) );
+    return builder.build();
+}
+
+// Consumers of the changed properties; `flash` is null unless enabled
+struct Publishers
+{
+    machine::TableSnapshot *snapshot;
+    machine::FlashSnapshot *flash;
+};
+
+// called from the publish task with the properties a batch changed
+static void publish_changes( machine::PropertyTable const &table
+                           , std::span<std::size_t const> changed
+                           , void *context ) noexcept
+{
+    auto *publishers = static_cast<Publishers *>( context );
+
+    // Note: Readers on other tasks see the whole batch at once via `acquire()`.
+    if ( !publishers->snapshot->publish( table, changed ) ) {
+        ESP_LOGW(TAG, "Snapshot busy; changes follow with the next batch");
     }
 
-    // optional: stop would delete/notify, not used in embedded example
-    void stop() {
-        if (handle_) {
-            vTaskDelete(handle_);
-            handle_ = nullptr;
+    // Note: Rate-limited; most calls only count the changes.
+    if ( publishers->flash ) {
+        publishers->flash->refreshed( changed );
+        if ( publishers->flash->save() ) {
+            ESP_LOGI(TAG, "Flash snapshot %u written", static_cast<unsigned>( publishers->flash->generation() ));
         }
     }
 
-private:
-    static void taskEntry(void* param) {
-        auto self = static_cast<MainTask*>(param);
-        if (self) self->run();
-        // Never returns
-        vTaskDelete(nullptr);
+    for ( std::size_t index : changed )
+    {
+        std::array<char, 128U> buf;
+        ESP_LOGI( TAG, "Changed: %s", util::formatTo( buf, "{}", table.at( index ).value() ).data() );
     }
+}
 
-    static constexpr size_t stackSize_ = 4096;
-    TaskHandle_t handle_ = nullptr;
-};
+#if CONFIG_APP_CHANGE_EVENTS
+// drains the change ring; stands in for an MQTT or UART exporter
+static void export_changes( void *context )
+{
+    auto *ring = static_cast<machine::ChangeRing *>( context );
+    std::array<std::size_t, 8U> missed;
+    std::array<char, 128U> buf;
+
+    while ( true )
+    {
+        ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+        while ( auto const event = ring->pop() ) {
+            ESP_LOGI( TAG, "Event %016llx @%lu: %s%s"
+                    , static_cast<unsigned long long>( event->key )
+                    , static_cast<unsigned long>( event->tick )
+                    , util::formatTo( buf, "{}", value::detail::HexBytes{ event->bytes() } ).data()
+                    , event->complete ? "" : "..." );
+        }
+
+        // Note: Events lost to a full ring; send the current values instead.
+        std::size_t n;
+        while ( ( n = ring->takeMissed( missed ) ) > 0U ) {
+            ESP_LOGW( TAG, "Resync of %u properties", static_cast<unsigned>( n ) );
+        }
+    }
+}
+#endif
 
 extern "C" void app_main()
 {
-    // Mutex::create(); // Example usage of Mutex class
+#if CONFIG_APP_DEFERRED_DIAG_LOG
+    diagLog = new machine::DiagLog( machine::DiagLog::Config{ &print_record, nullptr } );
+    if ( !diagLog || !diagLog->start() ) {
+        ESP_LOGW(TAG, "Failed to start the diagnostics log; logging text");
+        delete diagLog;
+        diagLog = nullptr;
+    }
+#endif
+
+    log_example_specs();
 
-    auto task = new MainTask();
-    if (!task) {
-        ESP_LOGE(TAG, "Out of memory: cannot allocate MainTask");
+    auto built = build_example_table();
+    if ( !built.has_value() ) {
+        ESP_LOGE(TAG, "Failed to build the property table");
         return;
     }
 
-    if (!task->start()) {
-        ESP_LOGE(TAG, "Failed to create main_task");
-        // cleanup if needed
-        delete task;
+    // Note: All live for the lifetime of the application.
+    auto *table = new machine::PropertyTable( std::move( *built ) );
+    auto *publishers = new Publishers{ new machine::TableSnapshot( *table ), nullptr };
+
+#if CONFIG_APP_FLASH_SNAPSHOT
+    // Note: Serves the values of the previous run until the machine sends fresh ones.
+    publishers->flash = new machine::FlashSnapshot( *table, machine::FlashSnapshot::Config{
+        "propsnap", pdMS_TO_TICKS( CONFIG_APP_FLASH_SNAPSHOT_INTERVAL_S * 1000U ), true } );
+    if ( !publishers->flash->open() ) {
+        ESP_LOGW(TAG, "No \"propsnap\" partition; values start cold");
+        delete publishers->flash;
+        publishers->flash = nullptr;
+    } else if ( auto const cached = publishers->flash->cached( 0U ) ) {
+        std::array<char, 128U> buf;
+        ESP_LOGI( TAG, "Warm value: %s", util::formatTo( buf, "{}", value::detail::HexBytes{ *cached } ).data() );
+    }
+#endif
+
+#if CONFIG_APP_CHANGE_EVENTS
+    // Note: The apply stage of the pipeline is the only writer of the table, i.e. the single producer.
+    auto *ring = new machine::ChangeRing( *table );
+    TaskHandle_t exporter = nullptr;
+    if ( xTaskCreate( &export_changes, "export", 3072, ring, 2, &exporter ) == pdPASS ) {
+        ring->setConsumer( exporter );
+        ring->trackAll();
+    } else {
+        ESP_LOGW(TAG, "Failed to start the export task; no change events");
     }
-    // intentionally not deleting `task` here — typical embedded apps keep it alive
+#endif
+
+    auto *pipeline = new app::Pipeline( app::Pipeline::Config{ table, EXAMPLE_COMPONENT, &publish_changes, publishers } );
+    if ( !pipeline->start() ) {
+        ESP_LOGE(TAG, "Failed to start the pipeline");
+        return;
+    }
+
+    // Loopback example: feed one update as a transport would.
+    std::byte const next{ 75 };
+    auto value = machine::property::Value::create( &next, 1U );
+    if ( !value.has_value() ) return;
+    auto update = machine::Property::create( 1U, table->at( 0U ).spec().clone(), std::move( *value ) );
+    if ( !update.has_value() ) return;
+
+    std::array<std::byte, machine::PropertyCodec::MAX_FRAME_SIZE> frame;
+    std::size_t const size = machine::PropertyCodec::encode( *update, frame );
+    pipeline->receive( std::span<std::byte const>( frame.data(), size ), portMAX_DELAY );
 }
@@ -0,0 +1,403 @@
+/* Self */
+#include "pipeline.hpp"
+
+/* C++ Standard Library */
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+
+/* ESP-IDF */
+#include <esp_log.h>
+#include <esp_timer.h>
+
+/* ^\__________________________________________ */
+/* Namespaces.                                  */
+using namespace app;
+using namespace machine;
+
+
+/* ^\__________________________________________ */
+/* #region Private types, functions.            */
+
+namespace
+{
+    constexpr char const *TAG = "pipeline";
+
+    /** @brief Bytes read from the stream buffer at once. */
+    constexpr std::size_t RX_CHUNK_SIZE = 64U;
+
+    /** @brief Weight of a new sample in the moving average, as a shift (1/8). */
+    constexpr std::uint32_t LATENCY_AVG_SHIFT = 3U;
+
+    constexpr std::array<char const *, Pipeline::STAGE_COUNT> STAGE_NAMES =
+    {
+        "decode", "validate", "apply", "publish",
+    };
+
+    struct Placement
+    {
+        UBaseType_t priority;
+        BaseType_t core;
+    };
+
+    constexpr BaseType_t coreOf( int core ) noexcept
+    {
+        return ( core < 0 ) ? tskNO_AFFINITY : static_cast<BaseType_t>( core );
+    }
+
+    constexpr std::array<Placement, Pipeline::STAGE_COUNT> PLACEMENTS =
+    {
+        Placement{ CONFIG_PIPELINE_DECODE_PRIORITY,   coreOf( CONFIG_PIPELINE_DECODE_CORE ) },
+        Placement{ CONFIG_PIPELINE_VALIDATE_PRIORITY, coreOf( CONFIG_PIPELINE_VALIDATE_CORE ) },
+        Placement{ CONFIG_PIPELINE_APPLY_PRIORITY,    coreOf( CONFIG_PIPELINE_APPLY_CORE ) },
+        Placement{ CONFIG_PIPELINE_PUBLISH_PRIORITY,  coreOf( CONFIG_PIPELINE_PUBLISH_CORE ) },
+    };
+
+    void raiseTo( std::atomic<std::uint32_t> &max, std::uint32_t v ) noexcept
+    {
+        // Note: Single writer per counter, so a plain compare is enough.
+        if ( v > max.load( std::memory_order_relaxed ) ) { max.store( v, std::memory_order_relaxed ); }
+    }
+
+} // namespace
+
+/* #endregion */// Private types, functions.
+
+
+/* ^\__________________________________________ */
+/* #region Constructors.                        */
+
+Pipeline::Pipeline( Config const &config ) noexcept
+    : config_( config )
+{ /* Do nothing */ }
+
+Pipeline::~Pipeline() noexcept
+{
+    for ( TaskHandle_t &task : tasks_ )
+    {
+        if ( task ) { vTaskDelete( task ); task = nullptr; }
+    }
+
+    for ( QueueHandle_t &queue : queues_ )
+    {
+        if ( queue ) { vQueueDelete( queue ); queue = nullptr; }
+    }
+
+    if ( rx_ ) { vStreamBufferDelete( rx_ ); rx_ = nullptr; }
+}
+
+/* #endregion */// Constructors
+
+
+/* ^\__________________________________________ */
+/* #region Public methods.                      */
+
+bool Pipeline::start() noexcept
+{
+    if ( !config_.table ) { return false; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on missing table!! ]
+
+    rx_ = xStreamBufferCreate( CONFIG_PIPELINE_RX_BUFFER_SIZE, 1U );
+    if ( !rx_ ) { return false; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on allocation failure!! ]
+
+    for ( QueueHandle_t &queue : queues_ )
+    {
+        queue = xQueueCreate( BATCH_COUNT, sizeof( Batch * ) );
+        if ( !queue ) { return false; }
+        // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on allocation failure!! ]
+    }
+
+    for ( Batch &batch : batches_ )
+    {
+        Batch *p = &batch;
+        xQueueSend( queues_[0], &p, 0U );
+    }
+    // [===> Follows: All batches are free]
+
+    for ( std::size_t i = 0U; i < STAGE_COUNT; i++ )
+    {
+        stageTasks_[i] = StageTask{ this, static_cast<Stage>( i ) };
+
+        BaseType_t const res = xTaskCreatePinnedToCore(
+            ( i == 0U ) ? &Pipeline::decodeEntry : &Pipeline::stageEntry,
+            STAGE_NAMES[i],
+            CONFIG_PIPELINE_TASK_STACK_SIZE,
+            &stageTasks_[i],
+            PLACEMENTS[i].priority,
+            &tasks_[i],
+            PLACEMENTS[i].core );
+
+        if ( res != pdPASS ) { return false; }
+        // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on allocation failure!! ]
+    }
+
+    return true;
+}
+
+std::size_t Pipeline::receive( std::span<std::byte const> bytes, TickType_t wait ) noexcept
+{
+    std::size_t const accepted = xStreamBufferSend( rx_, bytes.data(), bytes.size(), wait );
+
+    receivedBytes_.fetch_add( accepted, std::memory_order_relaxed );
+    rejectedBytes_.fetch_add( bytes.size() - accepted, std::memory_order_relaxed );
+    raiseTo( countersOf( Stage::Decode ).maxDepth
+           , static_cast<std::uint32_t>( xStreamBufferBytesAvailable( rx_ ) ) );
+
+    return accepted;
+}
+
+Pipeline::Stats Pipeline::stats() const noexcept
+{
+    Stats s {};
+    s.receivedBytes = receivedBytes_.load( std::memory_order_relaxed );
+    s.rejectedBytes = rejectedBytes_.load( std::memory_order_relaxed );
+
+    for ( std::size_t i = 0U; i < STAGE_COUNT; i++ )
+    {
+        StageCounters const &c = counters_[i];
+
+        s.stages[i] = StageStats{ c.batches.load( std::memory_order_relaxed )
+                                , c.items.load( std::memory_order_relaxed )
+                                , c.dropped.load( std::memory_order_relaxed )
+                                , c.stalls.load( std::memory_order_relaxed )
+                                , c.maxDepth.load( std::memory_order_relaxed )
+                                , c.avgLatencyUs.load( std::memory_order_relaxed )
+                                , c.maxLatencyUs.load( std::memory_order_relaxed ) };
+    }
+
+    return s;
+}
+
+void Pipeline::logStats() const noexcept
+{
+    Stats const s = stats();
+
+    ESP_LOGI( TAG, "rx=%" PRIu32 " rejected=%" PRIu32, s.receivedBytes, s.rejectedBytes );
+
+    for ( std::size_t i = 0U; i < STAGE_COUNT; i++ )
+    {
+        StageStats const &st = s.stages[i];
+
+        ESP_LOGI( TAG, "%-8s batches=%" PRIu32 " items=%" PRIu32 " dropped=%" PRIu32
+                       " stalls=%" PRIu32 " depth<=%" PRIu32 " avg=%" PRIu32 "us max=%" PRIu32 "us"
+                , STAGE_NAMES[i], st.batches, st.items, st.dropped
+                , st.stalls, st.maxDepth, st.avgLatencyUs, st.maxLatencyUs );
+    }
+}
+
+/* #endregion */// Public methods.
+
+
+/* ^\__________________________________________ */
+/* #region Private methods.                     */
+
+bool Pipeline::Batch::append( std::uint8_t code, std::span<std::byte const> value ) noexcept
+{
+    if ( ( count == BATCH_ITEMS ) || ( value.size() > BATCH_BYTES - used ) ) { return false; }
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  [ Early return on full batch!! ]
+
+    items[count++] = Item{ 0U, used, code, static_cast<std::uint8_t>( value.size() ), false, false };
+    std::memcpy( bytes.data() + used, value.data(), value.size() );
+    used = static_cast<std::uint16_t>( used + value.size() );
+
+    return true;
+}
+
+void Pipeline::decodeEntry( void *param ) noexcept
+{
+    static_cast<StageTask *>( param )->self->decodeLoop();
+}
+
+void Pipeline::stageEntry( void *param ) noexcept
+{
+    auto const *task = static_cast<StageTask *>( param );
+    task->self->stageLoop( task->stage );
+}
+
+void Pipeline::decodeLoop() noexcept
+{
+    StageCounters &counters = countersOf( Stage::Decode );
+    std::array<std::byte, RX_CHUNK_SIZE> chunk;
+    Batch *batch = nullptr;
+
+    while ( true )
+    {
+        // Note: Block while idle; once a batch is open, only drain what is already there.
+        TickType_t const wait = batch ? 0U : portMAX_DELAY;
+        std::size_t const n = xStreamBufferReceive( rx_, chunk.data(), chunk.size(), wait );
+
+        if ( n == 0U )
+        {
+            if ( batch ) { forward( Stage::Decode, batch ); batch = nullptr; }
+            continue;
+        }
+        // [===> Follows: Input drained, the open batch was dispatched]
+
+        std::span<std::byte const> input( chunk.data(), n );
+
+        while ( !input.empty() )
+        {
+            auto const r = decoder_.feed( input );
+            input = input.subspan( r.consumed );
+
+            if ( r.status == PropertyCodec::Decoder::Status::Error )
+            {
+                counters.dropped.fetch_add( 1U, std::memory_order_relaxed );
+                continue;
+            }
+
+            if ( r.status != PropertyCodec::Decoder::Status::Frame ) { continue; }
+
+            if ( !r.frame.hasValue )
+            {
+                counters.dropped.fetch_add( 1U, std::memory_order_relaxed ); // Note: Spec-only frame.
+                continue;
+            }
+
+            if ( batch && !batch->append( r.frame.code, r.frame.value ) )
+            {
+                forward( Stage::Decode, batch );
+                batch = nullptr;
+            }
+
+            if ( !batch )
+            {
+                batch = acquireBatch();
+                static_cast<void>( batch->append( r.frame.code, r.frame.value ) ); // Note: Always fits an empty batch.
+            }
+        }
+    }
+}
+
+void Pipeline::stageLoop( Stage stage ) noexcept
+{
+    QueueHandle_t const input = inputOf( stage );
+
+    while ( true )
+    {
+        Batch *batch = nullptr;
+        if ( xQueueReceive( input, &batch, portMAX_DELAY ) != pdTRUE ) { continue; }
+
+        switch ( stage )
+        {
+        case Stage::Validate: validate( *batch ); break;
+        case Stage::Apply:    apply( *batch );    break;
+        case Stage::Publish:  publish( *batch );  break;
+        default:                                  break;
+        }
+
+        record( stage, *batch );
+        forward( stage, batch );
+    }
+}
+
+void Pipeline::validate( Batch &batch ) noexcept
+{
+    StageCounters &counters = countersOf( Stage::Validate );
+    Address const &c = config_.component;
+
+    for ( Item &item : std::span( batch.items ).first( batch.count ) )
+    {
+        Address const address( c.unitKind(), c.unitIndex(), c.componentCode(), c.componentIndex(), item.code );
+        auto const index = config_.table->indexOf( address );
+
+        item.accepted = index.has_value()
+                     && config_.table->isWithinRange( index.value(), batch.payload( item ) );
+
+        if ( !item.accepted )
+        {
+            counters.dropped.fetch_add( 1U, std::memory_order_relaxed );
+            continue;
+        }
+
+        item.index = index.value();
+    }
+}
+
+void Pipeline::apply( Batch &batch ) noexcept
+{
+    StageCounters &counters = countersOf( Stage::Apply );
+
+    for ( Item &item : std::span( batch.items ).first( batch.count ) )
+    {
+        if ( !item.accepted ) { continue; }
+
+        std::span<std::byte const> const value = batch.payload( item );
+        item.changed = ( config_.table->set( item.index, value.data(), item.size ) == value::SetResult::Success );
+
+        if ( !item.changed ) { counters.dropped.fetch_add( 1U, std::memory_order_relaxed ); }
+    }
+}
+
+void Pipeline::publish( Batch &batch ) noexcept
+{
+    std::array<std::size_t, BATCH_ITEMS> changed;
+    std::size_t n = 0U;
+
+    for ( Item const &item : std::span( batch.items ).first( batch.count ) )
+    {
+        if ( item.changed ) { changed[n++] = item.index; }
+    }
+
+    if ( ( n > 0U ) && config_.publish )
+    {
+        config_.publish( *config_.table, std::span<std::size_t const>( changed.data(), n ), config_.context );
+    }
+}
+
+Pipeline::Batch *Pipeline::acquireBatch() noexcept
+{
+    Batch *batch = nullptr;
+
+    if ( xQueueReceive( queues_[0], &batch, 0U ) != pdTRUE )
+    {
+        countersOf( Stage::Decode ).stalls.fetch_add( 1U, std::memory_order_relaxed );
+        xQueueReceive( queues_[0], &batch, portMAX_DELAY );
+    }
+    // [===> Follows: A free batch, possibly after waiting for publish to return one]
+
+    batch->count = 0U;
+    batch->used = 0U;
+    batch->stampUs = esp_timer_get_time();
+
+    return batch;
+}
+
+void Pipeline::forward( Stage from, Batch *batch ) noexcept
+{
+    if ( from == Stage::Decode ) { record( Stage::Decode, *batch ); }
+
+    std::size_t const next = ( static_cast<std::size_t>( from ) + 1U ) % STAGE_COUNT;
+    // [===> Follows: `Publish` hands the batch back to the free queue]
+
+    batch->stampUs = esp_timer_get_time();
+    xQueueSend( queues_[next], &batch, portMAX_DELAY ); // Note: Never blocks; every queue holds all batches.
+
+    if ( next != 0U )
+    {
+        raiseTo( countersOf( static_cast<Stage>( next ) ).maxDepth
+               , static_cast<std::uint32_t>( uxQueueMessagesWaiting( queues_[next] ) ) );
+    }
+}
+
+void Pipeline::record( Stage stage, Batch const &batch ) noexcept
+{
+    StageCounters &counters = countersOf( stage );
+    auto const latency = static_cast<std::uint32_t>( esp_timer_get_time() - batch.stampUs );
+
+    counters.batches.fetch_add( 1U, std::memory_order_relaxed );
+    counters.items.fetch_add( batch.count, std::memory_order_relaxed );
+    raiseTo( counters.maxLatencyUs, latency );
+
+    std::uint32_t const avg = counters.avgLatencyUs.load( std::memory_order_relaxed );
+    counters.avgLatencyUs.store( avg - ( avg >> LATENCY_AVG_SHIFT ) + ( latency >> LATENCY_AVG_SHIFT )
+                               , std::memory_order_relaxed );
+}
+
+QueueHandle_t Pipeline::inputOf( Stage stage ) const noexcept
+{
+    return queues_[static_cast<std::size_t>( stage )];
+}
+
+/* #endregion */// Private methods.
@@ -0,0 +1,284 @@
+#pragma once
+
+/* C++ Standard Library */
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+/* Custom Library */
+#include <address.hpp>
+#include <property_codec.hpp>
+#include <property_table.hpp>
+
+/* ESP-IDF */
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/stream_buffer.h>
+#include <freertos/task.h>
+#include <sdkconfig.h>
+
+namespace app
+{
+
+    /** @brief Event-driven property update pipeline. */
+    /**
+     * @details
+     * Received bytes flow through four tasks, each woken only when there is
+     * work for it:
+     *
+     * \code{.unparsed}
+     * receive() --[stream buffer]--> decode --[queue]--> validate
+     *           --[queue]--> apply --[queue]--> publish --[free queue]--+
+     *                          ^                                        |
+     *                          +----------- batches are recycled -------+
+     * \endcode
+     *
+     * | Stage    | Work                                                        |
+     * | -------- | ----------------------------------------------------------- |
+     * | decode   | `PropertyCodec::Decoder` turns bytes into value updates     |
+     * | validate | resolves the property and checks `Spec::isWithinRange()`    |
+     * | apply    | `PropertyTable::set()`, which also raises the dirty bit     |
+     * | publish  | hands the indices of changed properties to `Config::publish`|
+     *
+     * Stages exchange pointers to a fixed set of `CONFIG_PIPELINE_BATCH_COUNT`
+     * batches, so nothing is allocated after `start()` and no update is
+     * copied between stages. A batch is dispatched as soon as the input is
+     * drained or it is full, so latency is bounded by processing, not by a
+     * polling period.
+     *
+     * @par Backpressure:
+     * The batches are the only credit in the system. When all of them are in
+     * flight, decode blocks (counted in `StageStats::stalls`), the stream
+     * buffer fills up, and `receive()` accepts fewer bytes than offered and
+     * counts the rest in `Stats::rejectedBytes`. Nothing is dropped silently.
+     *
+     * @par Placement:
+     * Core and priority of each task are set in the "Property pipeline"
+     * menu. On single-core targets such as the ESP32-C6 all tasks run on
+     * core 0, and the priorities alone order the stages.
+     *
+     * @note ja: 受信からパブリッシュまでをタスク間キューで連結したイベント駆動パイプライン。
+     */
+    class Pipeline
+    {
+    /* ^\__________________________________________ */
+    /* #region Static members, Inner types.         */
+
+    public:
+
+        /** @brief The stages that run in their own task. */
+        enum class Stage : std::uint8_t
+        {
+            Decode = 0,
+            Validate,
+            Apply,
+            Publish,
+        };
+
+        /** @brief Number of `Stage` values. */
+        static constexpr std::size_t STAGE_COUNT = 4U;
+
+        /** @brief Receives the indices of the properties changed by one batch. */
+        using PublishFn = void (*)( machine::PropertyTable const &table
+                                  , std::span<std::size_t const> changed
+                                  , void *context ) noexcept;
+
+        /** @brief What the pipeline works on. */
+        struct Config
+        {
+            machine::PropertyTable *table; //!< Target table; must outlive the pipeline.
+            machine::Address component;    //!< Unit and component of the received property codes.
+            PublishFn publish;             //!< Called from the publish task; may be null.
+            void *context;                 //!< Passed to `publish`.
+        };
+
+        /** @brief Counters of one stage. */
+        struct StageStats
+        {
+            std::uint32_t batches;       //!< Batches processed.
+            std::uint32_t items;         //!< Updates processed.
+            std::uint32_t dropped;       //!< Updates dropped: malformed, unknown, out of range or unchanged.
+            std::uint32_t stalls;        //!< Times the stage had to wait for a free batch.
+            std::uint32_t maxDepth;      //!< Deepest input seen; in batches, or in bytes of the stream buffer for decode.
+            std::uint32_t avgLatencyUs;  //!< Moving average of queue wait plus processing; batch assembly for decode.
+            std::uint32_t maxLatencyUs;  //!< Worst queue wait plus processing; batch assembly for decode.
+        };
+
+        /** @brief Counters of the whole pipeline. */
+        struct Stats
+        {
+            std::uint32_t receivedBytes;                 //!< Bytes accepted by `receive()`.
+            std::uint32_t rejectedBytes;                 //!< Bytes refused by `receive()` (backpressure).
+            std::array<StageStats, STAGE_COUNT> stages;  //!< Indexed by `Stage`.
+        };
+
+    private:
+
+        static constexpr std::size_t BATCH_COUNT = CONFIG_PIPELINE_BATCH_COUNT;
+        static constexpr std::size_t BATCH_ITEMS = CONFIG_PIPELINE_BATCH_ITEMS;
+        static constexpr std::size_t BATCH_BYTES = CONFIG_PIPELINE_BATCH_BYTES;
+
+        static_assert( BATCH_BYTES >= UINT8_MAX, "A batch must hold the largest value" );
+
+        /** @brief One value update. */
+        struct Item
+        {
+            std::size_t index;     //!< Table index, set by validate.
+            std::uint16_t offset;  //!< Payload offset in `Batch::bytes`.
+            std::uint8_t code;     //!< Property code.
+            std::uint8_t size;     //!< Payload size.
+            bool accepted;         //!< Passed validation.
+            bool changed;          //!< Changed the table.
+        };
+
+        /** @brief Unit of work passed between stages. */
+        struct Batch
+        {
+            std::array<Item, BATCH_ITEMS> items;
+            std::array<std::byte, BATCH_BYTES> bytes;
+            std::uint16_t count;    //!< Items in use.
+            std::uint16_t used;     //!< Bytes in use.
+            std::int64_t stampUs;   //!< When the batch was handed to the current stage.
+
+            bool append( std::uint8_t code, std::span<std::byte const> value ) noexcept;
+
+            std::span<std::byte const> payload( Item const &item ) const noexcept
+            {
+                return std::span<std::byte const>( bytes.data() + item.offset, item.size );
+            }
+        };
+
+        /** @brief Counters of one stage, written by its task only. */
+        struct StageCounters
+        {
+            std::atomic<std::uint32_t> batches { 0U };
+            std::atomic<std::uint32_t> items { 0U };
+            std::atomic<std::uint32_t> dropped { 0U };
+            std::atomic<std::uint32_t> stalls { 0U };
+            std::atomic<std::uint32_t> maxDepth { 0U };
+            std::atomic<std::uint32_t> avgLatencyUs { 0U };
+            std::atomic<std::uint32_t> maxLatencyUs { 0U };
+        };
+
+        /** @brief Parameter of a stage task. */
+        struct StageTask
+        {
+            Pipeline *self;
+            Stage stage;
+        };
+
+    /* #endregion */// Static members, Inner types
+
+    /* ^\__________________________________________ */
+    /* #region Constructors.                        */
+
+    public:
+
+        explicit Pipeline( Config const &config ) noexcept;
+        ~Pipeline() noexcept;                                //!< Destructor (stops the tasks).
+        Pipeline( Pipeline const & ) noexcept = delete;      //!< Copy constructor (deleted).
+        Pipeline( Pipeline && ) noexcept = delete;           //!< Move constructor (deleted).
+
+    /* #endregion */// Constructors
+
+    /* ^\__________________________________________ */
+    /* #region Operators.                           */
+
+    public:
+
+        Pipeline &operator=( Pipeline const & ) noexcept = delete; //!< Copy operator (deleted).
+        Pipeline &operator=( Pipeline && ) noexcept = delete;      //!< Move operator (deleted).
+
+    /* #endregion */// Operators
+
+    /* ^\__________________________________________ */
+    /* #region Instance members.                    */
+
+    public:
+
+        /* #region Public methods */
+
+        /** @brief Creates the queues and starts the stage tasks. */
+        /**
+         * @return `true` if all tasks run; `false` on allocation failure.
+         */
+        [[nodiscard]]
+        bool start() noexcept;
+
+        /** @brief Hands received bytes to the pipeline. */
+        /**
+         * @details
+         * Called by the transport, e.g. a UART event task. Not ISR-safe.
+         *
+         * @param bytes [in] Received bytes, `PropertyCodec` frames.
+         * @param wait  [in] How long to wait for space in the stream buffer.
+         *
+         * @return The number of bytes accepted; less than `bytes.size()`
+         *         under backpressure.
+         */
+        std::size_t receive( std::span<std::byte const> bytes, TickType_t wait ) noexcept;
+
+        /** @brief Returns a copy of all counters. */
+        [[nodiscard]]
+        Stats stats() const noexcept;
+
+        /** @brief Writes all counters to the log with `ESP_LOGI`. */
+        void logStats() const noexcept;
+
+        /* #endregion */// Public methods
+
+    private:
+
+        /* #region Private methods */
+
+        static void decodeEntry( void *param ) noexcept;
+
+        static void stageEntry( void *param ) noexcept;
+
+        void decodeLoop() noexcept;
+
+        void stageLoop( Stage stage ) noexcept;
+
+        void validate( Batch &batch ) noexcept;
+
+        void apply( Batch &batch ) noexcept;
+
+        void publish( Batch &batch ) noexcept;
+
+        Batch *acquireBatch() noexcept;
+
+        void forward( Stage from, Batch *batch ) noexcept;
+
+        void record( Stage stage, Batch const &batch ) noexcept;
+
+        QueueHandle_t inputOf( Stage stage ) const noexcept;
+
+        StageCounters &countersOf( Stage stage ) noexcept
+        {
+            return counters_[static_cast<std::size_t>( stage )];
+        }
+
+        /* #endregion */// Private methods
+
+        /* #region Member variables */
+
+        Config config_;
+        machine::PropertyCodec::Decoder decoder_;            //!< Used by the decode task only.
+        std::array<Batch, BATCH_COUNT> batches_ {};
+        std::array<StageTask, STAGE_COUNT> stageTasks_ {};
+        std::array<TaskHandle_t, STAGE_COUNT> tasks_ {};
+        std::array<StageCounters, STAGE_COUNT> counters_ {};
+        StreamBufferHandle_t rx_ = nullptr;                  //!< receive() -> decode.
+        std::array<QueueHandle_t, STAGE_COUNT> queues_ {};   //!< Input of validate, apply, publish; [0] is the free queue.
+        std::atomic<std::uint32_t> receivedBytes_ { 0U };
+        std::atomic<std::uint32_t> rejectedBytes_ { 0U };
+
+        /* #endregion */// Member variables
+
+    /* #endregion */// Instance members
+
+    }; // class Pipeline
+
+} // namespace app
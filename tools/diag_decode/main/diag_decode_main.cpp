@@ -0,0 +1,73 @@
+/* DiagLog decoder (linux target)
+ * Reads a device log from stdin, e.g. `idf.py monitor | tee device.log`,
+ * and replaces every "DLOG,<hex>" line by its text:
+ *
+ *   ./build/diag_decode.elf < device.log
+ *
+ * All other lines are passed through unchanged.
+ */
+
+#include <diag_log.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string_view>
+
+// returns the value of one hex digit
+static std::optional<std::uint8_t> nibbleOf( char c )
+{
+    if ( c >= '0' && c <= '9' ) return static_cast<std::uint8_t>( c - '0' );
+    if ( c >= 'A' && c <= 'F' ) return static_cast<std::uint8_t>( c - 'A' + 10 );
+    if ( c >= 'a' && c <= 'f' ) return static_cast<std::uint8_t>( c - 'a' + 10 );
+    return std::nullopt;
+}
+
+// decodes the hex after "DLOG,"; returns the record size, 0 if malformed
+static std::size_t parseRecord( std::string_view hex, std::span<std::byte> out )
+{
+    if ( hex.size() % 2U != 0U || hex.size() / 2U > out.size() ) return 0U;
+
+    for ( std::size_t i = 0U; i < hex.size(); i += 2U )
+    {
+        auto const hi = nibbleOf( hex[i] ), lo = nibbleOf( hex[i + 1U] );
+        if ( !hi || !lo ) return 0U;
+        out[i / 2U] = std::byte{ static_cast<std::uint8_t>( ( *hi << 4U ) | *lo ) };
+    }
+    return hex.size() / 2U;
+}
+
+extern "C" void app_main()
+{
+    static constexpr std::string_view PREFIX = "DLOG,";
+
+    std::array<char, 1024U> line;
+    std::array<std::byte, 512U> record;
+
+    while ( std::fgets( line.data(), line.size(), stdin ) )
+    {
+        std::string_view text( line.data() );
+        while ( !text.empty() && ( text.back() == '\n' || text.back() == '\r' ) ) text.remove_suffix( 1U );
+
+        std::size_t const at = text.find( PREFIX );
+        std::size_t const size = ( at == std::string_view::npos ) ? 0U : parseRecord( text.substr( at + PREFIX.size() ), record );
+        auto const decoded = machine::DiagLog::decode( std::span<std::byte const>( record.data(), size ) );
+
+        if ( size == 0U || !decoded.has_value() )
+        {
+            std::printf( "%.*s\n", static_cast<int>( text.size() ), text.data() );
+            continue;
+        }
+
+        std::printf( "%.*s[tag %u] %s%s\n"
+                   , static_cast<int>( at ), text.data()
+                   , static_cast<unsigned>( decoded->tag )
+                   , decoded->text.c_str()
+                   , decoded->truncated ? " (truncated)" : "" );
+    }
+
+    std::exit( EXIT_SUCCESS );
+}
@@ -0,0 +1,354 @@
+/* Scale benchmark of the property model (linux target)
+ * Builds a synthetic machine of CONFIG_HOST_BENCH_UNITS units, each with
+ * CONFIG_HOST_BENCH_COMPONENTS components of CONFIG_HOST_BENCH_PROPERTIES
+ * properties, and pushes updates through create -> validate -> set -> format,
+ * first on one thread, then on CONFIG_HOST_BENCH_THREADS threads:
+ *
+ *   ./build/host_bench.elf
+ *
+ * Each run prints one CSV line prefixed with "HOSTBENCH,".
+ */
+
+#include "sdkconfig.h"
+#include <format.hpp>
+#include <format_util.hpp>
+#include <permission.hpp>
+#include <property.hpp>
+#include <property_table.hpp>
+#include <resolution.hpp>
+#include <spec.hpp>
+#include <value.hpp>
+#include <value255_format.hpp>
+#include <value_stats.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <optional>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/resource.h>
+
+using namespace machine;
+using namespace machine::property;
+
+// Note: Counts every `operator new`, on top of the payload allocations of value::Stats.
+static std::atomic<std::uint64_t> newCalls{ 0U };
+
+void *operator new( std::size_t size )
+{
+    newCalls.fetch_add( 1U, std::memory_order_relaxed );
+    if ( void *p = std::malloc( size ? size : 1U ) ) return p;
+    std::abort();
+}
+
+void *operator new( std::size_t size, std::nothrow_t const & ) noexcept
+{
+    newCalls.fetch_add( 1U, std::memory_order_relaxed );
+    return std::malloc( size ? size : 1U );
+}
+
+void operator delete( void *p ) noexcept { std::free( p ); }
+void operator delete( void *p, std::size_t ) noexcept { std::free( p ); }
+
+// Number of hot properties, see CONFIG_HOST_BENCH_HOT_PERCENT
+static constexpr std::size_t HOT_COUNT = 64U;
+
+// One spec shared by many properties, and how to make values for it
+struct Template
+{
+    Spec spec;
+    Format::Kind format;
+    std::uint8_t size;   // numeric and bitset: value size; string: longest value
+    std::uint32_t range; // numeric: values are 0 .. range; bitset: mask
+};
+
+// xorshift32; one per thread
+struct Random
+{
+    std::uint32_t state;
+
+    std::uint32_t next() noexcept
+    {
+        state ^= state << 13U;
+        state ^= state >> 17U;
+        state ^= state << 5U;
+        return state;
+    }
+};
+
+static std::vector<std::byte> littleEndian( std::uint32_t n, std::uint8_t size )
+{
+    std::vector<std::byte> bytes( size );
+    for ( std::uint8_t i = 0U; i < size; i++ ) bytes[i] = std::byte{ static_cast<std::uint8_t>( n >> ( 8U * i ) ) };
+    return bytes;
+}
+
+static std::optional<Template> numeric( Resolution::Kind resolution, std::uint8_t size, std::uint32_t max )
+{
+    auto const init = littleEndian( 0U, size ), lo = littleEndian( 0U, size ), hi = littleEndian( max, size );
+    auto spec = Spec::create( Permission::Kind::ReadWrite, resolution, init.data(), size, lo.data(), size, hi.data(), size );
+    if ( !spec ) return std::nullopt;
+    return Template{ std::move( *spec ), Format::Kind::Numeric, size, max };
+}
+
+static std::optional<Template> bitset( std::uint8_t size, std::uint32_t mask )
+{
+    auto const init = littleEndian( 0U, size ), hi = littleEndian( mask, size );
+    auto spec = Spec::create( Permission::Kind::ReadWrite, init.data(), size, nullptr, 0U, hi.data(), size );
+    if ( !spec ) return std::nullopt;
+    return Template{ std::move( *spec ), Format::Kind::BitSet, size, mask };
+}
+
+static std::optional<Template> boolean()
+{
+    auto spec = Spec::create( Permission::Kind::ReadWrite, &detail::BOOL_FALSE, detail::BOOL_SIZE
+                            , &detail::BOOL_FALSE, detail::BOOL_SIZE, &detail::BOOL_TRUE, detail::BOOL_SIZE );
+    if ( !spec ) return std::nullopt;
+    return Template{ std::move( *spec ), Format::Kind::Boolean, detail::BOOL_SIZE, 1U };
+}
+
+static std::optional<Template> string( std::uint8_t longest )
+{
+    std::array<std::byte, 6U> init;
+    std::ranges::fill( init, std::byte{ 'x' } );
+    auto spec = Spec::create( Permission::Kind::ReadOnly, init.data(), init.size(), nullptr, 0U, nullptr, 0U );
+    if ( !spec ) return std::nullopt;
+    return Template{ std::move( *spec ), Format::Kind::String, longest, 0U };
+}
+
+// About 70 % numeric, 15 % boolean, 10 % bitset, 5 % string, as on a real machine
+static std::optional<std::vector<Template>> makeTemplates()
+{
+    std::vector<std::optional<Template>> all;
+    all.push_back( numeric( Resolution::Kind::X1, 1U, 100U ) );
+    all.push_back( numeric( Resolution::Kind::X0_1, 2U, 5000U ) );
+    all.push_back( numeric( Resolution::Kind::X0_01, 2U, 10000U ) );
+    all.push_back( numeric( Resolution::Kind::X0_5, 2U, 200U ) );
+    all.push_back( numeric( Resolution::Kind::X1, 4U, 1000000U ) );
+    all.push_back( numeric( Resolution::Kind::X0_1, 4U, 250000U ) );
+    all.push_back( numeric( Resolution::Kind::X1, 2U, 30000U ) );
+    all.push_back( numeric( Resolution::Kind::X0_01, 4U, 99999U ) );
+    all.push_back( numeric( Resolution::Kind::X1, 1U, 127U ) );
+    all.push_back( numeric( Resolution::Kind::X0_1, 2U, 1200U ) );
+    all.push_back( numeric( Resolution::Kind::X1, 2U, 3600U ) );
+    all.push_back( numeric( Resolution::Kind::X0_5, 2U, 400U ) );
+    all.push_back( numeric( Resolution::Kind::X1, 1U, 10U ) );
+    all.push_back( numeric( Resolution::Kind::X0_01, 2U, 500U ) );
+    for ( int i = 0; i < 3; i++ ) all.push_back( boolean() );
+    all.push_back( bitset( 1U, 0x0FU ) );
+    all.push_back( bitset( 2U, 0xFFFFU ) );
+    all.push_back( string( 24U ) );
+
+    std::vector<Template> templates;
+    for ( auto &t : all ) {
+        if ( !t ) return std::nullopt;
+        templates.push_back( std::move( *t ) );
+    }
+    return templates;
+}
+
+struct Machine
+{
+    std::vector<Template> templates;
+    std::vector<std::uint8_t> templateOf; // per table index
+    PropertyTable table;
+};
+
+static std::optional<Machine> makeMachine()
+{
+    auto templates = makeTemplates();
+    if ( !templates ) return std::nullopt;
+
+    std::size_t const count = std::size_t{ CONFIG_HOST_BENCH_UNITS } * CONFIG_HOST_BENCH_COMPONENTS * CONFIG_HOST_BENCH_PROPERTIES;
+    PropertyTable::Builder builder;
+    builder.reserve( count );
+    Random random{ 0x1234567U };
+
+    // Note: Units have kinds 1 to 4, components are numbered within their unit.
+    for ( unsigned u = 0U; u < CONFIG_HOST_BENCH_UNITS; u++ )
+    {
+        for ( unsigned c = 0U; c < CONFIG_HOST_BENCH_COMPONENTS; c++ )
+        {
+            for ( unsigned p = 1U; p <= CONFIG_HOST_BENCH_PROPERTIES; p++ )
+            {
+                Template const &t = ( *templates )[random.next() % templates->size()];
+                auto property = Property::create( static_cast<std::uint8_t>( p ), t.spec.clone() );
+                if ( !property ) return std::nullopt;
+
+                builder.add( Address( static_cast<std::uint8_t>( 1U + u % 4U ), static_cast<std::uint8_t>( u / 4U )
+                                    , static_cast<std::uint8_t>( 1U + c ), 0U, static_cast<std::uint8_t>( p ) )
+                           , std::move( *property ) );
+            }
+        }
+    }
+
+    auto built = builder.build();
+    if ( !built ) return std::nullopt;
+    Machine m{ std::move( *templates ), {}, std::move( *built ) };
+
+    // Note: The builder sorted the properties; look the templates up again by spec.
+    m.templateOf.resize( m.table.size() );
+    for ( std::size_t i = 0U; i < m.table.size(); i++ )
+    {
+        auto const it = std::ranges::find_if( m.templates, [&]( Template const &t ) { return t.spec.isSameAs( m.table.at( i ).spec() ); } );
+        m.templateOf[i] = static_cast<std::uint8_t>( it - m.templates.begin() );
+    }
+    return m;
+}
+
+// writes a value that is valid for `t` to `out`, returns its size
+static std::uint8_t makeValue( Template const &t, Random &random, std::span<std::byte> out )
+{
+    std::uint32_t const r = random.next();
+
+    switch ( t.format )
+    {
+    case Format::Kind::String:
+    {
+        std::uint8_t const size = static_cast<std::uint8_t>( 4U + r % ( t.size - 3U ) );
+        for ( std::uint8_t i = 0U; i < size; i++ ) out[i] = std::byte{ static_cast<std::uint8_t>( 'a' + ( r >> i ) % 26U ) };
+        return size;
+    }
+    case Format::Kind::BitSet:
+    case Format::Kind::Boolean:
+    case Format::Kind::Numeric:
+    default:
+    {
+        std::uint32_t const n = ( t.format == Format::Kind::BitSet ) ? ( r & t.range ) : ( r % ( t.range + 1U ) );
+        for ( std::uint8_t i = 0U; i < t.size; i++ ) out[i] = std::byte{ static_cast<std::uint8_t>( n >> ( 8U * i ) ) };
+        return t.size;
+    }
+    }
+}
+
+// Results of one thread
+struct Worker
+{
+    std::vector<std::uint32_t> latencies; // ns per update
+    std::uint64_t rejected = 0U;
+    std::uint64_t formatted = 0U;         // characters, so the formatting cannot be dropped
+};
+
+static void work( Machine &m, Worker &w, std::uint32_t seed, std::size_t operations )
+{
+    using Clock = std::chrono::steady_clock;
+
+    Random random{ seed };
+    std::array<std::byte, 255U> payload;
+    std::array<char, 64U> text;
+    w.latencies.resize( operations );
+
+    for ( std::size_t op = 0U; op < operations; op++ )
+    {
+        bool const hot = ( random.next() % 100U ) < CONFIG_HOST_BENCH_HOT_PERCENT;
+        std::size_t const index = random.next() % ( hot ? std::min( HOT_COUNT, m.table.size() ) : m.table.size() );
+        std::uint8_t const size = makeValue( m.templates[m.templateOf[index]], random, payload );
+
+        auto const start = Clock::now();
+
+        auto value = Value::create( payload.data(), size );                                  // create
+        bool const valid = value.has_value() && m.table.at( index ).spec().isWithinRange( *value ); // validate
+        if ( valid ) static_cast<void>( m.table.set( index, payload.data(), size ) );         // set
+        w.formatted += util::formatTo( text, "{}", m.table.at( index ).value() ).size();      // format
+
+        w.latencies[op] = static_cast<std::uint32_t>( std::chrono::duration_cast<std::chrono::nanoseconds>( Clock::now() - start ).count() );
+        if ( !valid ) w.rejected++;
+    }
+}
+
+static long peakRssKb()
+{
+    rusage usage{};
+    getrusage( RUSAGE_SELF, &usage );
+    return usage.ru_maxrss;
+}
+
+static void run( Machine &m, unsigned threads )
+{
+    std::vector<Worker> workers( threads );
+    std::size_t const perThread = CONFIG_HOST_BENCH_OPERATIONS / threads;
+
+    // Note: Plain threads must not take the signals that drive the FreeRTOS simulator.
+    sigset_t all, previous;
+    sigfillset( &all );
+    pthread_sigmask( SIG_BLOCK, &all, &previous );
+
+    value::Stats::Snapshot const before = value::Stats::snapshot();
+    std::uint64_t const newBefore = newCalls.load();
+    auto const start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> pool;
+    for ( unsigned t = 0U; t < threads; t++ )
+    {
+        pool.emplace_back( [&m, &workers, t, perThread] { work( m, workers[t], 0x9E3779B9U * ( t + 1U ), perThread ); } );
+    }
+    for ( std::thread &thread : pool ) thread.join();
+
+    double const seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+    value::Stats::Snapshot const after = value::Stats::snapshot();
+    std::uint64_t const allocations = ( after.allocations - before.allocations ) + ( newCalls.load() - newBefore );
+    pthread_sigmask( SIG_SETMASK, &previous, nullptr );
+
+    std::vector<std::uint32_t> latencies;
+    std::uint64_t rejected = 0U;
+    for ( Worker &w : workers )
+    {
+        latencies.insert( latencies.end(), w.latencies.begin(), w.latencies.end() );
+        rejected += w.rejected;
+    }
+
+    std::size_t const total = latencies.size();
+    auto percentile = [&]( std::size_t per_mille )
+    {
+        auto const at = latencies.begin() + static_cast<std::ptrdiff_t>( ( total - 1U ) * per_mille / 1000U );
+        std::nth_element( latencies.begin(), at, latencies.end() );
+        return *at;
+    };
+    std::uint32_t const p50 = percentile( 500U );
+    std::uint32_t const p99 = percentile( 990U );
+
+    std::printf( "HOSTBENCH,%u,%zu,%.0f,%u,%u,%.3f,%llu,%u,%u,%ld\n"
+               , threads, total, static_cast<double>( total ) / seconds, p50, p99
+               , static_cast<double>( allocations ) / static_cast<double>( total )
+               , static_cast<unsigned long long>( rejected )
+               , after.contentions - before.contentions, after.spins - before.spins
+               , peakRssKb() );
+}
+
+extern "C" void app_main()
+{
+    auto const start = std::chrono::steady_clock::now();
+    auto machine = makeMachine();
+    if ( !machine ) {
+        std::printf( "Failed to build the synthetic machine\n" );
+        std::exit( EXIT_FAILURE );
+    }
+
+    std::array<std::size_t, 4U> perFormat{};
+    for ( std::uint8_t t : machine->templateOf ) perFormat[static_cast<std::size_t>( machine->templates[t].format )]++;
+
+    std::printf( "Machine: %zu properties (numeric %zu, boolean %zu, bitset %zu, string %zu), built in %.1f ms, peak RSS %ld kB\n"
+               , machine->table.size()
+               , perFormat[static_cast<std::size_t>( Format::Kind::Numeric )], perFormat[static_cast<std::size_t>( Format::Kind::Boolean )]
+               , perFormat[static_cast<std::size_t>( Format::Kind::BitSet )], perFormat[static_cast<std::size_t>( Format::Kind::String )]
+               , std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now() - start ).count(), peakRssKb() );
+    if constexpr ( !value::Stats::ENABLED ) {
+        std::printf( "CONFIG_VALUE255_STATS_ENABLE is off; payload allocations and lock contention read 0\n" );
+    }
+
+    std::printf( "HOSTBENCH,threads,updates,updates_per_s,p50_ns,p99_ns,allocs_per_update,rejected,contentions,spins,peak_rss_kb\n" );
+    run( *machine, 1U );
+    run( *machine, CONFIG_HOST_BENCH_THREADS );
+
+    std::exit( EXIT_SUCCESS );
+}